@@ -11,13 +11,83 @@
 
 namespace SKL::AOD
 {
-    template<typename TTask>
-    void ScheduleTask( AODTLSContext& TLSContext, TTask* InTask ) noexcept 
+    std::relaxed_value<uint64_t> SharedObject::FlushBudgetHitsCount{ 0U };
+    std::relaxed_value<uint64_t> StaticObject::FlushBudgetHitsCount{ 0U };
+    std::relaxed_value<uint64_t> CustomObject::FlushBudgetHitsCount{ 0U };
+    std::relaxed_value<uint64_t> Object::WorkerAffinityOverloadsCount{ 0U };
+    std::relaxed_value<uint64_t> Object::ParkedConsumersCount{ 0U };
+    std::relaxed_value<uint64_t> Object::OverloadsCount{ 0U };
+    std::relaxed_value<uint64_t> Object::TypeFlushBudgetHitsCounts[CAOD_MaxFlushStatsTypes]{};
+    std::relaxed_value<uint16_t> Object::FlushStatsTypesCount{ 1U };
+
+    uint16_t Object::AllocateFlushStatsTypeIndex() noexcept
     {
-        static_assert( std::is_same_v<TTask, IAODSharedObjectTask> 
-               || std::is_same_v<TTask, IAODStaticObjectTask> 
-               || std::is_same_v<TTask, IAODCustomObjectTask> );
+        // slot 0 is shared by the untracked objects
+        const uint16_t Index{ FlushStatsTypesCount.increment() };
+        if( CAOD_MaxFlushStatsTypes <= static_cast<uint32_t>( Index ) ) SKL_UNLIKELY
+        {
+            GLOG_WARNING( "AOD::Object::AllocateFlushStatsTypeIndex() All the %u flush stats slots are used, increase CAOD_MaxFlushStatsTypes!", CAOD_MaxFlushStatsTypes );
+            return 0U;
+        }
+
+        return Index;
+    }
+
+    //! Is the flush of an AOD object bounded by any budget
+    constexpr bool CAOD_IsFlushBounded{ 0U != CAOD_FlushTaskBudget || 0U != CAOD_FlushTimeBudget };
+
+    //! Budget of one flush pass on an AOD object
+    //! \remarks The clock is read only for bounded flushes
+    struct FlushBudget
+    {
+        explicit FlushBudget( bool bIsBounded ) noexcept 
+            : StartedAt{ ( 0U != CAOD_FlushTimeBudget && true == bIsBounded ) ? GetSystemUpTickCount() : 0U } {}
+
+        //! Account one dispatched task
+        //! \returns true if the budget was exhausted
+        SKL_FORCEINLINE SKL_NODISCARD bool Consume() noexcept
+        {
+            ++DispatchedTasks;
+
+            if constexpr( 0U != CAOD_FlushTaskBudget )
+            {
+                if( CAOD_FlushTaskBudget <= DispatchedTasks ) SKL_UNLIKELY
+                {
+                    return true;
+                }
+            }
+
+            if constexpr( 0U != CAOD_FlushTimeBudget )
+            {
+                if( 0U == ( DispatchedTasks & ( CAOD_FlushTimeBudgetCheckInterval - 1U ) ) )
+                {
+                    return static_cast<TEpochTimePoint>( CAOD_FlushTimeBudget ) <= GetSystemUpTickCount() - StartedAt;
+                }
+            }
+
+            return false;
+        }
+
+    private:
+        TEpochTimePoint StartedAt;
+        uint32_t        DispatchedTasks{ 0U };
+    };
+
+    //! Can the current thread hand off the rest of a flush to another worker
+    SKL_FORCEINLINE SKL_NODISCARD bool CanHandOffFlush( const AODTLSContext& TLSContext ) noexcept
+    {
+        if constexpr( CAOD_IsFlushBounded )
+        {
+            return false == TLSContext.GetDeferredAODTasksHandlingGroups().empty();
+        }
+        else
+        {
+            return false;
+        }
+    }
 
+    Worker* SelectTargetWorker( AODTLSContext& TLSContext ) noexcept 
+    {
         //Select target worker group
         const std::vector<WorkerGroup*>& TaskHandlingWGs{ TLSContext.GetDeferredAODTasksHandlingGroups() };
         SKL_ASSERT( false == TaskHandlingWGs.empty() );
@@ -92,331 +162,442 @@ namespace SKL::AOD
 
         SKL_ASSERT( nullptr != TargetW );
 
-        //Defer task to worker
-        TargetW->Defer( InTask );
+        return TargetW;
     }
-}
 
-namespace SKL::AOD
-{
-    void StaticObject::Flush() noexcept
+    Worker* Object::SelectPreferredWorker( AODTLSContext& TLSContext, uint32_t InPreferredWorkerId ) noexcept 
     {
-        while( true )
+        if constexpr( false == CAOD_EnableWorkerAffinity )
         {
-            auto* Task{ reinterpret_cast<IAODStaticObjectTask*>( TaskQueue.Pop() ) };
-            if( nullptr != Task ) SKL_LIKELY
+            return nullptr;
+        }
+        else
+        {
+            if( 0U == InPreferredWorkerId || TLSContext.WorkerAffinityId == InPreferredWorkerId )
             {
-                Task->Dispatch();
+                return nullptr;
+            }
 
-                SKL_ASSERT( nullptr != Task );
+            const uint16_t GroupId     { static_cast<uint16_t>( InPreferredWorkerId >> 16U ) };
+            const size_t   IndexInGroup{ static_cast<size_t>( InPreferredWorkerId & 0xFFFFU ) };
 
-                TSharedPtr<IAODStaticObjectTask>::Static_Reset( Task );
+            for( WorkerGroup* Group : TLSContext.GetDeferredAODTasksHandlingGroups() )
+            {
+                if( GroupId != Group->GetTag().Id )
+                {
+                    continue;
+                }
 
-                if( 1 == RemainingTasksCount.decrement() )
+                auto& Workers{ Group->GetWorkers() };
+                if( IndexInGroup >= Workers.size() ) SKL_UNLIKELY
                 {
-                    break;
+                    return nullptr;
                 }
+
+                Worker* TargetW{ Workers[IndexInGroup].get() };
+                if( nullptr == TargetW || false == TargetW->GetIsRunning() ) SKL_UNLIKELY
+                {
+                    return nullptr;
+                }
+
+                if( CAOD_WorkerAffinityMaxPendingTasks < TargetW->GetPendingAODDeferredTasksCount() ) SKL_UNLIKELY
+                {
+                    ( void )++WorkerAffinityOverloadsCount;
+                    return nullptr;
+                }
+
+                return TargetW;
             }
-            else
-            {
-                GLOG_DEBUG( "Flush SKIPP!" );
-                //SKL_BREAK();
-                // There is low a possiblility for a bit of spinning because of the gap between: case1{ RefPoint[0] and RefPoint[1] } or case2{ RefPoint[0] and RefPoint[2] }
-            }
+
+            return nullptr;
         }
     }
 
-    bool StaticObject::Dispatch( IAODStaticObjectTask* InTask ) noexcept
+    template<typename TTask>
+    void ScheduleTask( AODTLSContext& TLSContext, TTask* InTask ) noexcept 
     {
-        SKL_ASSERT( nullptr != InTask );
-        SKL_ASSERT( false == InTask->IsNull() );
-        
-        // reset next ptr 
-        InTask->Next = nullptr;
-
-        if( RemainingTasksCount.increment() != 0 ) // RefPoint [0]
-        {
-            // Queue the task (must be done only after the count increment
-            TaskQueue.Push( InTask ); // RefPoint [1]
+        static_assert( std::is_same_v<TTask, IAODSharedObjectTask> 
+               || std::is_same_v<TTask, IAODStaticObjectTask> 
+               || std::is_same_v<TTask, IAODCustomObjectTask> );
 
-            // There is a consumer present, just bail
-            return false;
-        }
+        //Defer task to worker
+        SelectTargetWorker( TLSContext )->Defer( InTask );
+    }
 
-        // Queue the task (must be done only after the count increment
-        TaskQueue.Push( InTask ); // RefPoint [2]
+    //! Hand off the rest of a flush to another worker
+    //! \remarks The next task of the object carries the consumer role (and self reference) of the object to the target worker
+    template<typename TTask>
+    void HandOffFlush( AODTLSContext& TLSContext, TTask* InNextTask ) noexcept 
+    {
+        static_assert( std::is_same_v<TTask, IAODSharedObjectTask> 
+               || std::is_same_v<TTask, IAODStaticObjectTask> 
+               || std::is_same_v<TTask, IAODCustomObjectTask> );
 
-        // This thread is the new consumer for this AODStaticObject instance, dispatch all available tasks.
+        // reset next ptr 
+        InNextTask->Next = nullptr;
 
-        // Static object lifetime expected (no tasks should be issued before the object was destroyed)
-        //TSharedPtr<AODObject>::Static_IncrementReference( this );
+        //Defer continuation to worker
+        SelectTargetWorker( TLSContext )->DeferAODFlushContinuation( InNextTask );
+    }
+}
 
-        auto *TLSContext = AODTLSContext::GetInstance();
-        SKL_ASSERT( nullptr != TLSContext );
+namespace SKL::AOD
+{
+    //! Does the consumer of a TObject object hold a reference to it [the StaticObject based objects are expected to outlive their tasks]
+    //! \remarks Only the flush of these objects can be suspended by a multi object dispatch barrier [see MultiObjectDispatch]
+    template<typename TObject>
+    constexpr bool CHasConsumerReference{ false == std::is_same_v<TObject, StaticObject> };
 
-        if( true == TLSContext->Flags.bIsAnyStaticDispatchInProgress )
+    template<typename TObject>
+    SKL_FORCEINLINE void AcquireConsumerReference( TObject& InObject ) noexcept
+    {
+        if constexpr( std::is_same_v<TObject, SharedObject> )
         {
-            TLSContext->PendingAOD_StaticObjects.push( this );
+            // Increment ref count for self (the reinterpret_cast should not affect the end result, the pointer is used as base to jump to the control block only)
+            TSharedPtr<SharedObject>::Static_IncrementReference( reinterpret_cast<SharedObject*>( InObject.GetParentObjectPointer() ) );
         }
-        else
+        else if constexpr( std::is_same_v<TObject, CustomObject> )
         {
-            TLSContext->Flags.bIsAnyStaticDispatchInProgress = true;
-
-            Flush();
-
-            while( false == TLSContext->PendingAOD_StaticObjects.empty() )
-            {
-                auto* PendingAODObject{ TLSContext->PendingAOD_StaticObjects.front() };
-                TLSContext->PendingAOD_StaticObjects.pop();
-
-                PendingAODObject->Flush();
-
-                // Static object lifetime expected (no tasks should be issued before the object was destroyed)
-                //TSharedPtr<AODObject>::Static_Reset( PendingAODObject );
-            }
-
-            TLSContext->Flags.bIsAnyStaticDispatchInProgress = false;
+            TCustomObjectSharedPtr::Static_IncrementReference( &InObject );
+        }
+    }
 
-            // Static object lifetime expected (no tasks should be issued before the object was destroyed)
-            //TSharedPtr<AODObject>::Static_Reset( this );
-        }                
+    template<typename TObject>
+    SKL_FORCEINLINE void ReleaseConsumerReference( TObject& InObject ) noexcept
+    {
+        if constexpr( std::is_same_v<TObject, SharedObject> )
+        {
+            TSharedPtr<SharedObject>::Static_Reset( reinterpret_cast<SharedObject*>( InObject.GetParentObjectPointer() ) );
+        }
+        else if constexpr( std::is_same_v<TObject, CustomObject> )
+        {
+            TCustomObjectSharedPtr::Static_Reset( &InObject );
+        }
+    }
 
-        return true;
+    //! Is any TObject object dispatched by this thread
+    template<typename TObject>
+    SKL_FORCEINLINE SKL_NODISCARD bool IsAnyDispatchInProgress( const AODTLSContext& TLSContext ) noexcept
+    {
+        if constexpr( std::is_same_v<TObject, SharedObject> )
+        {
+            return TLSContext.Flags.bIsAnySharedDispatchInProgress;
+        }
+        else if constexpr( std::is_same_v<TObject, StaticObject> )
+        {
+            return TLSContext.Flags.bIsAnyStaticDispatchInProgress;
+        }
+        else
+        {
+            return TLSContext.Flags.bIsAnyCustomDispatchInProgress;
+        }
     }
 
-    void StaticObject::DelayTask( IAODStaticObjectTask* InTask ) noexcept
+    template<typename TObject>
+    SKL_FORCEINLINE void SetIsAnyDispatchInProgress( AODTLSContext& TLSContext, bool bIsInProgress ) noexcept
     {
-        SKL_ASSERT( nullptr != AODTLSContext::GetInstance() );
-        auto& TLSData{ *AODTLSContext::GetInstance() };
+        if constexpr( std::is_same_v<TObject, SharedObject> )
+        {
+            TLSContext.Flags.bIsAnySharedDispatchInProgress = bIsInProgress;
+        }
+        else if constexpr( std::is_same_v<TObject, StaticObject> )
+        {
+            TLSContext.Flags.bIsAnyStaticDispatchInProgress = bIsInProgress;
+        }
+        else
+        {
+            TLSContext.Flags.bIsAnyCustomDispatchInProgress = bIsInProgress;
+        }
+    }
 
-        if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHandleAOD )
+    //! Get the queue of the TObject objects waiting for this thread's dispatch in progress to finish
+    template<typename TObject>
+    SKL_FORCEINLINE SKL_NODISCARD TLSManagedQueue<TObject*>& GetPendingObjects( AODTLSContext& TLSContext ) noexcept
+    {
+        if constexpr( std::is_same_v<TObject, SharedObject> )
         {
-            // Push task
-            TLSData.DelayedStaticObjectTasks.push( InTask );
+            return TLSContext.PendingAOD_SharedObjects;
+        }
+        else if constexpr( std::is_same_v<TObject, StaticObject> )
+        {
+            return TLSContext.PendingAOD_StaticObjects;
         }
         else
         {
+            return TLSContext.PendingAOD_CustomObjects;
+        }
+    }
 
-            if( FALSE == TLSData.bScheduleAODDelayedTasks )
-            {
-                // Push task
-                TLSData.DelayedStaticObjectTasks.push( InTask );
-            }
-            else
-            {
-                // Schedule task to other workers
-                ScheduleTask( TLSData, InTask );        
-            }
+    //! Get the delayed tasks of the TObject objects of this thread
+    template<typename TObject>
+    SKL_FORCEINLINE SKL_NODISCARD auto& GetDelayedTasks( AODTLSContext& TLSContext ) noexcept
+    {
+        if constexpr( std::is_same_v<TObject, SharedObject> )
+        {
+            return TLSContext.DelayedSharedObjectTasks;
+        }
+        else if constexpr( std::is_same_v<TObject, StaticObject> )
+        {
+            return TLSContext.DelayedStaticObjectTasks;
+        }
+        else
+        {
+            return TLSContext.DelayedCustomObjectTasks;
         }
     }
-}
 
-namespace SKL::AOD
-{
-    void SharedObject::Flush() noexcept
+    template<typename TObject>
+    EFlushResult ObjectDispatch::Flush( TObject& InObject, AODTLSContext* InTLSContext, bool bIsBounded, typename TObject::TTaskBase* InFirstTask ) noexcept
     {
+        using TTaskBase = typename TObject::TTaskBase;
+
+        FlushBudget Budget{ bIsBounded };
+
         while( true )
         {
-            auto* Task{ reinterpret_cast<IAODSharedObjectTask*>( TaskQueue.Pop() ) };
+            auto* Task{ nullptr != InFirstTask ? std::exchange( InFirstTask, nullptr ) : reinterpret_cast<TTaskBase*>( InObject.TaskQueue.Pop() ) };
             if( nullptr != Task ) SKL_LIKELY
             {
                 Task->Dispatch();
 
-                SKL_ASSERT( nullptr != Task );
+                ReleaseAODTask( Task );
 
-                TSharedPtr<IAODSharedObjectTask>::Static_Reset( Task );
+                if constexpr( CHasConsumerReference<TObject> )
+                {
+                    if( nullptr != InTLSContext && true == InTLSContext->Flags.bSuspendCurrentFlush ) SKL_UNLIKELY
+                    {
+                        // The task was a multi object dispatch barrier, the barrier task is not consumed, the consumer role (and the self reference) is now owned by the dispatch
+                        InTLSContext->Flags.bSuspendCurrentFlush = false;
+                        return EFlushResult::Suspended;
+                    }
+                }
+
+                if( 1 == InObject.RemainingTasksCount.decrement() )
+                {
+                    return EFlushResult::Done;
+                }
 
-                if( 1 == RemainingTasksCount.decrement() )
+                if( true == bIsBounded && true == Budget.Consume() ) SKL_UNLIKELY
                 {
-                    break;
+                    // Budget exhausted, this thread is still the consumer
+                    return EFlushResult::BudgetExhausted;
                 }
             }
             else
             {
-                GLOG_DEBUG( "Flush SKIPP!" );
-                //SKL_BREAK();
                 // There is low a possiblility for a bit of spinning because of the gap between: case1{ RefPoint[0] and RefPoint[1] } or case2{ RefPoint[0] and RefPoint[2] }
             }
         }
     }
 
-    bool SharedObject::Dispatch( IAODSharedObjectTask* InTask ) noexcept
+    template<typename TObject>
+    bool ObjectDispatch::Dispatch( TObject& InObject, typename TObject::TTaskBase* InTask ) noexcept
     {
         SKL_ASSERT( nullptr != InTask );
         SKL_ASSERT( false == InTask->IsNull() );
-        
-        // reset next ptr 
+
+        // reset next ptr
         InTask->Next = nullptr;
 
-        if( RemainingTasksCount.increment() != 0 ) // RefPoint [0]
+        if( 0 != InObject.RemainingTasksCount.increment() ) // RefPoint [0]
         {
             // Queue the task (must be done only after the count increment)
-            TaskQueue.Push( InTask ); // RefPoint [1]
+            InObject.TaskQueue.Push( InTask ); // RefPoint [1]
 
             // There is a consumer present, just bail
             return false;
         }
 
         // Queue the task (must be done only after the count increment)
-        TaskQueue.Push( InTask ); // RefPoint [2]
+        InObject.TaskQueue.Push( InTask ); // RefPoint [2]
 
-        // This thread is the new consumer for this AODObject instance, dispatch all available tasks.
-
-        // Increment ref count for self (the reinterpret_cast should not affect the end result, the pointer is used as base to jump to the control block only)
-        TSharedPtr<SharedObject>::Static_IncrementReference( reinterpret_cast<SharedObject*>( TargetSharedPointer ) );
+        // This thread is the new consumer for this AOD object instance, dispatch all available tasks.
+        return StartConsumer( InObject );
+    }
 
-        auto *TLSContext = AODTLSContext::GetInstance();
-        SKL_ASSERT( nullptr != TLSContext );
+    template<typename TObject>
+    bool ObjectDispatch::DispatchBatch( TObject& InObject, typename TObject::TTaskBase* InFirstTask, typename TObject::TTaskBase* InLastTask, uint64_t InTasksCount ) noexcept
+    {
+        SKL_ASSERT( nullptr != InFirstTask );
+        SKL_ASSERT( nullptr != InLastTask );
+        SKL_ASSERT( 0U < InTasksCount );
 
-        if( true == TLSContext->Flags.bIsAnySharedDispatchInProgress )
+        // Account for all tasks at once, each task is still consumed (decremented) individually by Flush()
+        if( 0 != InObject.RemainingTasksCount.increment( static_cast<uint32_t>( InTasksCount ) ) )
         {
-            TLSContext->PendingAOD_SharedObjects.push( this );
+            // Queue the whole chain (must be done only after the count increment)
+            InObject.TaskQueue.PushChain( InFirstTask, InLastTask );
+
+            // There is a consumer present, just bail
+            return false;
         }
-        else
-        {
-            TLSContext->Flags.bIsAnySharedDispatchInProgress = true;
 
-            Flush();
+        // Queue the whole chain (must be done only after the count increment)
+        InObject.TaskQueue.PushChain( InFirstTask, InLastTask );
 
-            while( false == TLSContext->PendingAOD_SharedObjects.empty() )
-            {
-                auto* PendingAODObject{ TLSContext->PendingAOD_SharedObjects.front() };
-                TLSContext->PendingAOD_SharedObjects.pop();
+        // This thread is the new consumer for this AOD object instance, dispatch all available tasks.
+        return StartConsumer( InObject );
+    }
 
-                PendingAODObject->Flush();
-                TSharedPtr<SharedObject>::Static_Reset( reinterpret_cast<SharedObject*>( PendingAODObject->TargetSharedPointer ) );
-            }
+    template<typename TObject>
+    bool ObjectDispatch::StartConsumer( TObject& InObject ) noexcept
+    {
+        AcquireConsumerReference( InObject );
 
-            TLSContext->Flags.bIsAnySharedDispatchInProgress = false;
+        if( false == InObject.AcquireFromReaders() ) SKL_UNLIKELY
+        {
+            // Concurrent readers are active, the consumer role (and the self reference) is taken over by the last reader to leave [see ResumeParkedConsumer()]
+            return false;
+        }
+
+        auto *TLSContext = AODTLSContext::GetInstance();
+        SKL_ASSERT( nullptr != TLSContext );
 
-            TSharedPtr<SharedObject>::Static_Reset( reinterpret_cast<SharedObject*>( TargetSharedPointer ) );
-        }                
+        RunConsumer( InObject, *TLSContext );
 
         return true;
     }
 
-    void SharedObject::DelayTask( IAODSharedObjectTask* InTask ) noexcept
+    template<typename TObject>
+    void ObjectDispatch::ResumeFlush( TObject& InObject, typename TObject::TTaskBase* InNextTask ) noexcept
     {
-        SKL_ASSERT( nullptr != AODTLSContext::GetInstance() );
-        auto& TLSData{ *AODTLSContext::GetInstance() };
-        
-        if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHandleAOD )
-        {
-            // Push task
-            TLSData.DelayedSharedObjectTasks.push( InTask );
-        }
-        else
+        SKL_ASSERT( nullptr != InNextTask );
+
+        auto *TLSContext = AODTLSContext::GetInstance();
+        if( nullptr == TLSContext ) SKL_UNLIKELY
         {
-            if( FALSE == TLSData.bScheduleAODDelayedTasks )
+            // Resumed outside of a worker, only while clearing a joined worker [see Worker::Clear()]
+            // There is no running worker left to hand the rest of the flush to and no tick to bound, the flush is finished here
+            // Only a multi object dispatch barrier can suspend a flush and it requires the AOD TLS context [see MultiObjectDispatch::SuspendCurrentFlush()]
+            const EFlushResult Result{ Flush( InObject, nullptr, false, InNextTask ) };
+            SKL_ASSERT( EFlushResult::Done == Result );
+            if( EFlushResult::Done == Result ) SKL_LIKELY
             {
-                // Push task
-                TLSData.DelayedSharedObjectTasks.push( InTask );
-            }
-            else
-            {
-                // Schedule task to other workers
-                ScheduleTask( TLSData, InTask );
+                ReleaseConsumerReference( InObject );
             }
+            return;
         }
+
+        SKL_ASSERT( false == IsAnyDispatchInProgress<TObject>( *TLSContext ) );
+
+        RunConsumer( InObject, *TLSContext, InNextTask );
     }
-}
 
-namespace SKL::AOD
-{
-    void CustomObject::Flush() noexcept
+    template<typename TObject>
+    void ObjectDispatch::RunConsumer( TObject& InObject, AODTLSContext& TLSContext, typename TObject::TTaskBase* InFirstTask ) noexcept
     {
-        while( true )
+        if( true == IsAnyDispatchInProgress<TObject>( TLSContext ) )
         {
-            auto* Task{ reinterpret_cast<IAODCustomObjectTask*>( TaskQueue.Pop() ) };
-            if( nullptr != Task ) SKL_LIKELY
-            {
-                Task->Dispatch();
+            SKL_ASSERT( nullptr == InFirstTask );
+            GetPendingObjects<TObject>( TLSContext ).push( &InObject );
+        }
+        else
+        {
+            SetIsAnyDispatchInProgress<TObject>( TLSContext, true );
 
-                TSharedPtr<IAODCustomObjectTask>::Static_Reset( Task );
+            FlushOrHandOff( InObject, TLSContext, InFirstTask );
 
-                if( 1 == RemainingTasksCount.decrement() )
-                {
-                    break;
-                }
-            }
-            else
+            auto& PendingObjects{ GetPendingObjects<TObject>( TLSContext ) };
+            while( false == PendingObjects.empty() )
             {
-                // There is low a possiblility for a bit of spinning because of the gap between: case1{ RefPoint[0] and RefPoint[1] } or case2{ RefPoint[0] and RefPoint[2] }
+                auto* PendingAODObject{ PendingObjects.front() };
+                PendingObjects.pop();
+
+                FlushOrHandOff( *PendingAODObject, TLSContext, nullptr );
             }
+
+            SetIsAnyDispatchInProgress<TObject>( TLSContext, false );
         }
     }
 
-    bool CustomObject::Dispatch( IAODCustomObjectTask* InTask ) noexcept
+    template<typename TObject>
+    void ObjectDispatch::FlushOrHandOff( TObject& InObject, AODTLSContext& TLSContext, typename TObject::TTaskBase* InFirstTask ) noexcept
     {
-        SKL_ASSERT( nullptr != InTask );
-        SKL_ASSERT( false == InTask->IsNull() );
-        
-        // reset next ptr 
-        InTask->Next = nullptr;
+        using TTaskBase = typename TObject::TTaskBase;
 
-        if( 0 != RemainingTasksCount.increment() ) // RefPoint [0]
+        InObject.UpdateLearnedPreferredWorker( TLSContext.WorkerAffinityId );
+
+        const EFlushResult Result{ Flush( InObject, &TLSContext, CanHandOffFlush( TLSContext ), InFirstTask ) };
+        if( EFlushResult::Done == Result ) SKL_LIKELY
         {
-            // Queue the task (must be done only after the count increment
-            TaskQueue.Push( InTask ); // RefPoint [1]
+            ReleaseConsumerReference( InObject );
+            return;
+        }
 
-            // There is a consumer present, just bail
-            return false;
+        if( EFlushResult::Suspended == Result )
+        {
+            // The multi object dispatch will resume the flush [see ResumeSuspended()]
+            return;
         }
 
-        // Queue the task (must be done only after the count increment
-        TaskQueue.Push( InTask ); // RefPoint [2]
+        ( void )++TObject::FlushBudgetHitsCount;
+        InObject.OnFlushBudgetHit();
 
-        // This thread is the new consumer for this AODObject instance, dispatch all available tasks.
+        // There are tasks left (RemainingTasksCount > 0), wait for the next one to be queued
+        TTaskBase* NextTask;
+        do
+        {
+            NextTask = reinterpret_cast<TTaskBase*>( InObject.TaskQueue.Pop() );
+        } while( nullptr == NextTask );
 
-        // Increment ref count for self (the reinterpret_cast should not affect the end result, the pointer is used as base to jump to the control block only)
-        TCustomObjectSharedPtr::Static_IncrementReference( this );
+        // The consumer role (and the self reference) is carried by the next task
+        HandOffFlush( TLSContext, NextTask );
+    }
 
-        auto *TLSContext = AODTLSContext::GetInstance();
-        SKL_ASSERT( nullptr != TLSContext );
+    template<typename TObject>
+    void ObjectDispatch::ResumeSuspended( TObject& InObject, AODTLSContext& TLSContext ) noexcept
+    {
+        static_assert( CHasConsumerReference<TObject>, "AOD::ObjectDispatch::ResumeSuspended() The StaticObject flush can't be suspended" );
 
-        if( true == TLSContext->Flags.bIsAnyCustomDispatchInProgress )
+        // Consume the barrier task that suspended the flush
+        if( 1 == InObject.RemainingTasksCount.decrement() )
         {
-            TLSContext->PendingAOD_CustomObjects.push( this );
+            ReleaseConsumerReference( InObject );
+            return;
         }
-        else
-        {
-            TLSContext->Flags.bIsAnyCustomDispatchInProgress = true;
-
-            Flush();
-
-            while( false == TLSContext->PendingAOD_CustomObjects.empty() )
-            {
-                auto* PendingAODObject{ TLSContext->PendingAOD_CustomObjects.front() };
-                TLSContext->PendingAOD_CustomObjects.pop();
 
-                PendingAODObject->Flush();
-                TCustomObjectSharedPtr::Static_Reset( PendingAODObject );
-            }
-
-            TLSContext->Flags.bIsAnyCustomDispatchInProgress = false;
+        // Tasks were queued while suspended, continue the flush as the consumer (queued as pending if any dispatch is in progress on this thread)
+        RunConsumer( InObject, TLSContext );
+    }
 
-            TCustomObjectSharedPtr::Static_Reset( this );
-        }                
+    template<typename TObject>
+    void ObjectDispatch::ResumeParkedConsumer( TObject& InObject ) noexcept
+    {
+        auto *TLSContext = AODTLSContext::GetInstance();
+        SKL_ASSERT( nullptr != TLSContext );
 
-        return true;
+        // The last reader left the object, continue as the consumer parked by AcquireFromReaders()
+        RunConsumer( InObject, *TLSContext );
     }
 
-    void CustomObject::DelayTask( IAODCustomObjectTask* InTask ) noexcept
+    template<typename TObject>
+    void ObjectDispatch::DelayTask( TObject& InObject, typename TObject::TTaskBase* InTask ) noexcept
     {
         SKL_ASSERT( nullptr != AODTLSContext::GetInstance() );
         auto& TLSData{ *AODTLSContext::GetInstance() };
-        
+
+        if constexpr( CAOD_EnableWorkerAffinity )
+        {
+            Worker* PreferredWorker{ Object::SelectPreferredWorker( TLSData, InObject.GetPreferredWorkerId() ) };
+            if( nullptr != PreferredWorker )
+            {
+                // Delay the task on the preferred worker of this object
+                PreferredWorker->Defer( InTask );
+                return;
+            }
+        }
+
         if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHandleAOD )
         {
             // Push task
-            TLSData.DelayedCustomObjectTasks.push( InTask );
+            GetDelayedTasks<TObject>( TLSData ).push( InTask );
         }
         else
         {
             if( FALSE == TLSData.bScheduleAODDelayedTasks )
             {
                 // Push task
-                TLSData.DelayedCustomObjectTasks.push( InTask );
+                GetDelayedTasks<TObject>( TLSData ).push( InTask );
             }
             else
             {
@@ -425,6 +606,29 @@ namespace SKL::AOD
             }
         }
     }
+
+    template bool ObjectDispatch::Dispatch<SharedObject>( SharedObject&, IAODSharedObjectTask* ) noexcept;
+    template bool ObjectDispatch::Dispatch<StaticObject>( StaticObject&, IAODStaticObjectTask* ) noexcept;
+    template bool ObjectDispatch::Dispatch<CustomObject>( CustomObject&, IAODCustomObjectTask* ) noexcept;
+
+    template bool ObjectDispatch::DispatchBatch<SharedObject>( SharedObject&, IAODSharedObjectTask*, IAODSharedObjectTask*, uint64_t ) noexcept;
+    template bool ObjectDispatch::DispatchBatch<StaticObject>( StaticObject&, IAODStaticObjectTask*, IAODStaticObjectTask*, uint64_t ) noexcept;
+    template bool ObjectDispatch::DispatchBatch<CustomObject>( CustomObject&, IAODCustomObjectTask*, IAODCustomObjectTask*, uint64_t ) noexcept;
+
+    template void ObjectDispatch::DelayTask<SharedObject>( SharedObject&, IAODSharedObjectTask* ) noexcept;
+    template void ObjectDispatch::DelayTask<StaticObject>( StaticObject&, IAODStaticObjectTask* ) noexcept;
+    template void ObjectDispatch::DelayTask<CustomObject>( CustomObject&, IAODCustomObjectTask* ) noexcept;
+
+    template void ObjectDispatch::ResumeFlush<SharedObject>( SharedObject&, IAODSharedObjectTask* ) noexcept;
+    template void ObjectDispatch::ResumeFlush<StaticObject>( StaticObject&, IAODStaticObjectTask* ) noexcept;
+    template void ObjectDispatch::ResumeFlush<CustomObject>( CustomObject&, IAODCustomObjectTask* ) noexcept;
+
+    template void ObjectDispatch::ResumeSuspended<SharedObject>( SharedObject&, AODTLSContext& ) noexcept;
+    template void ObjectDispatch::ResumeSuspended<CustomObject>( CustomObject&, AODTLSContext& ) noexcept;
+
+    template void ObjectDispatch::ResumeParkedConsumer<SharedObject>( SharedObject& ) noexcept;
+    template void ObjectDispatch::ResumeParkedConsumer<StaticObject>( StaticObject& ) noexcept;
+    template void ObjectDispatch::ResumeParkedConsumer<CustomObject>( CustomObject& ) noexcept;
 }
 
 namespace SKL
@@ -12,18 +12,417 @@
 //Object
 namespace SKL::AOD
 {
-    struct alignas( alignof( void* ) ) Object
+    struct ObjectDispatch;
+    struct MultiObjectDispatch;
+    struct FutureDispatch;
+
+    //! Result of one flush pass on an AOD object
+    enum class EFlushResult: uint8_t
+    {
+          Done            //!< All tasks were dispatched, the consumer role was released
+        , BudgetExhausted //!< The flush budget was exhausted, this thread is still the consumer
+        , Suspended       //!< The flush was suspended by a multi object dispatch, the consumer role is owned by the dispatch [see MultiObjectDispatch]
+    };
+
+    //! Extended state of the AOD objects [see CAOD_EnableExtendedObjects]
+    //! \remarks Empty by default (the AOD objects stay 4 pointers in size), the state is read as 0 and the stores are ignored
+    template<bool bIsExtended>
+    struct ObjectExtension
+    {
+    protected:
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t LoadPreferredWorkerId() const noexcept { return 0U; }
+        SKL_FORCEINLINE void StorePreferredWorkerId( uint32_t ) noexcept {}
+        SKL_FORCEINLINE SKL_NODISCARD bool IsPreferredWorkerFixed() const noexcept { return false; }
+        SKL_FORCEINLINE void SetIsPreferredWorkerFixed( bool ) noexcept {}
+        SKL_FORCEINLINE SKL_NODISCARD uint16_t LoadFlushStatsTypeIndex() const noexcept { return 0U; }
+        SKL_FORCEINLINE void StoreFlushStatsTypeIndex( uint16_t ) noexcept {}
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t LoadMaxPendingTasks() const noexcept { return 0U; }
+        SKL_FORCEINLINE void StoreMaxPendingTasks( uint32_t ) noexcept {}
+    };
+
+    //! Extended state of the AOD objects, grows each object from 4 to 6 pointers
+    template<>
+    struct ObjectExtension<true>
+    {
+    protected:
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t LoadPreferredWorkerId() const noexcept { return PreferredWorkerId.load_relaxed(); }
+        SKL_FORCEINLINE void StorePreferredWorkerId( uint32_t InWorkerAffinityId ) noexcept { PreferredWorkerId.store_relaxed( InWorkerAffinityId ); }
+        SKL_FORCEINLINE SKL_NODISCARD bool IsPreferredWorkerFixed() const noexcept { return FALSE != bIsPreferredWorkerFixed.load_relaxed(); }
+        SKL_FORCEINLINE void SetIsPreferredWorkerFixed( bool bIsFixed ) noexcept { bIsPreferredWorkerFixed.store_relaxed( static_cast<uint16_t>( bIsFixed ? TRUE : FALSE ) ); }
+        SKL_FORCEINLINE SKL_NODISCARD uint16_t LoadFlushStatsTypeIndex() const noexcept { return FlushStatsTypeIndex.load_relaxed(); }
+        SKL_FORCEINLINE void StoreFlushStatsTypeIndex( uint16_t InIndex ) noexcept { FlushStatsTypeIndex.store_relaxed( InIndex ); }
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t LoadMaxPendingTasks() const noexcept { return MaxPendingTasks.load_relaxed(); }
+        SKL_FORCEINLINE void StoreMaxPendingTasks( uint32_t InMaxPendingTasks ) noexcept { MaxPendingTasks.store_relaxed( InMaxPendingTasks ); }
+
+        std::relaxed_value<uint32_t> PreferredWorkerId      { 0U };     //!< Affinity id of the preferred worker of this object [see Worker::GetAffinityId()]
+        std::relaxed_value<uint16_t> bIsPreferredWorkerFixed{ FALSE };  //!< Was the preferred worker set explicitly
+        std::relaxed_value<uint16_t> FlushStatsTypeIndex    { 0U };     //!< Flush stats slot of the type of this object [0 = untracked, see TrackFlushStatsAs()]
+        std::relaxed_value<uint32_t> MaxPendingTasks        { 0U };     //!< Max number of tasks pending on this object [0 = no limit]
+    };
+
+    struct alignas( alignof( void* ) ) Object : ObjectExtension<CAOD_EnableExtendedObjects>
     {
         Object() noexcept = default;
         ~Object() noexcept = default;
 
+        //! Set the worker preferred to handle the delayed tasks of this object, nullptr disables the worker affinity for this object
+        //! \remarks By default the preferred worker is learned from the last (active worker) consumer of this object
+        //! \remarks Requires CAOD_EnableExtendedObjects, ignored otherwise
+        SKL_FORCEINLINE void SetPreferredWorker( const Worker* InWorker ) noexcept
+        {
+            SetIsPreferredWorkerFixed( true );
+            StorePreferredWorkerId( nullptr != InWorker ? InWorker->GetAffinityId() : 0U );
+        }
+
+        //! Learn the preferred worker of this object from its consumers [default]
+        SKL_FORCEINLINE void LearnPreferredWorker() noexcept
+        {
+            SetIsPreferredWorkerFixed( false );
+        }
+
+        //! Get the affinity id of the preferred worker of this object [0 = no preferred worker, see Worker::GetAffinityId()]
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t GetPreferredWorkerId() const noexcept { return LoadPreferredWorkerId(); }
+
+        //! Get the number of times a delayed AOD task could not be routed to the preferred worker of its object because the worker was overloaded
+        SKL_FORCEINLINE SKL_NODISCARD static uint64_t GetWorkerAffinityOverloadsCount() noexcept { return WorkerAffinityOverloadsCount.load_relaxed(); }
+
+        //! Get the number of times a new consumer had to wait (parked, not spinning) for the concurrent readers to leave its object [see DoAsyncRead()]
+        SKL_FORCEINLINE SKL_NODISCARD static uint64_t GetParkedConsumersCount() noexcept { return ParkedConsumersCount.load_relaxed(); }
+
+        //! Set the max number of tasks pending on this object, once reached DoAsync() and DoAsyncBatch() return ROverloaded instead of queueing [0 = no limit, default]
+        //! \remarks Soft limit, checked before queueing, concurrent producers can exceed it by at most one task (batch) each
+        //! \remarks Requires CAOD_EnableExtendedObjects, ignored otherwise
+        SKL_FORCEINLINE void SetMaxPendingTasks( uint32_t InMaxPendingTasks ) noexcept { StoreMaxPendingTasks( InMaxPendingTasks ); }
+
+        //! Get the max number of tasks pending on this object [0 = no limit]
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t GetMaxPendingTasks() const noexcept { return LoadMaxPendingTasks(); }
+
+        //! Get the number of tasks pending on this object (queued or being dispatched)
+        SKL_FORCEINLINE SKL_NODISCARD uint64_t GetPendingTasksCount() const noexcept { return RemainingTasksCount.load_relaxed(); }
+
+        //! Get the number of tasks rejected (ROverloaded) because their object reached its max pending tasks count
+        //! \remarks With SKL_KPI_QUEUE_SIZES the rejections are also counted per producer thread [see KPIContext::Static_GetAODObjectOverloadsCount()]
+        SKL_FORCEINLINE SKL_NODISCARD static uint64_t GetOverloadsCount() noexcept { return OverloadsCount.load_relaxed(); }
+
+        //! Account the flush budget hits of this object to the TObject type [see GetTypeFlushBudgetHitsCount()]
+        //! \remarks Done by the SharedObject( TObject* ) constructor, the StaticObject and CustomObject based types call it in their constructor
+        //! \remarks Requires CAOD_EnableExtendedObjects, otherwise all the hits are accounted to the untracked slot
+        template<typename TObject>
+        SKL_FORCEINLINE void TrackFlushStatsAs() noexcept { StoreFlushStatsTypeIndex( GetFlushStatsTypeIndex<TObject>() ); }
+
+        //! Get the number of times a consumer exhausted its flush budget on a TObject object and handed the rest of the flush to another worker
+        template<typename TObject>
+        SKL_FORCEINLINE SKL_NODISCARD static uint64_t GetTypeFlushBudgetHitsCount() noexcept { return TypeFlushBudgetHitsCounts[ GetFlushStatsTypeIndex<TObject>() ].load_relaxed(); }
+
     protected:
+        //! Account one flush budget hit to the type of this object
+        SKL_FORCEINLINE void OnFlushBudgetHit() noexcept { ( void )++TypeFlushBudgetHitsCounts[ LoadFlushStatsTypeIndex() ]; }
+
+        //! Get the flush stats slot of the TObject type [allocated on first use, 0 if all the slots are used]
+        template<typename TObject>
+        SKL_NODISCARD static uint16_t GetFlushStatsTypeIndex() noexcept
+        {
+            static const uint16_t Index{ AllocateFlushStatsTypeIndex() };
+            return Index;
+        }
+
+        //! Allocate a new flush stats slot for an object type
+        SKL_NODISCARD static uint16_t AllocateFlushStatsTypeIndex() noexcept;
+
+        //! Can InTasksCount more tasks be queued on this object without exceeding its max pending tasks count
+        //! \returns false if the object is overloaded (the rejection is accounted in OverloadsCount)
+        SKL_FORCEINLINE SKL_NODISCARD bool CanQueueTasks( uint64_t InTasksCount = 1U ) noexcept
+        {
+            const uint32_t MaxPending{ LoadMaxPendingTasks() };
+            if( 0U == MaxPending || RemainingTasksCount.load_relaxed() + InTasksCount <= static_cast<uint64_t>( MaxPending ) ) SKL_LIKELY
+            {
+                return true;
+            }
+
+            ( void )++OverloadsCount;
+
+            #if defined(SKL_KPI_QUEUE_SIZES)
+            KPIContext::Increment_AODObjectOverloadsCount();
+            #endif
+
+            return false;
+        }
+
+        //! Learn the worker consuming this object as the preferred worker
+        SKL_FORCEINLINE void UpdateLearnedPreferredWorker( uint32_t InWorkerAffinityId ) noexcept
+        {
+            if constexpr( CAOD_EnableWorkerAffinity )
+            {
+                if( 0U != InWorkerAffinityId 
+                 && false == IsPreferredWorkerFixed() 
+                 && InWorkerAffinityId != LoadPreferredWorkerId() )
+                {
+                    StorePreferredWorkerId( InWorkerAffinityId );
+                }
+            }
+        }
+
+        //! Select the preferred worker of this object as target for its delayed tasks
+        //! \returns nullptr if there is no preferred worker, if it is the current worker, if it is not handling deferred AOD tasks or if it is overloaded
+        SKL_NODISCARD static Worker* SelectPreferredWorker( AODTLSContext& TLSContext, uint32_t InPreferredWorkerId ) noexcept;
+
+        //! [Reader] Enter the object as a concurrent reader, must always be paired with LeaveRead()
+        //! \returns true if no task is pending on the object and the read can be executed now, false if the read must be queued (ordered after the pending tasks)
+        SKL_FORCEINLINE SKL_NODISCARD bool EnterRead() noexcept
+        {
+            ( void )ReadersState.fetch_add( CReadersStateReader, std::memory_order_relaxed );
+
+            // pairs with the fence in AcquireFromReaders(), either the reader sees the pending task or the consumer sees the reader
+            std::atomic_thread_fence( std::memory_order_seq_cst );
+
+            return 0U == RemainingTasksCount.load_relaxed();
+        }
+
+        //! [Reader] Leave the object
+        //! \returns true if this was the last reader and the consumer role parked by AcquireFromReaders() is now owned by this thread
+        SKL_FORCEINLINE SKL_NODISCARD bool LeaveRead() noexcept
+        {
+            const uint32_t PreviousState{ ReadersState.fetch_sub( CReadersStateReader, std::memory_order_acq_rel ) };
+            if( ( CReadersStateReader | CReadersStateConsumerParked ) != PreviousState ) SKL_LIKELY
+            {
+                return false;
+            }
+
+            // only one thread can claim the parked consumer role, if another reader entered meanwhile, it will claim it when leaving
+            uint32_t Expected{ CReadersStateConsumerParked };
+            return ReadersState.compare_exchange_strong( Expected, 0U, std::memory_order_acquire, std::memory_order_relaxed );
+        }
+
+        //! [Consumer] Called by the new consumer of the object, right after taking the consumer role
+        //! \returns true if there are no active readers and the consumer can flush, false if the consumer role was parked until the last active reader leaves [see LeaveRead()]
+        SKL_FORCEINLINE SKL_NODISCARD bool AcquireFromReaders() noexcept
+        {
+            if constexpr( false == CAOD_EnableConcurrentReads )
+            {
+                return true;
+            }
+            else
+            {
+                // pairs with the fence in EnterRead()
+                std::atomic_thread_fence( std::memory_order_seq_cst );
+
+                uint32_t CurrentState{ ReadersState.load( std::memory_order_acquire ) };
+                while( 0U != CurrentState )
+                {
+                    SKL_ASSERT( 0U == ( CurrentState & CReadersStateConsumerParked ) );
+
+                    if( true == ReadersState.compare_exchange_weak( CurrentState, CurrentState | CReadersStateConsumerParked, std::memory_order_acq_rel, std::memory_order_acquire ) )
+                    {
+                        ( void )++ParkedConsumersCount;
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+        }
+
+        static constexpr uint32_t CReadersStateConsumerParked{ 1U }; //!< [ReadersState] The consumer waits for the active readers to leave
+        static constexpr uint32_t CReadersStateReader        { 2U }; //!< [ReadersState] One active reader
+
         //First cache line
-        std::relaxed_value<uint64_t> RemainingTasksCount; //!< Remaining tasks to execute on this object
-        AODTaskQueue                 TaskQueue;           //!< Task queue
+        std::relaxed_value<uint32_t> RemainingTasksCount;               //!< Remaining tasks to execute on this object
+        std::atomic<uint32_t>        ReadersState           { 0U };     //!< Active concurrent readers count (x CReadersStateReader) | CReadersStateConsumerParked
+        AODTaskQueue                 TaskQueue;                         //!< Task queue
+
+        static std::relaxed_value<uint64_t> WorkerAffinityOverloadsCount; //!< Number of delayed tasks not routed to the overloaded preferred worker of their object
+        static std::relaxed_value<uint64_t> ParkedConsumersCount;         //!< Number of consumers parked until the active readers left their object
+        static std::relaxed_value<uint64_t> OverloadsCount;               //!< Number of tasks rejected because their object reached its max pending tasks count
+        static std::relaxed_value<uint64_t> TypeFlushBudgetHitsCounts[CAOD_MaxFlushStatsTypes]; //!< Number of flushes handed off to another worker, per object type
+        static std::relaxed_value<uint16_t> FlushStatsTypesCount;                               //!< Number of allocated flush stats slots
+
+        friend struct ObjectDispatch;
+        friend struct MultiObjectDispatch;
     };  
 
-    static_assert( sizeof( Object ) == ( sizeof( void* ) * 4 ) );
+    static_assert( sizeof( Object ) == ( sizeof( void* ) * ( CAOD_EnableExtendedObjects ? 6U : 4U ) ) );
+}
+
+//ObjectDispatch
+namespace SKL::AOD
+{
+    //! Dispatch of the tasks on an AOD object, shared by all the object kinds [SharedObject, StaticObject and CustomObject]
+    //! \remarks Each object kind provides TTaskBase (the task interface) and TTask<TaskSize> (the task type) of its tasks
+    //! \remarks The SharedObject and CustomObject consumers hold a reference to their object, the StaticObject based objects are expected to outlive their tasks
+    //! \remarks Only the SharedObject and CustomObject flushes can be suspended [see MultiObjectDispatch]
+    struct ObjectDispatch
+    {
+        //! Allocate a task for the functor and dispatch it on the object [see SharedObject::DoAsync()]
+        template<typename TObject, typename TFunctor>
+        SKL_FORCEINLINE SKL_NODISCARD static RStatus DoAsync( TObject& InObject, TFunctor&& InFunctor ) noexcept
+        {
+            using TaskType = typename TObject::template TTask<sizeof( TFunctor )>;
+
+            if( false == InObject.CanQueueTasks() ) SKL_UNLIKELY
+            {
+                return ROverloaded;
+            }
+
+            TaskType* NewTask{ AllocateAODTask<TaskType>() };
+            if( nullptr == NewTask ) SKL_UNLIKELY
+            {
+                GLOG_DEBUG( "AOD::ObjectDispatch::DoAsync() Failed to allocate task!" );
+                return RAllocationFailed;
+            }
+
+            NewTask->SetParent( &InObject );
+            NewTask->SetDispatch( std::forward<TFunctor>( InFunctor ) );
+
+            if( Dispatch( InObject, NewTask ) )
+            {
+                return RExecutedSync;
+            }
+
+            return RSuccess;
+        }
+
+        //! Execute the functor now, concurrently with the other reads, if no task is pending on the object, otherwise dispatch it as a regular task [see SharedObject::DoAsyncRead()]
+        template<typename TObject, typename TFunctor>
+        SKL_FORCEINLINE SKL_NODISCARD static RStatus DoAsyncRead( TObject& InObject, TFunctor&& InFunctor ) noexcept
+        {
+            if constexpr( CAOD_EnableConcurrentReads )
+            {
+                const bool bCanReadNow{ InObject.EnterRead() };
+                if( true == bCanReadNow ) SKL_LIKELY
+                {
+                    if constexpr( std::is_same_v<TObject, StaticObject> )
+                    {
+                        InFunctor();
+                    }
+                    else
+                    {
+                        InFunctor( static_cast<const TObject&>( InObject ) );
+                    }
+                }
+
+                if( true == InObject.LeaveRead() ) SKL_UNLIKELY
+                {
+                    ResumeParkedConsumer( InObject );
+                }
+
+                if( true == bCanReadNow ) SKL_LIKELY
+                {
+                    return RExecutedSync;
+                }
+            }
+
+            if constexpr( std::is_same_v<TObject, StaticObject> )
+            {
+                return DoAsync( InObject, std::forward<TFunctor>( InFunctor ) );
+            }
+            else
+            {
+                return DoAsync( InObject, [ Functor = std::forward<TFunctor>( InFunctor ) ]( TObject& InTaskObject ) mutable noexcept -> void
+                {
+                    Functor( static_cast<const TObject&>( InTaskObject ) );
+                } );
+            }
+        }
+
+        //! Allocate a task for each functor and dispatch all of them, in order, on the object at once [see SharedObject::DoAsyncBatch()]
+        template<typename TObject, typename... TFunctors>
+        SKL_FORCEINLINE SKL_NODISCARD static RStatus DoAsyncBatch( TObject& InObject, TFunctors&&... InFunctors ) noexcept
+        {
+            using TTaskBase = typename TObject::TTaskBase;
+
+            if( false == InObject.CanQueueTasks( static_cast<uint64_t>( sizeof...( TFunctors ) ) ) ) SKL_UNLIKELY
+            {
+                return ROverloaded;
+            }
+
+            TTaskBase* FirstTask{ nullptr };
+            TTaskBase* LastTask { nullptr };
+
+            const bool bAllAllocated{ ( AppendBatchTask( InObject, FirstTask, LastTask, std::forward<TFunctors>( InFunctors ) ) && ... ) };
+            if( false == bAllAllocated ) SKL_UNLIKELY
+            {
+                GLOG_DEBUG( "AOD::ObjectDispatch::DoAsyncBatch() Failed to allocate task!" );
+                ReleaseAODTaskChain( FirstTask );
+                return RAllocationFailed;
+            }
+
+            if( DispatchBatch( InObject, FirstTask, LastTask, static_cast<uint64_t>( sizeof...( TFunctors ) ) ) )
+            {
+                return RExecutedSync;
+            }
+
+            return RSuccess;
+        }
+
+        //! Dispatch the task on the object
+        //! \returns true if this thread became the consumer of the object and dispatched the task (sync)
+        template<typename TObject>
+        static bool Dispatch( TObject& InObject, typename TObject::TTaskBase* InTask ) noexcept;
+
+        //! Dispatch the chain of tasks [InFirstTask ... InLastTask] on the object at once (one RemainingTasksCount increment and one queue splice)
+        //! \returns true if this thread became the consumer of the object and dispatched the tasks (sync)
+        template<typename TObject>
+        static bool DispatchBatch( TObject& InObject, typename TObject::TTaskBase* InFirstTask, typename TObject::TTaskBase* InLastTask, uint64_t InTasksCount ) noexcept;
+
+        //! Delay the dispatch of the task on the object
+        template<typename TObject>
+        static void DelayTask( TObject& InObject, typename TObject::TTaskBase* InTask ) noexcept;
+
+        //! Resume the flush handed off to this thread, InNextTask carries the consumer role of the object
+        template<typename TObject>
+        static void ResumeFlush( TObject& InObject, typename TObject::TTaskBase* InNextTask ) noexcept;
+
+        //! Resume the flush suspended by a multi object dispatch barrier [see MultiObjectDispatch]
+        template<typename TObject>
+        static void ResumeSuspended( TObject& InObject, AODTLSContext& TLSContext ) noexcept;
+
+        //! The last reader left the object, continue as the consumer parked by Object::AcquireFromReaders()
+        template<typename TObject>
+        static void ResumeParkedConsumer( TObject& InObject ) noexcept;
+
+    private:
+        //! Allocate a new task for InFunctor and link it at the end of the local chain [InOutFirstTask ... InOutLastTask]
+        template<typename TObject, typename TFunctor>
+        SKL_FORCEINLINE SKL_NODISCARD static bool AppendBatchTask( TObject& InObject, typename TObject::TTaskBase*& InOutFirstTask, typename TObject::TTaskBase*& InOutLastTask, TFunctor&& InFunctor ) noexcept
+        {
+            using TaskType = typename TObject::template TTask<sizeof( TFunctor )>;
+
+            TaskType* NewTask{ AllocateAODTask<TaskType>() };
+            if( nullptr == NewTask ) SKL_UNLIKELY
+            {
+                return false;
+            }
+
+            NewTask->SetParent( &InObject );
+            NewTask->SetDispatch( std::forward<TFunctor>( InFunctor ) );
+            NewTask->Next = nullptr;
+
+            if( nullptr == InOutLastTask )
+            {
+                InOutFirstTask = NewTask;
+            }
+            else
+            {
+                InOutLastTask->Next = NewTask;
+            }
+
+            InOutLastTask = NewTask;
+
+            return true;
+        }
+
+        template<typename TObject>
+        SKL_NODISCARD static bool StartConsumer( TObject& InObject ) noexcept;
+
+        template<typename TObject>
+        SKL_NODISCARD static EFlushResult Flush( TObject& InObject, AODTLSContext* InTLSContext, bool bIsBounded, typename TObject::TTaskBase* InFirstTask ) noexcept;
+
+        template<typename TObject>
+        static void RunConsumer( TObject& InObject, AODTLSContext& TLSContext, typename TObject::TTaskBase* InFirstTask = nullptr ) noexcept;
+
+        template<typename TObject>
+        static void FlushOrHandOff( TObject& InObject, AODTLSContext& TLSContext, typename TObject::TTaskBase* InFirstTask ) noexcept;
+    };
 }
 
 //SharedObject
@@ -31,34 +430,45 @@ namespace SKL::AOD
 {
     struct SharedObject : public Object
     {
+        using TTaskBase = IAODSharedObjectTask;
+
+        template<size_t TaskSize>
+        using TTask = AODSharedObjectTask<TaskSize>;
+
         SharedObject( void* TargetSharedPointer ) noexcept : TargetSharedPointer { TargetSharedPointer ? TargetSharedPointer : this } {}
+
+        //! Construct for the InParent object, the flush budget hits are accounted to TObject [see Object::GetTypeFlushBudgetHitsCount()]
+        template<typename TObject>
+        SharedObject( TObject* InParent ) noexcept : SharedObject{ static_cast<void*>( InParent ) }
+        {
+            TrackFlushStatsAs<TObject>();
+        }
         ~SharedObject() noexcept = default;
 
         //! Execute the functor thread safe relative to the object [void( AOD::SharedObject& ) noexcept]
+        //! \returns ROverloaded if the max pending tasks count of the object was reached [see Object::SetMaxPendingTasks()]
         //! \returns RAllocationFailed if allocating the task object failed
         //! \returns RExecutedSync if the functor was dispatched sync (in this call)
         //! \returns RSuccess if the functor will be dispatched async
         template<typename TFunctor>
         SKL_FORCEINLINE SKL_NODISCARD RStatus DoAsync( TFunctor&& InFunctor ) noexcept
         {
-            using TaskType = AODSharedObjectTask<sizeof(TFunctor)>;
-            
-            TaskType* NewTask{ MakeSharedRaw<TaskType>() };
-            if( nullptr == NewTask ) SKL_UNLIKELY
-            {   
-                GLOG_DEBUG( "SharedObject::DoAsync() Failed to allocate task!" );
-                return RAllocationFailed;
-            }
+            return ObjectDispatch::DoAsync( *this, std::forward<TFunctor>( InFunctor ) );
+        }
 
-            NewTask->SetParent( this );
-            NewTask->SetDispatch( std::forward<TFunctor>( InFunctor ) );
+        //! Execute the functor concurrently with the other reads on this object, exclusive with and ordered relative to all the other tasks [void( const AOD::SharedObject& ) noexcept]
+        //! \remarks The read is executed in this call only if no task is pending on the object, otherwise it is queued like any other task, so the writers are never starved
+        //! \remarks The functor must not modify the object
+        //! \returns ROverloaded if the read had to be queued and the max pending tasks count of the object was reached [see Object::SetMaxPendingTasks()]
+        //! \returns RAllocationFailed if allocating the task object failed
+        //! \returns RExecutedSync if the functor was dispatched sync (in this call)
+        //! \returns RSuccess if the functor will be dispatched async
+        template<typename TFunctor>
+        SKL_FORCEINLINE SKL_NODISCARD RStatus DoAsyncRead( TFunctor&& InFunctor ) noexcept
+        {
+            static_assert( std::is_nothrow_invocable_v<TFunctor, const SharedObject&>, "SharedObject::DoAsyncRead() The functor must be [void( const AOD::SharedObject& ) noexcept]" );
 
-            if( Dispatch( NewTask ) )
-            {
-                return RExecutedSync;
-            }
-        
-            return RSuccess;
+            return ObjectDispatch::DoAsyncRead( *this, std::forward<TFunctor>( InFunctor ) );
         }
 
         //! Execute the functor after [AfterMilliseconds], thread safe relative to the object [void( AOD::SharedObject& ) noexcept]
@@ -68,10 +478,10 @@ namespace SKL::AOD
         SKL_FORCEINLINE SKL_NODISCARD RStatus DoAsyncAfter( TDuration AfterMilliseconds, TFunctor&& InFunctor ) noexcept
         {
             using TaskType = AODSharedObjectTask<sizeof(TFunctor)>;
-            
-            TaskType* NewTask{ MakeSharedRaw<TaskType>() };
+
+            TaskType* NewTask{ AllocateAODTask<TaskType>() };
             if( nullptr == NewTask ) SKL_UNLIKELY
-            {   
+            {
                 GLOG_DEBUG( "SharedObject::DoAsyncAfter() Failed to allocate task!" );
                 return RAllocationFailed;
             }
@@ -85,6 +495,20 @@ namespace SKL::AOD
             return RSuccess;
         }
 
+        //! Execute all the functors, in order, thread safe relative to the object [void( AOD::SharedObject& ) noexcept]
+        //! \remarks All tasks are published at once (one RemainingTasksCount increment and one queue splice) and are dispatched back to back
+        //! \returns ROverloaded if the max pending tasks count of the object would be exceeded (none of the functors is executed) [see Object::SetMaxPendingTasks()]
+        //! \returns RAllocationFailed if allocating any of the task objects failed (none of the functors is executed)
+        //! \returns RExecutedSync if the functors were dispatched sync (in this call)
+        //! \returns RSuccess if the functors will be dispatched async
+        template<typename... TFunctors>
+        SKL_FORCEINLINE SKL_NODISCARD RStatus DoAsyncBatch( TFunctors&&... InFunctors ) noexcept
+        {
+            static_assert( 0U < sizeof...( TFunctors ), "SharedObject::DoAsyncBatch() At least one functor is required" );
+
+            return ObjectDispatch::DoAsyncBatch( *this, std::forward<TFunctors>( InFunctors )... );
+        }
+
         //! Get the cached pointer to the parent instance
         void* GetParentObjectPointer() const noexcept { return TargetSharedPointer; }
 
@@ -92,15 +516,25 @@ namespace SKL::AOD
         template<typename T>
         SKL_FORCEINLINE SKL_NODISCARD T& GetParentObject() const noexcept { return *reinterpret_cast<T*>( TargetSharedPointer ); }
 
+        //! [Internal] Resume the flush handed off to this thread, InNextTask carries the consumer role of the object
+        SKL_FORCEINLINE void ResumeFlush( IAODSharedObjectTask* InNextTask ) noexcept { ObjectDispatch::ResumeFlush( *this, InNextTask ); }
+
+        //! Get the number of times a consumer exhausted its flush budget on a SharedObject and handed the rest of the flush to another worker
+        SKL_FORCEINLINE SKL_NODISCARD static uint64_t GetFlushBudgetHitsCount() noexcept { return FlushBudgetHitsCount.load_relaxed(); }
+
     private:
-        void Flush() noexcept;
-        bool Dispatch( IAODSharedObjectTask* InTask ) noexcept;
-        void DelayTask( IAODSharedObjectTask* InTask ) noexcept;
+        SKL_FORCEINLINE bool Dispatch( IAODSharedObjectTask* InTask ) noexcept { return ObjectDispatch::Dispatch( *this, InTask ); }
+        SKL_FORCEINLINE void DelayTask( IAODSharedObjectTask* InTask ) noexcept { ObjectDispatch::DelayTask( *this, InTask ); }
 
         void* TargetSharedPointer{ nullptr }; //!< Cached pointer to base the shared memory policy off of
 
+        static std::relaxed_value<uint64_t> FlushBudgetHitsCount; //!< Number of flushes handed off to another worker
+
         friend IAODSharedObjectTask;
         friend class WorkerGroup;
+        friend struct ObjectDispatch;
+        friend struct MultiObjectDispatch;
+        friend struct FutureDispatch;
     };
 }
 
@@ -109,33 +543,38 @@ namespace SKL::AOD
 {
     struct StaticObject : public Object
     {
+        using TTaskBase = IAODStaticObjectTask;
+
+        template<size_t TaskSize>
+        using TTask = AODStaticObjectTask<TaskSize>;
+
         StaticObject() noexcept = default;
         ~StaticObject() noexcept = default;
 
         //! Execute the functor thread safe relative to the object [void() noexcept]
+        //! \returns ROverloaded if the max pending tasks count of the object was reached [see Object::SetMaxPendingTasks()]
         //! \returns RAllocationFailed if allocating the task object failed
         //! \returns RExecutedSync if the functor was dispatched sync (in this call)
         //! \returns RSuccess if the functor will be dispatched async
         template<typename TFunctor>
         SKL_FORCEINLINE SKL_NODISCARD RStatus DoAsync( TFunctor&& InFunctor ) noexcept
         {
-            using TaskType = AODStaticObjectTask<sizeof(TFunctor)>;
-            
-            TaskType* NewTask{ MakeSharedRaw<TaskType>() };
-            if( nullptr == NewTask ) SKL_UNLIKELY
-            {   
-                GLOG_DEBUG( "StaticObject::DoAsync() Failed to allocate task!" );
-                return RAllocationFailed;
-            }
+            return ObjectDispatch::DoAsync( *this, std::forward<TFunctor>( InFunctor ) );
+        }
 
-            NewTask->SetDispatch( std::forward<TFunctor>( InFunctor ) );
+        //! Execute the functor concurrently with the other reads on this object, exclusive with and ordered relative to all the other tasks [void() noexcept]
+        //! \remarks The read is executed in this call only if no task is pending on the object, otherwise it is queued like any other task, so the writers are never starved
+        //! \remarks The functor must not modify the state guarded by the object
+        //! \returns ROverloaded if the read had to be queued and the max pending tasks count of the object was reached [see Object::SetMaxPendingTasks()]
+        //! \returns RAllocationFailed if allocating the task object failed
+        //! \returns RExecutedSync if the functor was dispatched sync (in this call)
+        //! \returns RSuccess if the functor will be dispatched async
+        template<typename TFunctor>
+        SKL_FORCEINLINE SKL_NODISCARD RStatus DoAsyncRead( TFunctor&& InFunctor ) noexcept
+        {
+            static_assert( std::is_nothrow_invocable_v<TFunctor>, "StaticObject::DoAsyncRead() The functor must be [void() noexcept]" );
 
-            if( Dispatch( NewTask ) )
-            {
-                return RExecutedSync;
-            }
-        
-            return RSuccess;
+            return ObjectDispatch::DoAsyncRead( *this, std::forward<TFunctor>( InFunctor ) );
         }
 
         //! Execute the functor after [AfterMilliseconds], thread safe relative to the object [void() noexcept]
@@ -145,10 +584,10 @@ namespace SKL::AOD
         SKL_FORCEINLINE SKL_NODISCARD RStatus DoAsyncAfter( TDuration AfterMilliseconds, TFunctor&& InFunctor ) noexcept
         {
             using TaskType = AODStaticObjectTask<sizeof(TFunctor)>;
-            
-            TaskType* NewTask{ MakeSharedRaw<TaskType>() };
+
+            TaskType* NewTask{ AllocateAODTask<TaskType>() };
             if( nullptr == NewTask ) SKL_UNLIKELY
-            {   
+            {
                 GLOG_DEBUG( "StaticObject::DoAsyncAfter() Failed to allocate task!" );
                 return RAllocationFailed;
             }
@@ -162,12 +601,34 @@ namespace SKL::AOD
             return RSuccess;
         }
 
+        //! Execute all the functors, in order, thread safe relative to the object [void() noexcept]
+        //! \remarks All tasks are published at once (one RemainingTasksCount increment and one queue splice) and are dispatched back to back
+        //! \returns ROverloaded if the max pending tasks count of the object would be exceeded (none of the functors is executed) [see Object::SetMaxPendingTasks()]
+        //! \returns RAllocationFailed if allocating any of the task objects failed (none of the functors is executed)
+        //! \returns RExecutedSync if the functors were dispatched sync (in this call)
+        //! \returns RSuccess if the functors will be dispatched async
+        template<typename... TFunctors>
+        SKL_FORCEINLINE SKL_NODISCARD RStatus DoAsyncBatch( TFunctors&&... InFunctors ) noexcept
+        {
+            static_assert( 0U < sizeof...( TFunctors ), "StaticObject::DoAsyncBatch() At least one functor is required" );
+
+            return ObjectDispatch::DoAsyncBatch( *this, std::forward<TFunctors>( InFunctors )... );
+        }
+
+        //! [Internal] Resume the flush handed off to this thread, InNextTask carries the consumer role of the object
+        SKL_FORCEINLINE void ResumeFlush( IAODStaticObjectTask* InNextTask ) noexcept { ObjectDispatch::ResumeFlush( *this, InNextTask ); }
+
+        //! Get the number of times a consumer exhausted its flush budget on a StaticObject and handed the rest of the flush to another worker
+        SKL_FORCEINLINE SKL_NODISCARD static uint64_t GetFlushBudgetHitsCount() noexcept { return FlushBudgetHitsCount.load_relaxed(); }
+
     private:
-        void Flush() noexcept;
-        bool Dispatch( IAODStaticObjectTask* InTask ) noexcept;
-        void DelayTask( IAODStaticObjectTask* InTask ) noexcept;
+        SKL_FORCEINLINE bool Dispatch( IAODStaticObjectTask* InTask ) noexcept { return ObjectDispatch::Dispatch( *this, InTask ); }
+        SKL_FORCEINLINE void DelayTask( IAODStaticObjectTask* InTask ) noexcept { ObjectDispatch::DelayTask( *this, InTask ); }
+
+        static std::relaxed_value<uint64_t> FlushBudgetHitsCount; //!< Number of flushes handed off to another worker
 
         friend class WorkerGroup;
+        friend struct ObjectDispatch;
     };
 }
 
@@ -179,34 +640,38 @@ namespace SKL::AOD
     // \remarks Expects that it is part of an shared object with virtual deleter
     struct CustomObject : public Object
     {
+        using TTaskBase = IAODCustomObjectTask;
+
+        template<size_t TaskSize>
+        using TTask = AODCustomObjectTask<TaskSize>;
+
         CustomObject() noexcept = default;
         ~CustomObject() noexcept = default;
-        
+
         //! Execute the functor thread safe relative to the object [void( AOD::CustomObject& ) noexcept]
+        //! \returns ROverloaded if the max pending tasks count of the object was reached [see Object::SetMaxPendingTasks()]
         //! \returns RAllocationFailed if allocating the task object failed
         //! \returns RExecutedSync if the functor was dispatched sync (in this call)
         //! \returns RSuccess if the functor will be dispatched async
         template<typename TFunctor>
         SKL_FORCEINLINE SKL_NODISCARD RStatus DoAsync( TFunctor&& InFunctor ) noexcept
         {
-            using TaskType = AODCustomObjectTask<sizeof(TFunctor)>;
-            
-            TaskType* NewTask{ MakeSharedRaw<TaskType>() };
-            if( nullptr == NewTask ) SKL_UNLIKELY
-            {   
-                GLOG_DEBUG( "CustomObject::DoAsync() Failed to allocate task!" );
-                return RAllocationFailed;
-            }
+            return ObjectDispatch::DoAsync( *this, std::forward<TFunctor>( InFunctor ) );
+        }
 
-            NewTask->SetParent( this );
-            NewTask->SetDispatch( std::forward<TFunctor>( InFunctor ) );
+        //! Execute the functor concurrently with the other reads on this object, exclusive with and ordered relative to all the other tasks [void( const AOD::CustomObject& ) noexcept]
+        //! \remarks The read is executed in this call only if no task is pending on the object, otherwise it is queued like any other task, so the writers are never starved
+        //! \remarks The functor must not modify the object
+        //! \returns ROverloaded if the read had to be queued and the max pending tasks count of the object was reached [see Object::SetMaxPendingTasks()]
+        //! \returns RAllocationFailed if allocating the task object failed
+        //! \returns RExecutedSync if the functor was dispatched sync (in this call)
+        //! \returns RSuccess if the functor will be dispatched async
+        template<typename TFunctor>
+        SKL_FORCEINLINE SKL_NODISCARD RStatus DoAsyncRead( TFunctor&& InFunctor ) noexcept
+        {
+            static_assert( std::is_nothrow_invocable_v<TFunctor, const CustomObject&>, "CustomObject::DoAsyncRead() The functor must be [void( const AOD::CustomObject& ) noexcept]" );
 
-            if( Dispatch( NewTask ) )
-            {
-                return RExecutedSync;
-            }
-        
-            return RSuccess;
+            return ObjectDispatch::DoAsyncRead( *this, std::forward<TFunctor>( InFunctor ) );
         }
 
         //! Execute the functor after [AfterMilliseconds], thread safe relative to the object [void( AOD::CustomObject& ) noexcept]
@@ -217,10 +682,10 @@ namespace SKL::AOD
         {
             GTRACE();
             using TaskType = AODCustomObjectTask<sizeof(TFunctor)>;
-            
-            TaskType* NewTask{ MakeSharedRaw<TaskType>() };
+
+            TaskType* NewTask{ AllocateAODTask<TaskType>() };
             if( nullptr == NewTask ) SKL_UNLIKELY
-            {   
+            {
                 GLOG_DEBUG( "CustomObject::DoAsyncAfter() Failed to allocate task!" );
                 return RAllocationFailed;
             }
@@ -233,27 +698,553 @@ namespace SKL::AOD
 
             return RSuccess;
         }
-        
+
+        //! Execute all the functors, in order, thread safe relative to the object [void( AOD::CustomObject& ) noexcept]
+        //! \remarks All tasks are published at once (one RemainingTasksCount increment and one queue splice) and are dispatched back to back
+        //! \returns ROverloaded if the max pending tasks count of the object would be exceeded (none of the functors is executed) [see Object::SetMaxPendingTasks()]
+        //! \returns RAllocationFailed if allocating any of the task objects failed (none of the functors is executed)
+        //! \returns RExecutedSync if the functors were dispatched sync (in this call)
+        //! \returns RSuccess if the functors will be dispatched async
+        template<typename... TFunctors>
+        SKL_FORCEINLINE SKL_NODISCARD RStatus DoAsyncBatch( TFunctors&&... InFunctors ) noexcept
+        {
+            static_assert( 0U < sizeof...( TFunctors ), "CustomObject::DoAsyncBatch() At least one functor is required" );
+
+            return ObjectDispatch::DoAsyncBatch( *this, std::forward<TFunctors>( InFunctors )... );
+        }
+
         //! [Internal] Dispatch the given task on this object thread-safe
-        SKL_NODISCARD bool Dispatch( IAODCustomObjectTask* InTask ) noexcept;
+        SKL_FORCEINLINE SKL_NODISCARD bool Dispatch( IAODCustomObjectTask* InTask ) noexcept { return ObjectDispatch::Dispatch( *this, InTask ); }
 
         //! [Internal] Delay the dispatch of the given task on this object thread-safe
-        void DelayTask( IAODCustomObjectTask* InTask ) noexcept;
+        SKL_FORCEINLINE void DelayTask( IAODCustomObjectTask* InTask ) noexcept { ObjectDispatch::DelayTask( *this, InTask ); }
+
+        //! [Internal] Resume the flush handed off to this thread, InNextTask carries the consumer role of the object
+        SKL_FORCEINLINE void ResumeFlush( IAODCustomObjectTask* InNextTask ) noexcept { ObjectDispatch::ResumeFlush( *this, InNextTask ); }
+
+        //! Get the number of times a consumer exhausted its flush budget on a CustomObject and handed the rest of the flush to another worker
+        SKL_FORCEINLINE SKL_NODISCARD static uint64_t GetFlushBudgetHitsCount() noexcept { return FlushBudgetHitsCount.load_relaxed(); }
 
     private:
-        void Flush() noexcept;
+        static std::relaxed_value<uint64_t> FlushBudgetHitsCount; //!< Number of flushes handed off to another worker
 
         friend IAODCustomObjectTask;
         friend class WorkerGroup;
+        friend struct ObjectDispatch;
+        friend struct MultiObjectDispatch;
+        friend struct FutureDispatch;
+    };
+
+    static_assert( sizeof( CustomObject ) == ( sizeof( void* ) * ( CAOD_EnableExtendedObjects ? 6U : 4U ) ) );
+}
+
+//MultiObjectDispatch
+namespace SKL::AOD
+{
+    //! Dispatch of a functor that needs exclusive access to multiple AOD objects at once
+    //! \remarks Each object is acquired by dispatching a barrier task on it, the barrier suspends the flush of its object (the consumer role is kept) and acquires the next object
+    //! \remarks The objects are always acquired in the same global order (by address), so concurrent multi object dispatches on overlapping objects can't deadlock
+    //! \remarks The last barrier executes the functor and resumes the flush of all the other (suspended) objects
+    //! \remarks Only SharedObject and CustomObject based objects, the StaticObject flush has no suspended state
+    struct MultiObjectDispatch
+    {
+        template<typename TObject>
+        using TTaskBase = typename TObject::TTaskBase;
+
+        template<typename TObject, size_t TaskSize>
+        using TTask = typename TObject::template TTask<TaskSize>;
+
+        //! Acquire all the objects in [InArgs] (all but the last element) and execute the functor (the last element) on them
+        template<typename TTuple, size_t... TIndices>
+        SKL_NODISCARD static RStatus Run( TTuple&& InArgs, std::index_sequence<TIndices...> ) noexcept
+        {
+            constexpr size_t CObjectsCount{ sizeof...( TIndices ) };
+
+            using TFirstObject = std::remove_cvref_t<std::tuple_element_t<0U, std::remove_cvref_t<TTuple>>>;
+            using TObject      = std::conditional_t<std::is_base_of_v<SharedObject, TFirstObject>, SharedObject, CustomObject>;
+            using TFunctor     = std::tuple_element_t<CObjectsCount, std::remove_cvref_t<TTuple>>;
+
+            static_assert( ( std::is_base_of_v<TObject, std::remove_cvref_t<std::tuple_element_t<TIndices, std::remove_cvref_t<TTuple>>>> && ... )
+                         , "AOD::DoAsyncOnAll() All objects must be AOD::SharedObject based or all must be AOD::CustomObject based [AOD::StaticObject is not supported]" );
+
+            // objects in the given order
+            const std::array<TObject*, CObjectsCount> Objects{ static_cast<TObject*>( &std::get<TIndices>( InArgs ) )... };
+
+            // objects in the acquisition order
+            std::array<TObject*, CObjectsCount> Ordered{ Objects };
+            std::sort( Ordered.begin(), Ordered.end(), std::less<TObject*>{} );
+            for( size_t i = 1U; i < CObjectsCount; ++i )
+            {
+                if( Ordered[i - 1U] == Ordered[i] ) SKL_UNLIKELY
+                {
+                    GLOG_DEBUG( "AOD::DoAsyncOnAll() The same object was given more than once!" );
+                    return RInvalidParamters;
+                }
+            }
+
+            // same limit as DoAsync(), each object gets one (barrier) task
+            for( TObject* Object : Ordered )
+            {
+                if( false == Object->CanQueueTasks() ) SKL_UNLIKELY
+                {
+                    return ROverloaded;
+                }
+            }
+
+            // the dispatch is identified on the calling thread to tell if the functor was executed in this call
+            AODTLSContext* CallerTLSContext{ AODTLSContext::GetInstance() };
+            const uint64_t DispatchSerial  { nullptr != CallerTLSContext ? ++CallerTLSContext->MultiObjectDispatchSerial : 0U };
+
+            std::array<TTaskBase<TObject>*, CObjectsCount> Tasks{};
+
+            // the last barrier executes the functor, all the other objects are suspended by then
+            Tasks[CObjectsCount - 1U] = AllocateBarrier( Ordered[CObjectsCount - 1U], 
+                [ Objects, CallerTLSContext, DispatchSerial, Functor = std::forward<TFunctor>( std::get<CObjectsCount>( InArgs ) ) ]( TObject& InObject ) mutable noexcept -> void
+            {
+                Functor( *Objects[TIndices]... );
+
+                auto* TLSContext{ AODTLSContext::GetInstance() };
+                SKL_ASSERT( nullptr != TLSContext );
+
+                if( CallerTLSContext == TLSContext )
+                {
+                    TLSContext->ExecutedMultiObjectDispatch = DispatchSerial;
+                }
+
+                for( TObject* Object : Objects )
+                {
+                    if( &InObject != Object )
+                    {
+                        ObjectDispatch::ResumeSuspended( *Object, *TLSContext );
+                    }
+                }
+            } );
+
+            // each barrier keeps its object suspended and acquires the next object
+            for( size_t i = CObjectsCount - 1U; 0U < i; --i )
+            {
+                Tasks[i - 1U] = AllocateBarrier( Ordered[i - 1U], [ NextObject = Ordered[i], NextTask = Tasks[i] ]( TObject& /*InObject*/ ) noexcept -> void
+                {
+                    ( void )NextObject->Dispatch( NextTask );
+                    SuspendCurrentFlush();
+                } );
+            }
+
+            if( std::find( Tasks.begin(), Tasks.end(), nullptr ) != Tasks.end() ) SKL_UNLIKELY
+            {
+                GLOG_DEBUG( "AOD::DoAsyncOnAll() Failed to allocate task!" );
+
+                for( auto* Task : Tasks )
+                {
+                    if( nullptr != Task )
+                    {
+                        ReleaseAODTask( Task );
+                    }
+                }
+
+                return RAllocationFailed;
+            }
+
+            // acquire the first object
+            ( void )Ordered[0U]->Dispatch( Tasks[0U] );
+
+            if( nullptr != CallerTLSContext && DispatchSerial == CallerTLSContext->ExecutedMultiObjectDispatch )
+            {
+                return RExecutedSync;
+            }
+
+            return RSuccess;
+        }
+
+    private:
+        template<typename TObject, typename TFunctor>
+        SKL_FORCEINLINE SKL_NODISCARD static TTaskBase<TObject>* AllocateBarrier( TObject* InObject, TFunctor&& InFunctor ) noexcept
+        {
+            using TaskType = TTask<TObject, sizeof( TFunctor )>;
+
+            TaskType* NewTask{ AllocateAODTask<TaskType>() };
+            if( nullptr == NewTask ) SKL_UNLIKELY
+            {
+                return nullptr;
+            }
+
+            NewTask->SetParent( InObject );
+            NewTask->SetDispatch( std::forward<TFunctor>( InFunctor ) );
+
+            return NewTask;
+        }
+
+        //! Signal the consumer of the current AOD object to suspend its flush right after the current (barrier) task
+        SKL_FORCEINLINE static void SuspendCurrentFlush() noexcept
+        {
+            auto* TLSContext{ AODTLSContext::GetInstance() };
+            SKL_ASSERT( nullptr != TLSContext );
+            SKL_ASSERT( false == TLSContext->Flags.bSuspendCurrentFlush );
+
+            TLSContext->Flags.bSuspendCurrentFlush = true;
+        }
+    };
+
+    //! Execute the functor thread safe relative to all the given objects at once [void( AOD::SharedObject&... ) noexcept or void( AOD::CustomObject&... ) noexcept]
+    //! \remarks Usage: AOD::DoAsyncOnAll( *PlayerA, *PlayerB, []( AOD::SharedObject& A, AOD::SharedObject& B ) noexcept -> void { ... } );
+    //! \remarks The objects are passed to the functor in the given order, all the objects must be SharedObject based or all must be CustomObject based
+    //! \remarks StaticObject based objects are not supported, their flush can't be suspended by a barrier and resumed later [see ObjectDispatch]
+    //! \returns ROverloaded if the max pending tasks count of any of the objects was reached (the functor is not executed) [see Object::SetMaxPendingTasks()]
+    //! \returns RAllocationFailed if allocating any of the task objects failed (the functor is not executed)
+    //! \returns RInvalidParamters if the same object was given more than once
+    //! \returns RExecutedSync if the functor was dispatched sync (in this call)
+    //! \returns RSuccess if the functor will be dispatched async
+    template<typename... TArgs>
+    SKL_FORCEINLINE SKL_NODISCARD RStatus DoAsyncOnAll( TArgs&&... InArgs ) noexcept
+    {
+        static_assert( 3U <= sizeof...( TArgs ), "AOD::DoAsyncOnAll( Objects..., Functor ) At least two objects and the functor are required" );
+
+        return MultiObjectDispatch::Run( std::forward_as_tuple( std::forward<TArgs>( InArgs )... ), std::make_index_sequence<sizeof...( TArgs ) - 1U>{} );
+    }
+}
+
+//Future
+namespace SKL::AOD
+{
+    template<typename TResult>
+    class Future;
+
+    //! Link of a future step to the next step in the chain
+    //! \remarks Lives in the functor of the step (in the step task), the next step task is allocated but not dispatched until the result is known
+    template<typename TResult>
+    struct FutureLink
+    {
+        using TResumeFunctionPtr  = void( SKL_CDECL* )( void*, TResult&& ) noexcept;
+        using TReleaseFunctionPtr = void( SKL_CDECL* )( void* ) noexcept;
+
+        FutureLink() noexcept = default;
+
+        //! The step task was destroyed without being dispatched [eg. dropped by Worker::Clear()], release the rest of the chain
+        ~FutureLink() noexcept
+        {
+            ReleaseChain();
+        }
+
+        FutureLink( FutureLink&& Other ) noexcept
+            : NextTask{ std::exchange( Other.NextTask, nullptr ) }
+            , ResumeNext{ Other.ResumeNext }
+            , ReleaseNext{ Other.ReleaseNext }
+        {}
+
+        // Can't copy or move assign, the next step is owned by one link only
+        FutureLink( const FutureLink& ) = delete;
+        FutureLink& operator=( const FutureLink& ) = delete;
+        FutureLink& operator=( FutureLink&& ) = delete;
+
+        //! Move the result into the next step and dispatch it [the result is discarded if there is no next step]
+        SKL_FORCEINLINE void Complete( TResult&& InResult ) noexcept
+        {
+            // the next step is owned by its object's queue from now on
+            void* Next{ std::exchange( NextTask, nullptr ) };
+            if( nullptr != Next )
+            {
+                ResumeNext( Next, std::move( InResult ) );
+            }
+        }
+
+        //! Release the (not dispatched) rest of the chain
+        SKL_FORCEINLINE void ReleaseChain() noexcept
+        {
+            if( nullptr != NextTask )
+            {
+                ReleaseNext( NextTask );
+                NextTask = nullptr;
+            }
+        }
+
+        void*               NextTask   { nullptr }; //!< Task of the next step [not dispatched yet]
+        TResumeFunctionPtr  ResumeNext { nullptr }; //!< Move the result into the next step and dispatch it
+        TReleaseFunctionPtr ReleaseNext{ nullptr }; //!< Release the next step and the rest of the chain
     };
 
-    static_assert( sizeof( CustomObject ) == ( sizeof( void* ) * 4 ) );
+    //! Placeholder for the missing input slot of the first step and for the missing link of the last step
+    struct FutureNone {};
+
+    //! Functor of one step in a future chain [TInput is void for the first step, TResult is void for the last step]
+    //! \remarks The result of the previous step is moved into Input, in this task's own allocation, right before this task is dispatched
+    template<typename TObject, typename TFunctor, typename TInput, typename TResult>
+    struct FutureStep
+    {
+        using TInputType  = TInput;
+        using TResultType = TResult;
+        using TInputSlot  = std::conditional_t<std::is_void_v<TInput>, FutureNone, std::optional<TInput>>;
+        using TLink       = std::conditional_t<std::is_void_v<TResult>, FutureNone, FutureLink<TResult>>;
+
+        void operator()( TObject& InObject ) noexcept
+        {
+            if constexpr( std::is_void_v<TInput> )
+            {
+                Link.Complete( Functor( InObject ) );
+            }
+            else if constexpr( std::is_void_v<TResult> )
+            {
+                SKL_ASSERT( true == Input.has_value() );
+                Functor( InObject, std::move( *Input ) );
+            }
+            else
+            {
+                SKL_ASSERT( true == Input.has_value() );
+                Link.Complete( Functor( InObject, std::move( *Input ) ) );
+            }
+        }
+
+        TFunctor   Functor; //!< User functor of this step
+        TInputSlot Input;   //!< Result of the previous step
+        TLink      Link;    //!< Link to the next step
+    };
+
+    //! Allocation, dispatch and release of future steps
+    struct FutureDispatch
+    {
+        template<typename TTarget>
+        using TObjectBase = std::conditional_t<std::is_base_of_v<SharedObject, TTarget>, SharedObject, CustomObject>;
+
+        template<typename TObject>
+        using TTaskBase = typename TObject::TTaskBase;
+
+        template<typename TObject, size_t TaskSize>
+        using TTask = typename TObject::template TTask<TaskSize>;
+
+        //! Allocate the first step of a future chain on InObject [see AOD::DoAsyncFuture()]
+        template<typename TTarget, typename TFunctor>
+        SKL_NODISCARD static auto Start( TTarget& InObject, TFunctor&& InFunctor ) noexcept
+        {
+            using TObject = TObjectBase<TTarget>;
+
+            static_assert( std::is_base_of_v<TObject, TTarget>, "AOD::DoAsyncFuture() The object must be AOD::SharedObject or AOD::CustomObject based" );
+            static_assert( std::is_nothrow_invocable_v<TFunctor, TObject&>, "AOD::DoAsyncFuture() The functor must be [TResult( TObject& ) noexcept]" );
+
+            using TResult = std::invoke_result_t<TFunctor, TObject&>;
+            using TStep   = FutureStep<TObject, std::remove_cvref_t<TFunctor>, void, TResult>;
+
+            static_assert( false == std::is_void_v<TResult>, "AOD::DoAsyncFuture() The functor must return a value, use DoAsync() instead" );
+            static_assert( false == std::is_reference_v<TResult>, "AOD::DoAsyncFuture() The functor must return by value" );
+
+            auto* NewTask{ AllocateStep( static_cast<TObject*>( &InObject ), TStep{ std::forward<TFunctor>( InFunctor ), {}, {} } ) };
+            if( nullptr == NewTask ) SKL_UNLIKELY
+            {
+                GLOG_DEBUG( "AOD::DoAsyncFuture() Failed to allocate task!" );
+                return Future<TResult>{};
+            }
+
+            return Future<TResult>{ static_cast<TTaskBase<TObject>*>( NewTask ), &DispatchStep<TObject>, &ReleaseStep<TObject, TStep>, &NewTask->template GetFunctor<TStep>().Link };
+        }
+
+        //! Allocate the task of a future step on InObject
+        template<typename TObject, typename TStep>
+        SKL_FORCEINLINE SKL_NODISCARD static TTask<TObject, sizeof( TStep )>* AllocateStep( TObject* InObject, TStep&& InStep ) noexcept
+        {
+            using TaskType = TTask<TObject, sizeof( TStep )>;
+
+            TaskType* NewTask{ AllocateAODTask<TaskType>() };
+            if( nullptr == NewTask ) SKL_UNLIKELY
+            {
+                return nullptr;
+            }
+
+            NewTask->SetParent( InObject );
+            NewTask->SetDispatch( std::forward<TStep>( InStep ) );
+
+            return NewTask;
+        }
+
+        //! Dispatch the (first step) task on its object
+        template<typename TObject>
+        static RStatus SKL_CDECL DispatchStep( void* InTask ) noexcept
+        {
+            auto* Task{ reinterpret_cast<TTaskBase<TObject>*>( InTask ) };
+
+            return Task->GetParent()->Dispatch( Task ) ? RExecutedSync : RSuccess;
+        }
+
+        //! Move the result of the previous step into the step task and dispatch it
+        template<typename TObject, typename TStep>
+        static void SKL_CDECL ResumeStep( void* InTask, typename TStep::TInputType&& InResult ) noexcept
+        {
+            auto* Task{ static_cast<TTask<TObject, sizeof( TStep )>*>( reinterpret_cast<TTaskBase<TObject>*>( InTask ) ) };
+            Task->template GetFunctor<TStep>().Input.emplace( std::move( InResult ) );
+
+            ( void )DispatchStep<TObject>( InTask );
+        }
+
+        //! Release the (not dispatched) step task and the rest of the chain
+        template<typename TObject, typename TStep>
+        static void SKL_CDECL ReleaseStep( void* InTask ) noexcept
+        {
+            auto* Task{ static_cast<TTask<TObject, sizeof( TStep )>*>( reinterpret_cast<TTaskBase<TObject>*>( InTask ) ) };
+
+            if constexpr( false == std::is_void_v<typename TStep::TResultType> )
+            {
+                Task->template GetFunctor<TStep>().Link.ReleaseChain();
+            }
+
+            ReleaseAODTask( static_cast<TTaskBase<TObject>*>( Task ) );
+        }
+    };
+
+    //! Future result of an AOD call, a not yet dispatched chain of steps, each step is executed thread safe relative to its own AOD object [see AOD::DoAsyncFuture()]
+    //! \remarks Each step lives in its own task, the result is moved into the task of the next step, so the chain costs no allocations beside the tasks
+    //! \remarks The chain is dispatched by Then() with a continuation returning void, by Dispatch() or when the future is destroyed (the last result is discarded)
+    template<typename TResult>
+    class Future
+    {
+    public:
+        using TDispatchFunctionPtr = RStatus( SKL_CDECL* )( void* ) noexcept;
+        using TReleaseFunctionPtr  = void( SKL_CDECL* )( void* ) noexcept;
+
+        Future() noexcept = default;
+        ~Future() noexcept
+        {
+            ( void )Dispatch();
+        }
+
+        Future( Future&& Other ) noexcept
+            : HeadTask{ Other.HeadTask }
+            , DispatchHead{ Other.DispatchHead }
+            , ReleaseHead{ Other.ReleaseHead }
+            , TailLink{ Other.TailLink }
+        {
+            Other.Invalidate();
+        }
+
+        // Can't copy or move assign
+        Future( const Future& ) = delete;
+        Future& operator=( const Future& ) = delete;
+        Future& operator=( Future&& ) = delete;
+
+        //! Is the chain allocated and not yet dispatched
+        SKL_FORCEINLINE SKL_NODISCARD bool IsValid() const noexcept { return nullptr != HeadTask; }
+
+        //! Chain the continuation, execute it thread safe relative to InTarget with the result of this step [TNext( TObject&, TResult&& ) noexcept]
+        //! \remarks Usage: AOD::DoAsyncFuture( *Player, []( AOD::SharedObject& ) noexcept -> int { ... } ).Then( *Guild, []( AOD::SharedObject&, int Result ) noexcept -> void { ... } );
+        //! \returns Future<TNext> of the continuation if the continuation returns a value [not valid if allocating the task failed, the whole chain is released]
+        //! \returns RAllocationFailed if the continuation returns void and allocating the task failed (the whole chain is released, nothing is executed)
+        //! \returns RExecutedSync if the continuation returns void and the first step was dispatched sync (in this call)
+        //! \returns RSuccess if the continuation returns void and the first step will be dispatched async
+        template<typename TTarget, typename TFunctor>
+        SKL_NODISCARD auto Then( TTarget& InTarget, TFunctor&& InFunctor ) noexcept
+        {
+            using TObject = FutureDispatch::TObjectBase<TTarget>;
+
+            static_assert( std::is_base_of_v<TObject, TTarget>, "Future::Then() The target must be AOD::SharedObject or AOD::CustomObject based" );
+            static_assert( std::is_nothrow_invocable_v<TFunctor, TObject&, TResult&&>, "Future::Then() The continuation must be [TNext( TObject&, TResult&& ) noexcept]" );
+
+            using TNext = std::invoke_result_t<TFunctor, TObject&, TResult&&>;
+            using TStep = FutureStep<TObject, std::remove_cvref_t<TFunctor>, TResult, TNext>;
+
+            static_assert( false == std::is_reference_v<TNext>, "Future::Then() The continuation must return by value" );
+
+            FutureDispatch::TTask<TObject, sizeof( TStep )>* NewTask{ nullptr };
+            if( true == IsValid() ) SKL_LIKELY
+            {
+                NewTask = FutureDispatch::AllocateStep( static_cast<TObject*>( &InTarget ), TStep{ std::forward<TFunctor>( InFunctor ), {}, {} } );
+            }
+
+            if( nullptr == NewTask ) SKL_UNLIKELY
+            {
+                GLOG_DEBUG( "Future::Then() Failed to allocate task!" );
+                Release();
+
+                if constexpr( std::is_void_v<TNext> )
+                {
+                    return RAllocationFailed;
+                }
+                else
+                {
+                    return Future<TNext>{};
+                }
+            }
+
+            TailLink->NextTask    = static_cast<FutureDispatch::TTaskBase<TObject>*>( NewTask );
+            TailLink->ResumeNext  = &FutureDispatch::ResumeStep<TObject, TStep>;
+            TailLink->ReleaseNext = &FutureDispatch::ReleaseStep<TObject, TStep>;
+
+            if constexpr( std::is_void_v<TNext> )
+            {
+                return Dispatch();
+            }
+            else
+            {
+                Future<TNext> Result{ HeadTask, DispatchHead, ReleaseHead, &NewTask->template GetFunctor<TStep>().Link };
+                Invalidate();
+
+                return Result;
+            }
+        }
+
+        //! Dispatch the chain, the result of the last step is discarded
+        //! \returns RFail if the future is not valid (failed allocation or already dispatched)
+        //! \returns RExecutedSync if the first step was dispatched sync (in this call)
+        //! \returns RSuccess if the first step will be dispatched async
+        RStatus Dispatch() noexcept
+        {
+            if( false == IsValid() )
+            {
+                return RFail;
+            }
+
+            void*                HeadTaskCopy    { HeadTask };
+            TDispatchFunctionPtr DispatchHeadCopy{ DispatchHead };
+            Invalidate();
+
+            return DispatchHeadCopy( HeadTaskCopy );
+        }
+
+        //! Release the chain without dispatching it
+        void Release() noexcept
+        {
+            if( true == IsValid() )
+            {
+                ReleaseHead( HeadTask );
+                Invalidate();
+            }
+        }
+
+    private:
+        Future( void* InHeadTask, TDispatchFunctionPtr InDispatchHead, TReleaseFunctionPtr InReleaseHead, FutureLink<TResult>* InTailLink ) noexcept
+            : HeadTask{ InHeadTask }
+            , DispatchHead{ InDispatchHead }
+            , ReleaseHead{ InReleaseHead }
+            , TailLink{ InTailLink }
+        {}
+
+        SKL_FORCEINLINE void Invalidate() noexcept
+        {
+            HeadTask     = nullptr;
+            DispatchHead = nullptr;
+            ReleaseHead  = nullptr;
+            TailLink     = nullptr;
+        }
+
+        void*                HeadTask    { nullptr }; //!< Task of the first step in the chain
+        TDispatchFunctionPtr DispatchHead{ nullptr }; //!< Dispatch the first step on its object
+        TReleaseFunctionPtr  ReleaseHead { nullptr }; //!< Release the whole chain
+        FutureLink<TResult>* TailLink    { nullptr }; //!< Link of the last step in the chain, the next continuation is attached here
+
+        template<typename TOtherResult>
+        friend class Future;
+        friend struct FutureDispatch;
+    };
+
+    //! Execute the functor thread safe relative to the object and get the future result [TResult( AOD::SharedObject& ) noexcept or TResult( AOD::CustomObject& ) noexcept]
+    //! \remarks Nothing is dispatched until the chain is completed [see Future::Then()], dispatched or the future is destroyed
+    //! \returns Future<TResult> [not valid if allocating the task failed]
+    template<typename TTarget, typename TFunctor>
+    SKL_FORCEINLINE SKL_NODISCARD auto DoAsyncFuture( TTarget& InObject, TFunctor&& InFunctor ) noexcept
+    {
+        return FutureDispatch::Start( InObject, std::forward<TFunctor>( InFunctor ) );
+    }
 }
 
 namespace SKL
 {
     SKL_FORCEINLINE SKL_NODISCARD inline bool DoAsyncHasFailed( RStatus Result ) noexcept
     {
-        return Result == RAllocationFailed;
+        return Result == RAllocationFailed || Result == ROverloaded;
     }
 }
\ No newline at end of file
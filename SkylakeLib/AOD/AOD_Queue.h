@@ -32,6 +32,16 @@ namespace SKL
             PrevNode->Next = InTask;
         }
 
+        //! Multiple producers push of a pre-linked chain of tasks [InFirst ... InLast] (one splice for the whole chain)
+        SKL_FORCEINLINE void PushChain( IAODTaskBase* InFirst, IAODTaskBase* InLast ) noexcept
+        {
+            SKL_ASSERT( nullptr != InFirst );
+            SKL_ASSERT( nullptr != InLast );
+            SKL_ASSERT( nullptr == InLast->Next );
+            auto* PrevNode{ std::atomic_exchange_explicit( &Head, InLast, std::memory_order_acq_rel ) };
+            PrevNode->Next = InFirst;
+        }
+
         //! Is the pointer pointing to the stub 
         SKL_FORCEINLINE bool IsStub( void* InPtr ) const noexcept { return InPtr == &Stub; }
 
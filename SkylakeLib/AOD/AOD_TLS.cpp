@@ -42,21 +42,29 @@ namespace SKL
         
         while( false == DelayedSharedObjectTasks.empty() )
         {
-            TSharedPtr<IAODSharedObjectTask>::Static_Reset( DelayedSharedObjectTasks.top() );
+            ReleaseAODTask( DelayedSharedObjectTasks.top() );
             DelayedSharedObjectTasks.pop();
         }
         
         while( false == DelayedCustomObjectTasks.empty() )
         {
-            TSharedPtr<IAODCustomObjectTask>::Static_Reset( DelayedCustomObjectTasks.top() );
+            ReleaseAODTask( DelayedCustomObjectTasks.top() );
             DelayedCustomObjectTasks.pop();
         }
 
         while( false == DelayedStaticObjectTasks.empty() )
         {
-            TSharedPtr<IAODStaticObjectTask>::Static_Reset( DelayedStaticObjectTasks.top() );
+            ReleaseAODTask( DelayedStaticObjectTasks.top() );
             DelayedStaticObjectTasks.pop();
         }
+
+        if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHaveTLSMemoryManagement )
+        {
+            if( nullptr != ThreadLocalMemoryManager::GetInstance() )
+            {
+                ( void )ThreadLocalMemoryManager::ReclaimRemoteFreed();
+            }
+        }
     }
 
     void AODTLSContext::Reset() noexcept
@@ -71,7 +79,7 @@ namespace SKL
 
         //Cache for fast, thread local, access
         ServerFlags.Flags              = SourceServerInstance->ServerBuiltFlags.Flags;
-        DeferredAODTasksHandlingGroups = SourceServerInstance->DeferredTasksHandlingGroups;
+        DeferredAODTasksHandlingGroups = SourceServerInstance->DeferredAODTasksHandlingGroups;
     }
 }
 #endif
@@ -23,6 +23,7 @@ namespace SKL
                 uint8_t bIsAnyStaticDispatchInProgress : 1;
                 uint8_t bIsAnySharedDispatchInProgress : 1;
                 uint8_t bIsAnyCustomDispatchInProgress : 1;
+                uint8_t bSuspendCurrentFlush : 1;
             };
             uint16_t Flags = { 0 };
         };
@@ -58,6 +59,81 @@ namespace SKL
         ServerInstanceFlags                 ServerFlags                   {};          //!< ServerInstanceFlags cached
         WorkerGroupTag                      ParentWorkerGroup             {};          //!< Cached tag of this thread's parent worker group
         std::vector<WorkerGroup*>           DeferredAODTasksHandlingGroups{};          //!< Cached list of working groups that can handle deferred AOD tasks
+        uint32_t                            TaskAllocationsCount          { 0 };       //!< Number of tasks allocated by this thread [used to reclaim the remote freed tasks periodically]
+        uint64_t                            MultiObjectDispatchSerial     { 0 };       //!< Serial of the last multi object dispatch issued by this thread [see AOD::DoAsyncOnAll()]
+        uint64_t                            ExecutedMultiObjectDispatch   { 0 };       //!< Serial of the last multi object dispatch, issued by this thread, that was executed on this thread
+        uint32_t                            WorkerAffinityId              { 0 };       //!< Affinity id of this thread's worker [0 if this thread is not an AOD handling worker, see Worker::GetAffinityId()]
         char                                NameBuffer[512]               { 0 };       //!< Name buffer
     };
+}
+
+namespace SKL
+{
+    //! Allocate new AOD task
+    //! \remarks If CTaskScheduling_AssumeAllWorkerGroupsHaveTLSMemoryManagement the task is allocated from the ThreadLocalMemoryManager
+    //! \remarks Threads without an AODTLSContext or a ThreadLocalMemoryManager [non worker threads] allocate the task from the global memory manager
+    template<typename TTask>
+    SKL_FORCEINLINE SKL_NODISCARD TTask* AllocateAODTask() noexcept
+    {
+        if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHaveTLSMemoryManagement )
+        {
+            auto* TLSContext{ AODTLSContext::GetInstance() };
+            if( nullptr != TLSContext && nullptr != ThreadLocalMemoryManager::GetInstance() ) SKL_LIKELY
+            {
+                if( 0U == ( ++TLSContext->TaskAllocationsCount & ( CAOD_RemoteFreeReclaimInterval - 1U ) ) )
+                {
+                    ( void )ThreadLocalMemoryManager::ReclaimRemoteFreed();
+                }
+
+                // allocate from the thread local memory manager (fast)
+                TTask* NewTask{ TLSMakeSharedRaw<TTask>() };
+                if( nullptr != NewTask ) SKL_LIKELY
+                {
+                    NewTask->SetOwner( ThreadLocalMemoryManager::GetOwnerTag() );
+                }
+
+                return NewTask;
+            }
+        }
+
+        // allocate from the global memory manager
+        return MakeSharedRaw<TTask>();
+    }
+
+    //! Release one reference to the AOD task, if last reference, the task is destroyed and the memory returned to the pool it was allocated from
+    template<typename TTask>
+    SKL_FORCEINLINE void ReleaseAODTask( TTask* InTask ) noexcept
+    {
+        SKL_ASSERT( nullptr != InTask );
+
+        if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHaveTLSMemoryManagement )
+        {
+            // the owner must be read before the task is destroyed [nullptr = allocated from the global memory manager]
+            ThreadLocalRemoteFreeList* Owner{ InTask->GetOwner() };
+            if( nullptr != Owner ) SKL_LIKELY
+            {
+                void* Block{ MemoryPolicy::SharedMemoryPolicy<false>::DestroyForObject<TTask, true, false>( InTask ) };
+                if( nullptr != Block )
+                {
+                    const auto* CBlock{ reinterpret_cast<const MemoryPolicy::ControlBlock*>( Block ) };
+                    ThreadLocalMemoryManager::DeallocateFromAnyThread( Owner, Block, static_cast<size_t>( CBlock->BlockSize ) );
+                }
+                return;
+            }
+        }
+
+        TSharedPtr<TTask>::Static_Reset( InTask );
+    }
+
+    //! Release all the tasks of a (not yet dispatched) chain of AOD tasks linked through IAODTaskBase::Next
+    template<typename TTask>
+    SKL_FORCEINLINE void ReleaseAODTaskChain( TTask* InFirstTask ) noexcept
+    {
+        while( nullptr != InFirstTask )
+        {
+            TTask* NextTask{ reinterpret_cast<TTask*>( InFirstTask->Next ) };
+            ReleaseAODTask( InFirstTask );
+            InFirstTask = NextTask;
+        }
+    }
 }
\ No newline at end of file
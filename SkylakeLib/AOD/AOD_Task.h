@@ -65,6 +65,12 @@ namespace SKL
         //! Get parent AOD Object ptr
         SKL_FORCEINLINE SKL_NODISCARD AOD::SharedObject* GetParent() const noexcept { return Parent.get(); }
 
+        //! Set the remote free list of the thread that allocated this task
+        SKL_FORCEINLINE void SetOwner( ThreadLocalRemoteFreeList* InOwner ) noexcept { Owner = InOwner; }
+
+        //! Get the remote free list of the thread that allocated this task
+        SKL_FORCEINLINE SKL_NODISCARD ThreadLocalRemoteFreeList* GetOwner() const noexcept { return Owner; }
+
         //! Set due time
         SKL_FORCEINLINE void SetDue( TDuration AfterMilliseconds ) noexcept
         {
@@ -100,6 +106,7 @@ namespace SKL
 
         TSharedPtr<AOD::SharedObject> Parent{ nullptr }; //!< Parent object ref, the AOD object, this task will be dispatched on
         TEpochTimePoint               Due   { 0 };       //!< Used for when this task is delayed
+        ThreadLocalRemoteFreeList*    Owner { nullptr }; //!< Remote free list of the allocating thread [only for thread local allocated tasks]
 
         friend struct AODTaskQueue;
     };
@@ -128,6 +135,15 @@ namespace SKL
             OnDispatch += std::forward<TFunctor>( InFunctor );
         }
 
+        //! Get the functor of this task [TFunctor must be the exact type of the functor given to SetDispatch()]
+        template<typename TFunctor>
+        SKL_FORCEINLINE SKL_NODISCARD TFunctor& GetFunctor() noexcept
+        {
+            static_assert( sizeof( TFunctor ) <= TaskSize );
+            SKL_ASSERT( false == IsNull() );
+            return *reinterpret_cast<TFunctor*>( OnDispatch.GetBody() );
+        }
+
     private:
         TDispatch OnDispatch; //!< The functor to dispatch for this task
     };
@@ -181,6 +197,12 @@ namespace SKL
         //! Get parent AOD Object ptr
         SKL_FORCEINLINE SKL_NODISCARD AOD::StaticObject* GetParent() const noexcept { return Parent; }
 
+        //! Set the remote free list of the thread that allocated this task
+        SKL_FORCEINLINE void SetOwner( ThreadLocalRemoteFreeList* InOwner ) noexcept { Owner = InOwner; }
+
+        //! Get the remote free list of the thread that allocated this task
+        SKL_FORCEINLINE SKL_NODISCARD ThreadLocalRemoteFreeList* GetOwner() const noexcept { return Owner; }
+
         //! Set due time
         SKL_FORCEINLINE void SetDue( TDuration AfterMilliseconds ) noexcept
         {
@@ -214,8 +236,9 @@ namespace SKL
             );
         }
 
-        AOD::StaticObject* Parent{ nullptr }; //!< Parent object ptr, the AOD object, this task will be dispatched on
-        TEpochTimePoint    Due   { 0 };       //!< Used for when this task is delayed
+        AOD::StaticObject*         Parent{ nullptr }; //!< Parent object ptr, the AOD object, this task will be dispatched on
+        TEpochTimePoint            Due   { 0 };       //!< Used for when this task is delayed
+        ThreadLocalRemoteFreeList* Owner { nullptr }; //!< Remote free list of the allocating thread [only for thread local allocated tasks]
 
         friend struct AODTaskQueue;
     };
@@ -302,6 +325,12 @@ namespace SKL
         //! Get parent AOD Object ptr
         SKL_FORCEINLINE SKL_NODISCARD AOD::CustomObject* GetParent() const noexcept { return Parent.get(); }
 
+        //! Set the remote free list of the thread that allocated this task
+        SKL_FORCEINLINE void SetOwner( ThreadLocalRemoteFreeList* InOwner ) noexcept { Owner = InOwner; }
+
+        //! Get the remote free list of the thread that allocated this task
+        SKL_FORCEINLINE SKL_NODISCARD ThreadLocalRemoteFreeList* GetOwner() const noexcept { return Owner; }
+
         //! Set due time
         SKL_FORCEINLINE void SetDue( TDuration AfterMilliseconds ) noexcept
         {
@@ -335,8 +364,9 @@ namespace SKL
             );
         }
 
-        TCustomObjectSharedPtr Parent{ nullptr }; //!< Parent object ref, the AOD object, this task will be dispatched on
-        TEpochTimePoint        Due   { 0 };       //!< Used for when this task is delayed
+        TCustomObjectSharedPtr     Parent{ nullptr }; //!< Parent object ref, the AOD object, this task will be dispatched on
+        TEpochTimePoint            Due   { 0 };       //!< Used for when this task is delayed
+        ThreadLocalRemoteFreeList* Owner { nullptr }; //!< Remote free list of the allocating thread [only for thread local allocated tasks]
 
         friend struct AODTaskQueue;
     };
@@ -365,6 +395,15 @@ namespace SKL
             OnDispatch += std::forward<TFunctor>( InFunctor );
         }
 
+        //! Get the functor of this task [TFunctor must be the exact type of the functor given to SetDispatch()]
+        template<typename TFunctor>
+        SKL_FORCEINLINE SKL_NODISCARD TFunctor& GetFunctor() noexcept
+        {
+            static_assert( sizeof( TFunctor ) <= TaskSize );
+            SKL_ASSERT( false == IsNull() );
+            return *reinterpret_cast<TFunctor*>( OnDispatch.GetBody() );
+        }
+
     private:
         TDispatch OnDispatch; //!< The functor to dispatch for this task
     };
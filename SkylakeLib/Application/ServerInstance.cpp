@@ -304,6 +304,42 @@ namespace SKL
             ThreadLocalMemoryManager::Preallocate();
         }
 
+        if( nullptr == FrameArena::GetInstance() )
+        {
+            if( RSuccess != FrameArena::Create() )
+            {
+                GLOG_ERROR( "[Worker in WG:%ws] Failed to create FrameArena", InGroup.GetTag().Name );
+                return false;
+            }
+        }
+
+        if( nullptr == DeferredReleaseBatch::GetInstance() )
+        {
+            if( RSuccess != DeferredReleaseBatch::Create() )
+            {
+                GLOG_ERROR( "[Worker in WG:%ws] Failed to create DeferredReleaseBatch", InGroup.GetTag().Name );
+                return false;
+            }
+        }
+
+        if( nullptr == EpochReclamation::GetInstance() )
+        {
+            if( RSuccess != EpochReclamation::Create() )
+            {
+                GLOG_ERROR( "[Worker in WG:%ws] Failed to create EpochReclamation", InGroup.GetTag().Name );
+                return false;
+            }
+        }
+
+        if( nullptr == AsyncNetSendFlusher::GetInstance() )
+        {
+            if( RSuccess != AsyncNetSendFlusher::Create() )
+            {
+                GLOG_ERROR( "[Worker in WG:%ws] Failed to create AsyncNetSendFlusher", InGroup.GetTag().Name );
+                return false;
+            }
+        }
+
         if( RSuccess != ServerInstanceTLSContext::Create( this, InGroup.GetTag() ) )
         {
             GLOG_ERROR("[WorkerGroup:%ws] failed to create ServerInstanceTLSContext for worker!", InGroup.GetTag().Name );
@@ -321,6 +357,11 @@ namespace SKL
 
         if( true == InGroup.GetTag().bSupportsAOD )
         {
+            if( true == InGroup.GetTag().bIsActive )
+            {
+                // Only active workers handle deferred AOD tasks, AOD objects consumed by this worker learn it as their preferred worker
+                AODTLSContext::GetInstance()->WorkerAffinityId = InWorker.GetAffinityId();
+            }
         }
 
         for( auto& Service : WorkerServices )
@@ -347,6 +388,18 @@ namespace SKL
             Service->OnWorkerStopped( InWorker, InGroup );
         }
 
+        // Send the packets queued in the last tick [flushed on destruction]
+        AsyncNetSendFlusher::Destroy();
+        GLOG_INFO( "[Worker in WG:%ws] OnWorkerStopped() Destroyed AsyncNetSendFlusher.", InGroup.GetTag().Name );
+
+        // Release the shared references deferred in the last tick [flushed on destruction]
+        DeferredReleaseBatch::Destroy();
+        GLOG_INFO( "[Worker in WG:%ws] OnWorkerStopped() Destroyed DeferredReleaseBatch.", InGroup.GetTag().Name );
+
+        // The objects retired by this worker and not freed yet are handed to the remaining workers
+        EpochReclamation::Destroy();
+        GLOG_INFO( "[Worker in WG:%ws] OnWorkerStopped() Destroyed EpochReclamation.", InGroup.GetTag().Name );
+
         if( true == InGroup.GetTag().bSupportsAOD )
         {
         }
@@ -357,6 +410,9 @@ namespace SKL
         ServerInstanceTLSContext::Destroy();
         GLOG_INFO( "[Worker in WG:%ws] OnWorkerStopped() Destroyed ServerInstanceTLSContext.", InGroup.GetTag().Name );
 
+        FrameArena::Destroy();
+        GLOG_INFO( "[Worker in WG:%ws] OnWorkerStopped() Destroyed FrameArena.", InGroup.GetTag().Name );
+
         ThreadLocalMemoryManager::FreeAllPools();
         ThreadLocalMemoryManager::Destroy();
         GLOG_INFO( "[Worker in WG:%ws] OnWorkerStopped() Destroyed ThreadLocalMemoryManager.", InGroup.GetTag().Name );
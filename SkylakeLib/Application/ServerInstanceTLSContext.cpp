@@ -41,18 +41,7 @@ namespace SKL
 
         while( false == DelayedTasks.empty() )
         {
-            if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHandleTimerTasks 
-                       && CTaskScheduling_AssumeAllWorkerGroupsHaveTLSMemoryManagement )
-            {
-                // allocated from the thread local memory manager
-                TLSSharedPtr<ITask>::Static_Reset( DelayedTasks.top() );
-            }
-            else
-            {
-                // allocated from the global memory manager
-                TSharedPtr<ITask>::Static_Reset( DelayedTasks.top() );
-            }
-
+            ReleaseDeferredTask( DelayedTasks.top() );
             DelayedTasks.pop();
         }
     }
@@ -64,18 +53,7 @@ namespace SKL
 
         while( false == DelayedTasks.empty() )
         {
-            if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHandleTimerTasks 
-                       && CTaskScheduling_AssumeAllWorkerGroupsHaveTLSMemoryManagement )
-            {
-                // allocated from the thread local memory manager
-                TLSSharedPtr<ITask>::Static_Reset( DelayedTasks.top() );
-            }
-            else
-            {
-                // allocated from the global memory manager
-                TSharedPtr<ITask>::Static_Reset( DelayedTasks.top() );
-            }
-
+            ReleaseDeferredTask( DelayedTasks.top() );
             DelayedTasks.pop();
         }
 
@@ -212,6 +212,20 @@ namespace SKL
             ( void )++GetInstance()->WorkerEnqueueCounters[WorkerIndex].AODCustomObjectDelayedTasksQueue_EnqueuedCount;
         }
 
+        // Tasks rejected (ROverloaded) by AOD objects at their max pending tasks count, counted on the producer thread [if it has a KPIContext]
+        SKL_FORCEINLINE static void Increment_AODObjectOverloadsCount() noexcept
+        {
+            auto* Instance{ GetInstance() };
+            if( nullptr != Instance )
+            {
+                ( void )++Instance->AODObjectOverloadsCount;
+            }
+        }
+        SKL_FORCEINLINE SKL_NODISCARD static uint64_t Static_GetAODObjectOverloadsCount() noexcept
+        {
+            return GetInstance()->AODObjectOverloadsCount;
+        }
+
         SKL_FORCEINLINE static void Decrement_DelayedTasksQueueSize( uint64_t Count = 1 ) noexcept
         {
             GetInstance()->WorkerDequeueCounters.DelayedTasksQueue_DequeuedCount += Count;
@@ -243,6 +257,7 @@ namespace SKL
             }
 
             Instance->WorkerDequeueCounters.Reset();
+            Instance->AODObjectOverloadsCount = 0U;
         }
         #endif
     private:
@@ -253,6 +268,7 @@ namespace SKL
         #if defined(SKL_KPI_QUEUE_SIZES)
         KPI_WorkerEnqueueCounters WorkerEnqueueCounters[CMaxEnqueueCouneters]{};
         KPI_WorkerDequeueCounters WorkerDequeueCounters{};
+        uint64_t                  AODObjectOverloadsCount{ 0U };
         #endif
     };
 }
\ No newline at end of file
@@ -0,0 +1,336 @@
+//!
+//! \file AllocationSiteProfiler.h
+//!
+//! \brief Sampling profiler of the memory managers allocation call sites
+//!
+//! \author Balan Narcis (balannarcis96@gmail.com)
+//!
+#pragma once
+
+namespace SKL
+{
+    //! Allocation statistics of one (call site, block size) pair [see AllocationSiteProfiler]
+    struct AllocationSiteStatistics
+    {
+        const void* Site                 { nullptr }; //!< Return address of the call site [nullptr if tagged]
+        const char* Tag                  { nullptr }; //!< Compile time tag of the call site [nullptr if not tagged]
+        size_t      BlockSize            { 0U };      //!< Size of the memory blocks served to the site [the size class]
+        uint64_t    SampledAllocations   { 0U };      //!< Number of sampled allocations
+        uint64_t    SampledDeallocations { 0U };      //!< Number of sampled allocations that were deallocated
+        uint64_t    SampledRequestedBytes{ 0U };      //!< Bytes requested by the sampled allocations
+        int64_t     SampledLiveBytes     { 0 };       //!< Bytes of the sampled blocks still alive
+
+        //! Get the estimated number of allocations made by the site
+        SKL_FORCEINLINE SKL_NODISCARD uint64_t GetEstimatedAllocations() const noexcept { return SampledAllocations * CMemoryManager_SiteProfilerSampleRate; }
+
+        //! Get the estimated number of bytes allocated by the site and still alive
+        SKL_FORCEINLINE SKL_NODISCARD int64_t GetEstimatedLiveBytes() const noexcept { return SampledLiveBytes * static_cast<int64_t>( CMemoryManager_SiteProfilerSampleRate ); }
+    };
+
+    //! Sampled memory block tracked by the AllocationSiteProfiler until deallocated
+    struct AllocationSiteLiveSample
+    {
+        void*    Block    { nullptr };                                //!< Sampled block
+        uint32_t SiteIndex{ std::numeric_limits<uint32_t>::max() };  //!< Index of the site that allocated the block
+        uint32_t BlockSize{ 0U };                                     //!< Size of the block
+    };
+
+    //! Sampling profiler of the allocation call sites, answers "who allocates what and how much of it is still alive"
+    //! \remarks Opt-in, the memory managers only call it when SKL_MEMORY_SITE_PROFILER is defined
+    //! \remarks Each thread samples one in CMemoryManager_SiteProfilerSampleRate allocations, an allocation that is not sampled costs one thread local decrement
+    //! \remarks A site is the compile time tag of the innermost AllocationSiteScope of the allocating thread, or the return address of the first non inlined frame that allocated
+    //! \remarks The samples are aggregated per (site, served block size) pair, the report scales them back by the sample rate
+    class AllocationSiteProfiler final
+    {
+    public:
+        static constexpr uint32_t SampleRate     = CMemoryManager_SiteProfilerSampleRate;
+        static constexpr size_t   MaxSites       = CMemoryManager_SiteProfilerMaxSites;
+        static constexpr size_t   MaxLiveSamples = CMemoryManager_SiteProfilerMaxLiveSamples;
+        static constexpr uint32_t InvalidSite    = std::numeric_limits<uint32_t>::max();
+
+        using SiteStatistics = AllocationSiteStatistics;
+
+        //! Called by the memory managers for each allocation
+        SKL_FORCEINLINE static void OnAllocation( const void* InReturnAddress, void* InBlock, size_t InRequestedSize, size_t InBlockSize ) noexcept
+        {
+            if( 0U != --SampleCountdown ) SKL_LIKELY
+            {
+                return;
+            }
+            SampleCountdown = SampleRate;
+
+            if( nullptr != InBlock ) SKL_LIKELY
+            {
+                RecordAllocation( nullptr != CurrentTag ? nullptr : InReturnAddress, CurrentTag, InBlock, InRequestedSize, InBlockSize );
+            }
+        }
+
+        //! Called by the memory managers for each deallocation
+        SKL_FORCEINLINE static void OnDeallocation( void* InBlock ) noexcept
+        {
+            // cheap filter, only the blocks that may be sampled take the lock
+            if( 0U == LiveFilter[GetLiveSlot( InBlock )].load( std::memory_order_relaxed ) ) SKL_LIKELY
+            {
+                return;
+            }
+
+            RecordDeallocation( InBlock );
+        }
+
+        //! Log the top CMemoryManager_SiteProfilerReportTopSites sites by estimated live bytes
+        static void LogReport() noexcept
+        {
+            std::vector<SiteStatistics> Snapshot{ GetSnapshot() };
+            std::sort( Snapshot.begin(), Snapshot.end(), []( const SiteStatistics& InA, const SiteStatistics& InB ) noexcept -> bool
+            {
+                return InA.SampledLiveBytes != InB.SampledLiveBytes ? InA.SampledLiveBytes > InB.SampledLiveBytes : InA.SampledAllocations > InB.SampledAllocations;
+            } );
+
+            const double ElapsedSeconds{ std::max( 0.001, static_cast<double>( GetSystemUpTickCount() - StartedAt.load( std::memory_order_relaxed ) ) / 1000.0 ) };
+
+            GLOG_INFO( "[AllocationSiteProfiler] Report (1 in %u allocations sampled, %.1fs, %llu sites, %llu dropped samples) ###############################"
+                     , SampleRate
+                     , ElapsedSeconds
+                     , static_cast<unsigned long long>( Snapshot.size() )
+                     , static_cast<unsigned long long>( DroppedSamples.load( std::memory_order_relaxed ) ) );
+
+            const size_t Count{ std::min( Snapshot.size(), CMemoryManager_SiteProfilerReportTopSites ) };
+            for( size_t i = 0; i < Count; ++i )
+            {
+                const SiteStatistics& Stats{ Snapshot[i] };
+                if( nullptr != Stats.Tag )
+                {
+                    GLOG_INFO( "[AllocationSiteProfiler] %-48s Block:%7llu bytes LiveBytes:~%lld Allocations:~%llu (~%.0f/s) AvgRequested:%llu bytes"
+                             , Stats.Tag
+                             , static_cast<unsigned long long>( Stats.BlockSize )
+                             , static_cast<long long>( Stats.GetEstimatedLiveBytes() )
+                             , static_cast<unsigned long long>( Stats.GetEstimatedAllocations() )
+                             , static_cast<double>( Stats.GetEstimatedAllocations() ) / ElapsedSeconds
+                             , static_cast<unsigned long long>( Stats.SampledRequestedBytes / std::max<uint64_t>( 1U, Stats.SampledAllocations ) ) );
+                }
+                else
+                {
+                    GLOG_INFO( "[AllocationSiteProfiler] 0x%016llX                               Block:%7llu bytes LiveBytes:~%lld Allocations:~%llu (~%.0f/s) AvgRequested:%llu bytes"
+                             , static_cast<unsigned long long>( reinterpret_cast<uintptr_t>( Stats.Site ) )
+                             , static_cast<unsigned long long>( Stats.BlockSize )
+                             , static_cast<long long>( Stats.GetEstimatedLiveBytes() )
+                             , static_cast<unsigned long long>( Stats.GetEstimatedAllocations() )
+                             , static_cast<double>( Stats.GetEstimatedAllocations() ) / ElapsedSeconds
+                             , static_cast<unsigned long long>( Stats.SampledRequestedBytes / std::max<uint64_t>( 1U, Stats.SampledAllocations ) ) );
+                }
+            }
+        }
+
+        //! Get a copy of the statistics of all the sites
+        SKL_NODISCARD static std::vector<SiteStatistics> GetSnapshot() noexcept
+        {
+            std::vector<SiteStatistics> Result;
+            Result.reserve( SitesCount.load( std::memory_order_relaxed ) );
+
+            SpinLockScopeGuard Guard{ Lock };
+            for( size_t i = 0; i < MaxSites; ++i )
+            {
+                if( 0U != Sites[i].BlockSize )
+                {
+                    Result.push_back( Sites[i] );
+                }
+            }
+
+            return Result;
+        }
+
+        //! Forget all the sites and all the sampled blocks
+        static void Reset() noexcept
+        {
+            SpinLockScopeGuard Guard{ Lock };
+
+            for( size_t i = 0; i < MaxSites; ++i )
+            {
+                Sites[i] = SiteStatistics{};
+            }
+            for( size_t i = 0; i < MaxLiveSamples; ++i )
+            {
+                LiveSamples[i] = LiveSample{};
+                LiveFilter[i].store( 0U, std::memory_order_relaxed );
+            }
+
+            SitesCount.store( 0U, std::memory_order_relaxed );
+            DroppedSamples.store( 0U, std::memory_order_relaxed );
+            StartedAt.store( GetSystemUpTickCount(), std::memory_order_relaxed );
+        }
+
+    private:
+        using LiveSample = AllocationSiteLiveSample;
+
+        SKL_FORCEINLINE SKL_NODISCARD static size_t GetLiveSlot( const void* InBlock ) noexcept
+        {
+            // the blocks are at least 8 bytes aligned, mix the upper bits in
+            const uint64_t Value{ static_cast<uint64_t>( reinterpret_cast<uintptr_t>( InBlock ) >> 3U ) * 0x9E3779B97F4A7C15ULL };
+            return static_cast<size_t>( Value >> 32U ) & ( MaxLiveSamples - 1U );
+        }
+
+        SKL_FORCEINLINE SKL_NODISCARD static size_t GetSiteSlot( const void* InSite, const char* InTag, size_t InBlockSize ) noexcept
+        {
+            const uint64_t Key{ reinterpret_cast<uintptr_t>( InSite ) ^ reinterpret_cast<uintptr_t>( InTag ) ^ ( static_cast<uint64_t>( InBlockSize ) << 40U ) };
+            return static_cast<size_t>( ( Key * 0x9E3779B97F4A7C15ULL ) >> 32U ) % MaxSites;
+        }
+
+        //! Find or add the site [must be called under Lock]
+        SKL_NODISCARD static uint32_t FindOrAddSite( const void* InSite, const char* InTag, size_t InBlockSize ) noexcept
+        {
+            size_t Slot{ GetSiteSlot( InSite, InTag, InBlockSize ) };
+            for( size_t i = 0; i < MaxSites; ++i )
+            {
+                SiteStatistics& Entry{ Sites[Slot] };
+                if( 0U == Entry.BlockSize )
+                {
+                    Entry.Site      = InSite;
+                    Entry.Tag       = InTag;
+                    Entry.BlockSize = InBlockSize;
+                    ( void )SitesCount.fetch_add( 1U, std::memory_order_relaxed );
+                    return static_cast<uint32_t>( Slot );
+                }
+
+                if( InSite == Entry.Site && InTag == Entry.Tag && InBlockSize == Entry.BlockSize )
+                {
+                    return static_cast<uint32_t>( Slot );
+                }
+
+                Slot = ( Slot + 1U ) % MaxSites;
+            }
+
+            return InvalidSite;
+        }
+
+        SKL_NOINLINE static void RecordAllocation( const void* InSite, const char* InTag, void* InBlock, size_t InRequestedSize, size_t InBlockSize ) noexcept
+        {
+            SpinLockScopeGuard Guard{ Lock };
+
+            if( 0U == StartedAt.load( std::memory_order_relaxed ) ) SKL_UNLIKELY
+            {
+                StartedAt.store( GetSystemUpTickCount(), std::memory_order_relaxed );
+            }
+
+            const uint32_t SiteIndex{ FindOrAddSite( InSite, InTag, InBlockSize ) };
+            if( InvalidSite == SiteIndex ) SKL_UNLIKELY
+            {
+                ( void )DroppedSamples.fetch_add( 1U, std::memory_order_relaxed );
+                return;
+            }
+
+            SiteStatistics& Entry{ Sites[SiteIndex] };
+            ++Entry.SampledAllocations;
+            Entry.SampledRequestedBytes += static_cast<uint64_t>( InRequestedSize );
+
+            // track the block until deallocated, the live bytes are only counted for the tracked blocks
+            const size_t HomeSlot{ GetLiveSlot( InBlock ) };
+            for( size_t i = 0; i < MaxLiveSamples; ++i )
+            {
+                LiveSample& Sample{ LiveSamples[( HomeSlot + i ) & ( MaxLiveSamples - 1U )] };
+                if( nullptr == Sample.Block )
+                {
+                    Sample.Block     = InBlock;
+                    Sample.SiteIndex = SiteIndex;
+                    Sample.BlockSize = static_cast<uint32_t>( std::min<size_t>( InBlockSize, std::numeric_limits<uint32_t>::max() ) );
+
+                    Entry.SampledLiveBytes += static_cast<int64_t>( Sample.BlockSize );
+                    ( void )LiveFilter[HomeSlot].fetch_add( 1U, std::memory_order_relaxed );
+                    return;
+                }
+            }
+
+            ( void )DroppedSamples.fetch_add( 1U, std::memory_order_relaxed );
+        }
+
+        SKL_NOINLINE static void RecordDeallocation( void* InBlock ) noexcept
+        {
+            SpinLockScopeGuard Guard{ Lock };
+
+            const size_t HomeSlot{ GetLiveSlot( InBlock ) };
+            for( size_t i = 0; i < MaxLiveSamples; ++i )
+            {
+                const size_t Slot{ ( HomeSlot + i ) & ( MaxLiveSamples - 1U ) };
+                LiveSample&  Sample{ LiveSamples[Slot] };
+                if( nullptr == Sample.Block )
+                {
+                    // filter false positive
+                    return;
+                }
+
+                if( InBlock == Sample.Block )
+                {
+                    SiteStatistics& Entry{ Sites[Sample.SiteIndex] };
+                    ++Entry.SampledDeallocations;
+                    Entry.SampledLiveBytes -= static_cast<int64_t>( Sample.BlockSize );
+
+                    ( void )LiveFilter[HomeSlot].fetch_sub( 1U, std::memory_order_relaxed );
+                    RemoveLiveSample( Slot );
+                    return;
+                }
+            }
+        }
+
+        //! Backward shift deletion, keeps the linear probing chains intact without tombstones [must be called under Lock]
+        static void RemoveLiveSample( size_t InSlot ) noexcept
+        {
+            size_t Hole{ InSlot };
+            size_t Next{ ( InSlot + 1U ) & ( MaxLiveSamples - 1U ) };
+
+            while( nullptr != LiveSamples[Next].Block )
+            {
+                const size_t Home    { GetLiveSlot( LiveSamples[Next].Block ) };
+                const size_t Distance{ ( Next - Home ) & ( MaxLiveSamples - 1U ) };
+                const size_t ToHole  { ( Next - Hole ) & ( MaxLiveSamples - 1U ) };
+                if( Distance >= ToHole )
+                {
+                    LiveSamples[Hole] = LiveSamples[Next];
+                    Hole              = Next;
+                }
+
+                Next = ( Next + 1U ) & ( MaxLiveSamples - 1U );
+            }
+
+            LiveSamples[Hole] = LiveSample{};
+        }
+
+        static inline thread_local uint32_t    SampleCountdown{ SampleRate }; //!< Allocations left until the next sample on this thread
+        static inline thread_local const char* CurrentTag     { nullptr };    //!< Tag of the innermost AllocationSiteScope of this thread
+
+        SKL_CACHE_ALIGNED static inline SpinLock              Lock          {};
+        SKL_CACHE_ALIGNED static inline std::atomic<size_t>   SitesCount    { 0U };
+        static inline std::atomic<uint64_t>                   DroppedSamples{ 0U };
+        static inline std::atomic<TEpochTimePoint>            StartedAt     { 0U };
+        static inline SiteStatistics                          Sites         [MaxSites]{};
+        static inline LiveSample                              LiveSamples   [MaxLiveSamples]{};
+        SKL_CACHE_ALIGNED static inline std::atomic<uint16_t> LiveFilter    [MaxLiveSamples]{}; //!< Number of live samples whose home slot is each slot
+
+        friend struct AllocationSiteScope;
+    };
+
+    //! Tag all the allocations made by the calling thread, while the scope is alive, as made by the InTag site
+    //! \remarks InTag must be a string literal (compared by address)
+    struct AllocationSiteScope
+    {
+        SKL_FORCEINLINE explicit AllocationSiteScope( const char* InTag ) noexcept
+            : PreviousTag{ AllocationSiteProfiler::CurrentTag }
+        {
+            AllocationSiteProfiler::CurrentTag = InTag;
+        }
+        SKL_FORCEINLINE ~AllocationSiteScope() noexcept
+        {
+            AllocationSiteProfiler::CurrentTag = PreviousTag;
+        }
+
+        // Can't copy or move
+        AllocationSiteScope( const AllocationSiteScope& ) = delete;
+        AllocationSiteScope& operator=( const AllocationSiteScope& ) = delete;
+        AllocationSiteScope( AllocationSiteScope&& ) = delete;
+        AllocationSiteScope& operator=( AllocationSiteScope&& ) = delete;
+
+    private:
+        const char* PreviousTag;
+    };
+}
+
+//! Tag the allocations made in the current scope [no-op if SKL_MEMORY_SITE_PROFILER is not defined]
+#define SKL_ALLOCATION_SITE_SCOPE( InTag ) SKL_IFMEMORYSITEPROFILER( SKL::AllocationSiteScope CONCAT( __AllocationSiteScope, __LINE__ ){ InTag } )
@@ -117,6 +117,23 @@ namespace SKL
         static_assert( false == std::is_array_v<TObject>, "Please use MakeSharedArray()" ); 
         return { MakeSharedRaw<TObject, true>( std::forward<TArgs>( Args )... ) };
     }
+
+    //! Allocate new shared object (raw ptr) that can be weak referenced through the MemoryManager [see TWeakPtr]
+    template<typename TObject, typename ...TArgs>
+    SKL_NODISCARD TObject* MakeSharedWeakableRaw( TArgs... Args ) noexcept 
+    {
+        static_assert( false == std::is_array_v<TObject>, "Weak references to shared arrays are not supported!" ); 
+        static_assert( 0 == SKL_GUARD_ALLOC_SIZE_ON || sizeof( TObject ) < CMemoryManager_MaxAllocSize, "Cannot alloc this much memory at once!" );
+        using Allocator = typename SKL::MemoryStrategy::WeakSharedMemoryStrategy<TObject>::Allocator;
+        return Allocator::template AllocateObject<true, false>( std::forward<TArgs>( Args )... );
+    }
+
+    //! Allocate new shared object that can be weak referenced through the MemoryManager [see TWeakPtr]
+    template<typename TObject, typename ...TArgs>
+    SKL_FORCEINLINE SKL_NODISCARD TWeakableSharedPtr<TObject> MakeSharedWeakable( TArgs... Args ) noexcept 
+    {
+        return { MakeSharedWeakableRaw<TObject>( std::forward<TArgs>( Args )... ) };
+    }
     
     //! 
     //! Allocate new shared object through the MemoryManager
@@ -199,6 +216,21 @@ namespace SKL
         static_assert( false == std::is_array_v<TObject>, "Please use TLSMakeSharedArrayRaw()" ); 
         return { TLSMakeSharedRaw<TObject, true>( std::forward<TArgs>( Args )... ) };
     }
+
+    //! 
+    //! Allocate new thread confined shared object through the ThreadLocalMemoryManager
+    //! 
+    //! \remark the reference count is not atomic, the object must not leave the current thread, use TLocalSharedPtr::ToShared() to pass it to other threads
+    //! 
+    //! \remark the owner tag of the calling thread is stored along the object, the last reference can be released on any thread
+    //! 
+    template<typename TObject, typename ...TArgs>
+    SKL_FORCEINLINE SKL_NODISCARD TLocalSharedPtr<TObject> TLSMakeLocalShared( TArgs... Args ) noexcept 
+    {
+        static_assert( false == std::is_array_v<TObject>, "Thread confined shared arrays are not supported!" ); 
+        using Allocator = typename SKL::TLSMemoryStrategy::LocalSharedMemoryStrategy<TObject>::Allocator;
+        return TLocalSharedPtr<TObject>{ Allocator::template AllocateObject<true, false>( std::forward<TArgs>( Args )... ) };
+    }
     
     //! 
     //! Allocate new shared object through the ThreadLocalMemoryManager
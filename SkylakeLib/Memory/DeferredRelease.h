@@ -0,0 +1,194 @@
+//!
+//! \file DeferredRelease.h
+//!
+//! \brief Batched shared reference counting for fan-out (one object shared by many targets, eg. broadcast buffers)
+//!
+//! \author Balan Narcis (balannarcis96@gmail.com)
+//!
+#pragma once
+
+namespace SKL
+{
+    //! Hands out InCount references to one shared object, all of them added with a single atomic operation
+    //! \remarks Use instead of copying the TSharedPtr once per target, the shared control block is touched once for the whole fan-out
+    //! \remarks The references not handed out are released (in one batch) on destruction
+    //! \remarks Not thread safe
+    template<typename TSharedPtrType>
+    struct TSharedPtrFanOut
+    {
+        using TObjectDecay = typename TSharedPtrType::TObjectDecay;
+
+        TSharedPtrFanOut( const TSharedPtrType& InSource, uint32_t InCount ) noexcept
+            : Pointer{ InSource.get() }
+            , Remaining{ nullptr == Pointer ? 0U : InCount }
+        {
+            if( 0U != Remaining ) SKL_LIKELY
+            {
+                TSharedPtrType::Static_AddReferences( Pointer, Remaining );
+            }
+        }
+        ~TSharedPtrFanOut() noexcept
+        {
+            if( 0U != Remaining )
+            {
+                TSharedPtrType::Static_ResetMultiple( Pointer, Remaining );
+            }
+        }
+
+        // Can't copy or move
+        TSharedPtrFanOut( const TSharedPtrFanOut& ) = delete;
+        TSharedPtrFanOut& operator=( const TSharedPtrFanOut& ) = delete;
+        TSharedPtrFanOut( TSharedPtrFanOut&& ) = delete;
+        TSharedPtrFanOut& operator=( TSharedPtrFanOut&& ) = delete;
+
+        //! Take one of the pre-added references as a shared pointer
+        SKL_FORCEINLINE SKL_NODISCARD TSharedPtrType Next() noexcept
+        {
+            return { NextRaw() };
+        }
+
+        //! Take one of the pre-added references as a raw pointer [the reference must be released by the caller eg. through DeferredReleaseBatch::ReleaseRaw()]
+        SKL_FORCEINLINE SKL_NODISCARD TObjectDecay* NextRaw() noexcept
+        {
+            SKL_ASSERT( 0U != Remaining );
+            --Remaining;
+            return Pointer;
+        }
+
+        //! Get the number of references not handed out yet
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t GetRemaining() const noexcept { return Remaining; }
+
+    private:
+        TObjectDecay* Pointer;   //!< The shared object
+        uint32_t      Remaining; //!< Number of pre-added references not handed out yet
+    };
+
+    //! Per worker thread batch of deferred shared reference releases
+    //! \remarks The references released on a worker are counted per object and released at the end of the tick with one atomic operation per object
+    //! \remarks Flushed by the active workers at the end of each tick and by the reactive workers after each handled batch of tasks
+    //! \remarks On threads without an instance the references are released immediately
+    struct DeferredReleaseBatch final : public ITLSSingleton<DeferredReleaseBatch>
+    {
+        ~DeferredReleaseBatch() noexcept
+        {
+            Flush();
+        }
+
+        const char *GetName() const noexcept override
+        {
+            return "[DeferredReleaseBatch]";
+        }
+
+        //! Defer the release of the reference held by InPtr [InPtr is reset]
+        template<typename TSharedPtrType>
+        SKL_FORCEINLINE static void Release( TSharedPtrType& InPtr ) noexcept
+        {
+            auto* Raw{ InPtr.ReleaseRawRef() };
+            if( nullptr != Raw ) SKL_LIKELY
+            {
+                ReleaseRaw<TSharedPtrType>( Raw );
+            }
+        }
+
+        //! Defer the release of one reference to InPtr
+        //! \invariant InPtr must be a valid pointer allocated using the same MemoryPolicy as TSharedPtrType
+        template<typename TSharedPtrType>
+        static void ReleaseRaw( typename TSharedPtrType::TObjectDecay* InPtr ) noexcept
+        {
+            SKL_ASSERT( nullptr != InPtr );
+
+            auto* Instance{ DeferredReleaseBatch::GetInstance() };
+            if( nullptr == Instance || true == Instance->bIsFlushing ) SKL_UNLIKELY
+            {
+                TSharedPtrType::Static_Reset( InPtr );
+                return;
+            }
+
+            Instance->Add( InPtr, &ReleaseReferences<TSharedPtrType> );
+        }
+
+        //! Release all the deferred references
+        void Flush() noexcept
+        {
+            // releases triggered by the destructors during the flush are done immediately
+            bIsFlushing = true;
+
+            for( size_t i = 0; i < UsedCount; ++i )
+            {
+                Entry& Slot{ Entries[ UsedIndices[ i ] ] };
+                Slot.ReleaseFunction( Slot.Pointer, Slot.Count );
+                Slot = Entry{};
+            }
+
+            UsedCount   = 0U;
+            bIsFlushing = false;
+        }
+
+        //! Get the number of distinct objects with deferred releases
+        SKL_FORCEINLINE SKL_NODISCARD size_t GetPendingObjectsCount() const noexcept { return UsedCount; }
+
+    private:
+        using TReleaseFunction = void( * )( void*, uint32_t ) noexcept;
+
+        struct Entry
+        {
+            void*            Pointer        { nullptr };
+            TReleaseFunction ReleaseFunction{ nullptr };
+            uint32_t         Count          { 0U };
+        };
+
+        static_assert( 0U == ( CDeferredRelease_MaxObjects & ( CDeferredRelease_MaxObjects - 1U ) ), "CDeferredRelease_MaxObjects must be a power of two" );
+        static_assert( CDeferredRelease_MaxObjects <= 65536U, "CDeferredRelease_MaxObjects must fit the uint16_t slot indices" );
+        static constexpr size_t CMaxUsedEntries = CDeferredRelease_MaxObjects / 2U;
+
+        template<typename TSharedPtrType>
+        static void ReleaseReferences( void* InPtr, uint32_t InCount ) noexcept
+        {
+            TSharedPtrType::Static_ResetMultiple( reinterpret_cast<typename TSharedPtrType::TObjectDecay*>( InPtr ), InCount );
+        }
+
+        SKL_FORCEINLINE SKL_NODISCARD static size_t GetSlotIndex( void* InPtr ) noexcept
+        {
+            // fibonacci hashing of the pointer [low bits are always zero due to alignment]
+            return static_cast<size_t>( ( static_cast<uint64_t>( reinterpret_cast<uintptr_t>( InPtr ) >> 4U ) * 11400714819323198485ULL ) >> 32U ) & ( CDeferredRelease_MaxObjects - 1U );
+        }
+
+        void Add( void* InPtr, TReleaseFunction InReleaseFunction ) noexcept
+        {
+            // linear probing, the table is kept at most half full
+            size_t Index{ GetSlotIndex( InPtr ) };
+            while( true )
+            {
+                Entry& Slot{ Entries[ Index ] };
+                if( InPtr == Slot.Pointer ) SKL_LIKELY
+                {
+                    SKL_ASSERT( InReleaseFunction == Slot.ReleaseFunction );
+                    ++Slot.Count;
+                    return;
+                }
+
+                if( nullptr == Slot.Pointer )
+                {
+                    break;
+                }
+
+                Index = ( Index + 1U ) & ( CDeferredRelease_MaxObjects - 1U );
+            }
+
+            if( CMaxUsedEntries == UsedCount ) SKL_UNLIKELY
+            {
+                Flush();
+                Index = GetSlotIndex( InPtr );
+            }
+
+            Entries[ Index ]         = Entry{ InPtr, InReleaseFunction, 1U };
+            UsedIndices[ UsedCount ] = static_cast<uint16_t>( Index );
+            ++UsedCount;
+        }
+
+        Entry    Entries[ CDeferredRelease_MaxObjects ];     //!< Open addressing table, one entry per object
+        uint16_t UsedIndices[ CMaxUsedEntries ];             //!< Indices of the used entries [to flush without scanning the table]
+        size_t   UsedCount  { 0U };                          //!< Number of used entries
+        bool     bIsFlushing{ false };                       //!< Is the batch being flushed
+    };
+}
@@ -0,0 +1,180 @@
+//!
+//! \file EpochReclamation.h
+//!
+//! \brief Epoch based reclamation of the objects removed from lock-free structures, driven by the worker tick
+//!
+//! \author Balan Narcis (balannarcis96@gmail.com)
+//!
+#pragma once
+
+namespace SKL
+{
+    //! Epoch announced by one participant thread
+    struct alignas( SKL_CACHE_LINE_SIZE ) EpochParticipant
+    {
+        static constexpr uint64_t COffline = 0U; //!< The participant holds no references and doesn't hold back the reclamation
+
+        std::atomic<uint64_t> LocalEpoch{ COffline }; //!< Global epoch observed at the last quiescent point
+        int32_t               bIsInUse  { FALSE };    //!< Is the slot used by a thread [guarded by the registry lock]
+    };
+
+    //! Object retired from a lock-free structure, waiting for all the participants to pass a later epoch
+    struct RetiredObject
+    {
+        using TDeleter = void( * )( void* ) noexcept;
+
+        void*    Object { nullptr }; //!< The retired object
+        TDeleter Deleter{ nullptr }; //!< Function used to free the object
+        uint64_t Epoch  { 0U };      //!< Global epoch when the object was retired
+    };
+
+    //! Per thread participant in the epoch based reclamation
+    //! \remarks The readers don't use any atomics, each participant announces a quiescent state [no references held] once per tick
+    //! \remarks The global epoch advances when all the online participants observed it, a retired object is freed after the global epoch advanced twice [every participant passed a quiescent point after the retire]
+    //! \remarks The workers announce the quiescent state at the end of each tick, the reactive workers go offline while blocked waiting for work
+    //! \remarks Only the threads with an instance can read the structures protected by the epochs
+    struct EpochReclamation final : public ITLSSingleton<EpochReclamation>
+    {
+        using TDeleter = RetiredObject::TDeleter;
+
+        ~EpochReclamation() noexcept;
+
+        RStatus Initialize() noexcept override;
+
+        const char *GetName() const noexcept override
+        {
+            return "[EpochReclamation]";
+        }
+
+        //! Retire InObject, InDeleter is called after all the participants passed a later epoch
+        //! \remarks InObject must already be unreachable for the new readers
+        //! \remarks On threads without an instance the object is queued globally and freed by the participants
+        static void RetireObject( void* InObject, TDeleter InDeleter ) noexcept
+        {
+            SKL_ASSERT( nullptr != InObject );
+            SKL_ASSERT( nullptr != InDeleter );
+
+            // the unlink of the object must be visible before the epoch is read
+            std::atomic_thread_fence( std::memory_order_seq_cst );
+            const uint64_t Epoch{ GlobalEpoch.load( std::memory_order_acquire ) };
+
+            auto* Instance{ GetInstance() };
+            if( nullptr == Instance ) SKL_UNLIKELY
+            {
+                RetireOrphan( RetiredObject{ InObject, InDeleter, Epoch } );
+                return;
+            }
+
+            Instance->Retired.push_back( RetiredObject{ InObject, InDeleter, Epoch } );
+        }
+
+        //! Announce that the calling thread holds no references to objects protected by the epochs
+        //! \remarks Tries to advance the global epoch and frees the retired objects that are safe to free
+        void Quiescent() noexcept
+        {
+            const uint64_t Epoch{ GlobalEpoch.load( std::memory_order_acquire ) };
+            Participant->LocalEpoch.store( Epoch, std::memory_order_seq_cst );
+
+            const uint64_t SafeEpoch{ TryAdvance( Epoch ) ? Epoch + 1U : Epoch };
+
+            if( false == Retired.empty() )
+            {
+                ( void )ReclaimRetired( SafeEpoch );
+            }
+
+            if( 0U != OrphansCount.load( std::memory_order_relaxed ) ) SKL_UNLIKELY
+            {
+                ( void )ReclaimOrphans( SafeEpoch );
+            }
+        }
+
+        //! The calling thread will block and holds no references, it doesn't hold back the reclamation until GoOnline() is called
+        SKL_FORCEINLINE void GoOffline() noexcept
+        {
+            Participant->LocalEpoch.store( EpochParticipant::COffline, std::memory_order_release );
+        }
+
+        //! The calling thread can read objects protected by the epochs again
+        SKL_FORCEINLINE void GoOnline() noexcept
+        {
+            Participant->LocalEpoch.store( GlobalEpoch.load( std::memory_order_acquire ), std::memory_order_seq_cst );
+            std::atomic_thread_fence( std::memory_order_seq_cst );
+        }
+
+        //! Bring the calling thread online if it has an instance
+        SKL_FORCEINLINE static void Static_GoOnline() noexcept
+        {
+            if( auto* Instance{ GetInstance() }; nullptr != Instance ) SKL_LIKELY
+            {
+                Instance->GoOnline();
+            }
+        }
+
+        //! Get the number of objects retired by this thread and not freed yet
+        SKL_FORCEINLINE SKL_NODISCARD size_t GetPendingObjectsCount() const noexcept { return Retired.size(); }
+
+        //! Get the current global epoch
+        SKL_FORCEINLINE SKL_NODISCARD static uint64_t GetGlobalEpoch() noexcept { return GlobalEpoch.load( std::memory_order_acquire ); }
+
+        //! Free all the retired objects regardless of the epochs
+        //! \remarks Call only when no thread can hold references anymore [eg. after all the workers stopped]
+        //! \returns the number of freed objects
+        static size_t FreeAllRetiredObjects() noexcept;
+
+    private:
+        //! Advance the global epoch if all the online participants observed InEpoch
+        //! \returns true if the global epoch is past InEpoch
+        static bool TryAdvance( uint64_t InEpoch ) noexcept
+        {
+            const uint32_t Count{ ParticipantsCount.load( std::memory_order_acquire ) };
+            for( uint32_t i = 0; i < Count; ++i )
+            {
+                const uint64_t LocalEpoch{ Participants[i].LocalEpoch.load( std::memory_order_seq_cst ) };
+                if( EpochParticipant::COffline != LocalEpoch && InEpoch != LocalEpoch )
+                {
+                    return false;
+                }
+            }
+
+            uint64_t Expected{ InEpoch };
+            return GlobalEpoch.compare_exchange_strong( Expected, InEpoch + 1U, std::memory_order_seq_cst ) || Expected > InEpoch;
+        }
+
+        //! Free the objects retired by this thread at least two epochs before InGlobalEpoch
+        size_t ReclaimRetired( uint64_t InGlobalEpoch ) noexcept
+        {
+            // retired in order, the epochs are non decreasing
+            size_t Count{ 0U };
+            while( Count < Retired.size() && Retired[Count].Epoch + 2U <= InGlobalEpoch )
+            {
+                // copy, the deleter can retire more objects
+                const RetiredObject Item{ Retired[Count] };
+                Item.Deleter( Item.Object );
+                ++Count;
+            }
+
+            if( 0U != Count )
+            {
+                Retired.erase( Retired.begin(), Retired.begin() + static_cast<ptrdiff_t>( Count ) );
+            }
+
+            return Count;
+        }
+
+        //! Queue an object retired on a thread without an instance
+        static void RetireOrphan( const RetiredObject& InObject ) noexcept;
+
+        //! Free the orphan objects retired at least two epochs before InGlobalEpoch
+        static size_t ReclaimOrphans( uint64_t InGlobalEpoch ) noexcept;
+
+        static_assert( 0U != CEpochReclamation_MaxParticipants );
+
+        SKL_CACHE_ALIGNED static std::atomic<uint64_t> GlobalEpoch;                                           //!< Global epoch [starts at 1, 0 is the offline marker]
+        SKL_CACHE_ALIGNED static std::atomic<uint32_t> ParticipantsCount;                                     //!< Number of participant slots ever used
+        SKL_CACHE_ALIGNED static std::atomic<size_t>   OrphansCount;                                          //!< Number of orphan objects waiting to be freed
+        static EpochParticipant                        Participants[CEpochReclamation_MaxParticipants];       //!< Participant slots
+
+        EpochParticipant*          Participant{ nullptr }; //!< Slot of this thread
+        std::vector<RetiredObject> Retired    {};          //!< Objects retired by this thread
+    };
+}
@@ -0,0 +1,197 @@
+//!
+//! \file FrameArena.h
+//!
+//! \brief Bump pointer arena for the transient (per tick) allocations
+//!
+//! \author Balan Narcis (balannarcis96@gmail.com)
+//!
+#pragma once
+
+namespace SKL
+{
+    //! Growable bump pointer arena, allocation is a pointer increment, deallocation is a no-op, all the memory is reclaimed at once by Reset()
+    //! \remarks Not thread safe
+    //! \remarks If a cycle overflows the first chunk, on Reset() the chunks are merged into one chunk large enough for the peak usage
+    class BumpArena
+    {
+    public:
+        BumpArena() noexcept = default;
+        BumpArena( size_t InChunkSize ) noexcept
+            : ChunkSize{ InChunkSize } {}
+        ~BumpArena() noexcept
+        {
+            Release();
+        }
+
+        // Can't copy or move
+        BumpArena( const BumpArena& ) = delete;
+        BumpArena& operator=( const BumpArena& ) = delete;
+        BumpArena( BumpArena&& ) = delete;
+        BumpArena& operator=( BumpArena&& ) = delete;
+
+        //! Allocate InSize bytes aligned to InAlignment [InAlignment must be a power of two]
+        //! \returns nullptr if the memory could not be allocated
+        SKL_FORCEINLINE SKL_NODISCARD void* Allocate( size_t InSize, size_t InAlignment = SKL_ALIGNMENT ) noexcept
+        {
+            SKL_ASSERT( 0U != InAlignment && 0U == ( InAlignment & ( InAlignment - 1U ) ) );
+
+            const uintptr_t Aligned{ ( Cursor + ( InAlignment - 1U ) ) & ~( static_cast<uintptr_t>( InAlignment ) - 1U ) };
+            if( Aligned + InSize <= End ) SKL_LIKELY
+            {
+                Cursor = Aligned + InSize;
+                return reinterpret_cast<void*>( Aligned );
+            }
+
+            return AllocateSlow( InSize, InAlignment );
+        }
+
+        //! Allocate uninitialized storage for InCount objects of type T
+        template<typename T>
+        SKL_FORCEINLINE SKL_NODISCARD T* AllocateArray( size_t InCount ) noexcept
+        {
+            return reinterpret_cast<T*>( Allocate( sizeof( T ) * InCount, alignof( T ) ) );
+        }
+
+        //! Release all allocations at once [no destructors are called]
+        void Reset() noexcept
+        {
+            const size_t UsedBytes{ GetUsedBytes() };
+            PeakUsedBytes = std::max( PeakUsedBytes, UsedBytes );
+
+            if( nullptr == Head )
+            {
+                return;
+            }
+
+            if( nullptr != Head->Previous ) SKL_UNLIKELY
+            {
+                // the cycle overflowed the first chunk, replace all chunks with one that fits the peak usage
+                const size_t NewChunkSize{ std::max( ChunkSize, PeakUsedBytes + ( PeakUsedBytes / 4U ) ) };
+                Release();
+                ( void )PushChunk( NewChunkSize );
+
+                GLOG_DEBUG( "BumpArena::Reset() Grown to %llu bytes", static_cast<unsigned long long>( NewChunkSize ) );
+            }
+            else
+            {
+                Cursor = Head->GetBegin();
+            }
+
+            UsedBytesInPreviousChunks = 0U;
+        }
+
+        //! Free all the chunks
+        void Release() noexcept
+        {
+            while( nullptr != Head )
+            {
+                Chunk* Previous{ Head->Previous };
+                SKL_FREE_SIZE_ALIGNED( Head, Head->Size, SKL_CACHE_LINE_SIZE );
+                Head = Previous;
+            }
+
+            Cursor                    = 0U;
+            End                       = 0U;
+            UsedBytesInPreviousChunks = 0U;
+        }
+
+        //! Get the number of bytes allocated since the last Reset() [including the alignment padding]
+        SKL_FORCEINLINE SKL_NODISCARD size_t GetUsedBytes() const noexcept
+        {
+            return UsedBytesInPreviousChunks + ( nullptr == Head ? 0U : static_cast<size_t>( Cursor - Head->GetBegin() ) );
+        }
+
+        //! Get the max number of bytes used in one cycle [between two Reset() calls]
+        SKL_FORCEINLINE SKL_NODISCARD size_t GetPeakUsedBytes() const noexcept { return std::max( PeakUsedBytes, GetUsedBytes() ); }
+
+        //! Get the number of bytes available in the current chunk
+        SKL_FORCEINLINE SKL_NODISCARD size_t GetAvailableBytes() const noexcept { return static_cast<size_t>( End - Cursor ); }
+
+    private:
+        struct Chunk
+        {
+            Chunk* Previous;
+            size_t Size;
+
+            SKL_FORCEINLINE SKL_NODISCARD uintptr_t GetBegin() const noexcept { return reinterpret_cast<uintptr_t>( this ) + HeaderSize; }
+            SKL_FORCEINLINE SKL_NODISCARD uintptr_t GetEnd() const noexcept { return reinterpret_cast<uintptr_t>( this ) + Size; }
+        };
+        static constexpr size_t HeaderSize = ( ( sizeof( Chunk ) + SKL_CACHE_LINE_SIZE - 1U ) / SKL_CACHE_LINE_SIZE ) * SKL_CACHE_LINE_SIZE;
+
+        SKL_NOINLINE void* AllocateSlow( size_t InSize, size_t InAlignment ) noexcept
+        {
+            if( nullptr != Head )
+            {
+                UsedBytesInPreviousChunks += static_cast<size_t>( Cursor - Head->GetBegin() );
+            }
+
+            const size_t RequiredSize{ HeaderSize + InSize + InAlignment };
+            if( false == PushChunk( std::max( ChunkSize, RequiredSize ) ) ) SKL_UNLIKELY
+            {
+                GLOG_DEBUG( "BumpArena::Allocate() Failed to allocate chunk for %llu bytes", static_cast<unsigned long long>( InSize ) );
+                return nullptr;
+            }
+
+            return Allocate( InSize, InAlignment );
+        }
+
+        bool PushChunk( size_t InSize ) noexcept
+        {
+            auto* NewChunk{ reinterpret_cast<Chunk*>( SKL_MALLOC_ALIGNED( InSize, SKL_CACHE_LINE_SIZE ) ) };
+            if( nullptr == NewChunk ) SKL_UNLIKELY
+            {
+                return false;
+            }
+
+            NewChunk->Previous = Head;
+            NewChunk->Size     = InSize;
+            Head               = NewChunk;
+            Cursor             = NewChunk->GetBegin();
+            End                = NewChunk->GetEnd();
+
+            return true;
+        }
+
+        uintptr_t Cursor                   { 0U };                    //!< Next free byte in the current chunk
+        uintptr_t End                      { 0U };                    //!< End of the current chunk
+        Chunk*    Head                     { nullptr };               //!< Current chunk, linked to the previous chunks
+        size_t    UsedBytesInPreviousChunks{ 0U };                    //!< Bytes used in the chunks before Head in the current cycle
+        size_t    PeakUsedBytes            { 0U };                    //!< Max bytes used in one cycle
+        size_t    ChunkSize                { CFrameArena_ChunkSize }; //!< Minimum size of a chunk
+    };
+
+    //! Per worker thread arena for the transient allocations of one tick (packet build buffers, query results, temporary containers etc.)
+    //! \remarks Reset by the active workers at the end of each tick and by the reactive workers after each handled batch of tasks
+    //! \remarks Memory allocated from this arena must not be used after the tick ends
+    struct FrameArena final : public ITLSSingleton<FrameArena>
+    {
+        const char *GetName() const noexcept override
+        {
+            return "[FrameArena]";
+        }
+
+        //! Allocate InSize bytes aligned to InAlignment for the current tick
+        SKL_FORCEINLINE SKL_NODISCARD static void* Allocate( size_t InSize, size_t InAlignment = SKL_ALIGNMENT ) noexcept
+        {
+            auto* Instance{ FrameArena::GetInstance() }; SKL_ASSERT( nullptr != Instance );
+            return Instance->Arena.Allocate( InSize, InAlignment );
+        }
+
+        //! Allocate uninitialized storage for InCount objects of type T for the current tick
+        template<typename T>
+        SKL_FORCEINLINE SKL_NODISCARD static T* AllocateArray( size_t InCount ) noexcept
+        {
+            auto* Instance{ FrameArena::GetInstance() }; SKL_ASSERT( nullptr != Instance );
+            return Instance->Arena.template AllocateArray<T>( InCount );
+        }
+
+        //! Release all the allocations of the current tick
+        SKL_FORCEINLINE void Reset() noexcept { Arena.Reset(); }
+
+        SKL_FORCEINLINE SKL_NODISCARD BumpArena& GetArena() noexcept { return Arena; }
+        SKL_FORCEINLINE SKL_NODISCARD const BumpArena& GetArena() const noexcept { return Arena; }
+
+    private:
+        BumpArena Arena{ CFrameArena_ChunkSize };
+    };
+}
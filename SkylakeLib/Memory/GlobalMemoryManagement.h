@@ -9,18 +9,211 @@
 
 namespace SKL
 {
+    //! Batch functions of one pool partition, used by the thread magazines to refill from and flush to the partition of their thread's NUMA node
+    struct PoolBatchFunctions
+    {
+        size_t( *AllocateBatch )( void**, size_t ) noexcept;
+        void  ( *DeallocateBatch )( void**, size_t ) noexcept;
+    };
+
     class SkylakeGlobalMemoryManager final
     {
     public:
-        template<size_t TBlockSize, size_t TBlockCount> 
+        //! Pool of TBlockCount blocks of TBlockSize bytes
+        //! \remarks If CMemoryManager_UseNumaPartitions is true each NUMA node has its own pool (partition) with the slab allocated on that node, TNumaNode is the node of this partition
+        template<size_t TBlockSize, size_t TBlockCount, uint32_t TNumaNode = 0U> 
         struct MemoryPool
         {
-            static constexpr size_t BlockSize  = TBlockSize;
-            static constexpr size_t BlockCount = TBlockCount;
+            static constexpr size_t   BlockSize       = TBlockSize;
+            static constexpr size_t   BlockCount      = TBlockCount;
+            static constexpr uint32_t NumaNode        = TNumaNode;
+            static constexpr uint32_t PartitionsCount = CMemoryManager_UseNumaPartitions ? CMemoryManager_MaxNumaNodes : 1U;
+            static constexpr bool     bUseThreadCache = CMemoryManager_UseThreadCache && BlockSize <= CMemoryManager_ThreadCacheMaxBlockSize;
             using TMemoryBlock                 = MemoryBlock<BlockSize>;
-            using TObjectPool                  = ObjectPool<TMemoryBlock, BlockCount, false, CMemoryManager_UseSpinLock_Or_Atomics, false, false, CMemoryManager_Alignment>;      
+            using TObjectPool                  = ObjectPool<TMemoryBlock, BlockCount, false, CMemoryManager_UseSpinLock_Or_Atomics, false, false, CMemoryManager_Alignment, CMemoryManager_UseSlabPreallocation, CMemoryManager_UseLargePages, CMemoryManager_UseNumaPartitions ? TNumaNode : CNoNumaNode>;      
+
+            //! The pool with the same blocks for NUMA node TPartitionNumaNode
+            template<uint32_t TPartitionNumaNode>
+            using TPartition = MemoryPool<BlockSize, BlockCount, TPartitionNumaNode>;
+
+            static_assert( TNumaNode < PartitionsCount, "Invalid NUMA node partition" );
+
+            static inline PoolTrimPolicy TrimPolicy{};
+
+            //! Sample the pool and return the memory of its idle blocks to the OS at the end of each trim window
+            //! \remarks The blocks cached in the threads magazines count as in use
+            //! \returns the number of bytes returned to the OS
+            static size_t Trim( TEpochTimePoint InNow ) noexcept
+            {
+                if constexpr( BlockSize < CMemoryManager_TrimMinBlockSize )
+                {
+                    ( void )InNow;
+                    return 0U;
+                }
+                else
+                {
+                    if( false == TObjectPool::SupportsTrimming() )
+                    {
+                        return 0U;
+                    }
+
+                    const size_t TrimCount{ TrimPolicy.Sample( InNow, TObjectPool::GetCachedBlocksCount(), BlockCount ) };
+                    if( 0U == TrimCount ) SKL_LIKELY
+                    {
+                        return 0U;
+                    }
+
+                    return TObjectPool::DiscardColdBlocks( TrimCount );
+                }
+            }
+
+            //! Call InFunctor( std::type_identity<TPartition<Node>>{} ) for each partition
+            template<typename TFunctor>
+            SKL_FORCEINLINE static void ForEachPartition( TFunctor&& InFunctor ) noexcept
+            {
+                [&InFunctor]<uint32_t... TNodes>( std::integer_sequence<uint32_t, TNodes...> ) noexcept -> void
+                {
+                    ( InFunctor( std::type_identity<TPartition<TNodes>>{} ), ... );
+                }( std::make_integer_sequence<uint32_t, PartitionsCount>{} );
+            }
+
+            //! Call InFunctor( std::type_identity<TPartition<InNumaNode>>{} ) [InNumaNode must be less than PartitionsCount]
+            template<uint32_t TPartitionNumaNode = 0U, typename TFunctor>
+            SKL_FORCEINLINE static decltype( auto ) VisitPartition( uint32_t InNumaNode, TFunctor&& InFunctor ) noexcept
+            {
+                if constexpr( TPartitionNumaNode + 1U < PartitionsCount )
+                {
+                    if( TPartitionNumaNode != InNumaNode )
+                    {
+                        return VisitPartition<TPartitionNumaNode + 1U>( InNumaNode, std::forward<TFunctor>( InFunctor ) );
+                    }
+                }
+
+                SKL_ASSERT( TPartitionNumaNode == InNumaNode );
+                return InFunctor( std::type_identity<TPartition<TPartitionNumaNode>>{} );
+            }
+
+            //! Allocate one block from the partition of InNumaNode
+            SKL_FORCEINLINE SKL_NODISCARD static void* AllocateFromPartition( uint32_t InNumaNode ) noexcept
+            {
+                return VisitPartition( InNumaNode, []( auto InPartition ) noexcept -> void*
+                {
+                    return reinterpret_cast<void*>( decltype( InPartition )::type::TObjectPool::Allocate() );
+                } );
+            }
+
+            //! Deallocate one block to the partition of InNumaNode
+            SKL_FORCEINLINE static void DeallocateToPartition( uint32_t InNumaNode, void* InPointer ) noexcept
+            {
+                VisitPartition( InNumaNode, [InPointer]( auto InPartition ) noexcept -> void
+                {
+                    using TPartitionPool = typename decltype( InPartition )::type;
+                    TPartitionPool::TObjectPool::Deallocate( reinterpret_cast<typename TPartitionPool::TMemoryBlock*>( InPointer ) );
+                } );
+            }
+
+            //! Get the batch functions of the partition of InNumaNode
+            SKL_NODISCARD static PoolBatchFunctions GetPartitionBatchFunctions( uint32_t InNumaNode ) noexcept
+            {
+                return VisitPartition( InNumaNode, []( auto InPartition ) noexcept -> PoolBatchFunctions
+                {
+                    using TPartitionObjectPool = typename decltype( InPartition )::type::TObjectPool;
+                    return { &TPartitionObjectPool::AllocateBatch, &TPartitionObjectPool::DeallocateBatch };
+                } );
+            }
+
+            //! Get the NUMA node of the partition whose slab owns InPointer
+            //! \returns CNoNumaNode if the block is not carved out of any partition slab (eg. allocated from the OS when the pool was empty)
+            SKL_NODISCARD static uint32_t GetHomeNumaNode( const void* InPointer ) noexcept
+            {
+                uint32_t Result{ CNoNumaNode };
+                ForEachPartition( [InPointer, &Result]( auto InPartition ) noexcept -> void
+                {
+                    using TPartitionPool = typename decltype( InPartition )::type;
+                    if( true == TPartitionPool::TObjectPool::IsOwnedBySlab( InPointer ) )
+                    {
+                        Result = TPartitionPool::NumaNode;
+                    }
+                } );
+
+                return Result;
+            }
+
+            //! Preallocate the partitions of the first InNumaNodesCount NUMA nodes
+            SKL_NODISCARD static RStatus PreallocatePartitions( uint32_t InNumaNodesCount ) noexcept
+            {
+                RStatus Result{ RSuccess };
+                ForEachPartition( [InNumaNodesCount, &Result]( auto InPartition ) noexcept -> void
+                {
+                    using TPartitionPool = typename decltype( InPartition )::type;
+                    if( TPartitionPool::NumaNode < InNumaNodesCount && RSuccess != TPartitionPool::TObjectPool::Preallocate() )
+                    {
+                        Result = RFail;
+                    }
+                } );
+
+                return Result;
+            }
+
+            //! Free the blocks of all partitions
+            static void FreePartitions() noexcept
+            {
+                ForEachPartition( []( auto InPartition ) noexcept -> void
+                {
+                    decltype( InPartition )::type::TObjectPool::FreePool();
+                } );
+            }
+
+            //! Zero the memory of all partitions [the partitions of the NUMA nodes not present are skipped]
+            static void ZeroPartitions() noexcept
+            {
+                ForEachPartition( []( auto InPartition ) noexcept -> void
+                {
+                    using TPartitionObjectPool = typename decltype( InPartition )::type::TObjectPool;
+                    if( 1U == PartitionsCount || nullptr != TPartitionObjectPool::GetSlab() )
+                    {
+                        TPartitionObjectPool::ZeroAllMemory();
+                    }
+                } );
+            }
+
+            //! Is the memory block carved out of the slab of any partition
+            SKL_FORCEINLINE SKL_NODISCARD static bool IsOwnedByPartitions( const void* InPointer ) noexcept
+            {
+                if constexpr( 1U == PartitionsCount )
+                {
+                    return TObjectPool::IsOwnedBySlab( InPointer );
+                }
+                else
+                {
+                    return CNoNumaNode != GetHomeNumaNode( InPointer );
+                }
+            }
+
+            //! Trim all partitions [see Trim()]
+            static size_t TrimPartitions( TEpochTimePoint InNow ) noexcept
+            {
+                size_t TrimmedBytes{ 0U };
+                ForEachPartition( [InNow, &TrimmedBytes]( auto InPartition ) noexcept -> void
+                {
+                    TrimmedBytes += decltype( InPartition )::type::Trim( InNow );
+                } );
+
+                return TrimmedBytes;
+            }
         };        
 
+        //! Statistics of the pools of one NUMA node [see GetNumaPartitionStatistics()]
+        struct NumaPartitionStatistics
+        {
+            size_t Allocations        { 0U }; //!< Blocks handed out by the node pools
+            size_t Deallocations      { 0U }; //!< Blocks returned to the node pools
+            size_t OSAllocations      { 0U }; //!< Blocks allocated from the OS because the node pools were empty
+            size_t OSDeallocations    { 0U }; //!< Blocks freed to the OS because the node pools were full
+            size_t RemoteDeallocations{ 0U }; //!< Blocks of this node freed by threads running on other nodes [sent back to this node]
+            size_t SlabBytes          { 0U }; //!< Bytes of the preallocated node slabs
+        };
+
         struct AllocResult
         {
             void*  MemoryBlock    { nullptr };
@@ -37,67 +230,155 @@ namespace SKL
         using Pool4 = MemoryPool<CMemoryManager_Pool4_BlockSize, CMemoryManager_Pool4_BlockCount>;
         using Pool5 = MemoryPool<CMemoryManager_Pool5_BlockSize, CMemoryManager_Pool5_BlockCount>;
         using Pool6 = MemoryPool<CMemoryManager_Pool6_BlockSize, CMemoryManager_Pool6_BlockCount>;
+
+        // Size classes [between Pool4 and Pool5]
+        using TSizeClasses = SizeClassesTable<CMemoryManager_Pool4_BlockSize
+                                            , CMemoryManager_UseSizeClasses ? CMemoryManager_SizeClassesCount : 0U
+                                            , CMemoryManager_SizeClassesSpacingPercent>;
+        template<size_t TClassIndex>
+        using TSizeClassPool         = MemoryPool<TSizeClasses::Sizes[TClassIndex], TSizeClasses::GetBlockCount( TClassIndex, CMemoryManager_SizeClassPoolBytes )>;
+        using TSizeClassesStatistics = SizeClassesStatistics<TSizeClasses, true>;
+
+        static_assert( TSizeClasses::MaxSize < CMemoryManager_Pool5_BlockSize, "The size classes must fit between Pool4 and Pool5" );
         
         static void FreeAllPools() noexcept
         {
-            Pool1::TObjectPool::FreePool();
-            Pool2::TObjectPool::FreePool();
-            Pool3::TObjectPool::FreePool();
-            Pool4::TObjectPool::FreePool();
-            Pool5::TObjectPool::FreePool();
-            Pool6::TObjectPool::FreePool();
+            // the blocks cached by the calling thread must not outlive the pools
+            FlushThreadCache();
+
+            Pool1::FreePartitions();
+            Pool2::FreePartitions();
+            Pool3::FreePartitions();
+            Pool4::FreePartitions();
+            Pool5::FreePartitions();
+            Pool6::FreePartitions();
+
+            TSizeClasses::ForEachClass( []( auto InClassIndex ) noexcept -> void
+            {
+                TSizeClassPool<decltype( InClassIndex )::value>::FreePartitions();
+            } );
         }
 
         //! Preallocate all pools
+        //! \remarks If CMemoryManager_UseNumaPartitions is true the pools of each NUMA node are preallocated on that node
         static RStatus Preallocate() noexcept
         {
-            if( RSuccess != Pool1::TObjectPool::Preallocate() )
+            const uint32_t NumaNodesCount{ GetNumaPartitionsCount() };
+
+            if( RSuccess != Pool1::PreallocatePartitions( NumaNodesCount ) )
             {
                 GLOG_FATAL( "SkylakeGlobalMemoryManager::Preallocate() -> Failed to Preallocate Pool1" );
                 return RFail;
             }
-            if( RSuccess != Pool2::TObjectPool::Preallocate() )
+            if( RSuccess != Pool2::PreallocatePartitions( NumaNodesCount ) )
             {
                 GLOG_FATAL( "SkylakeGlobalMemoryManager::Preallocate() -> Failed to Preallocate Pool2" );
                 return RFail;
             }
-            if( RSuccess != Pool3::TObjectPool::Preallocate() )
+            if( RSuccess != Pool3::PreallocatePartitions( NumaNodesCount ) )
             {
                 GLOG_FATAL( "SkylakeGlobalMemoryManager::Preallocate() -> Failed to Preallocate Pool3" );
                 return RFail;
             }
-            if( RSuccess != Pool4::TObjectPool::Preallocate() )
+            if( RSuccess != Pool4::PreallocatePartitions( NumaNodesCount ) )
             {
                 GLOG_FATAL( "SkylakeGlobalMemoryManager::Preallocate() -> Failed to Preallocate Pool4" );
                 return RFail;
             }
-            if( RSuccess != Pool5::TObjectPool::Preallocate() )
+            if( RSuccess != Pool5::PreallocatePartitions( NumaNodesCount ) )
             {
                 GLOG_FATAL( "SkylakeGlobalMemoryManager::Preallocate() -> Failed to Preallocate Pool5" );
                 return RFail;
             }
-            if( RSuccess != Pool6::TObjectPool::Preallocate() )
+            if( RSuccess != Pool6::PreallocatePartitions( NumaNodesCount ) )
             {
                 GLOG_FATAL( "SkylakeGlobalMemoryManager::Preallocate() -> Failed to Preallocate Pool6" );
                 return RFail;
             }
 
+            bool bSizeClassesPreallocated{ true };
+            TSizeClasses::ForEachClass( [NumaNodesCount, &bSizeClassesPreallocated]( auto InClassIndex ) noexcept -> void
+            {
+                if( RSuccess != TSizeClassPool<decltype( InClassIndex )::value>::PreallocatePartitions( NumaNodesCount ) )
+                {
+                    GLOG_FATAL( "SkylakeGlobalMemoryManager::Preallocate() -> Failed to Preallocate SizeClass[%llu bytes]", static_cast<unsigned long long>( TSizeClasses::Sizes[decltype( InClassIndex )::value] ) );
+                    bSizeClassesPreallocated = false;
+                }
+            } );
+            if( false == bSizeClassesPreallocated )
+            {
+                return RFail;
+            }
+
             GLOG_DEBUG( "SkylakeGlobalMemoryManager ALL POOLS PREALLOCATED!" );
 
+            if constexpr( CMemoryManager_UseLargePages )
+            {
+                GLOG_INFO( "SkylakeGlobalMemoryManager large pages: Pool1[%s] Pool2[%s] Pool3[%s] Pool4[%s] Pool5[%s] Pool6[%s]"
+                         , Pool1::TObjectPool::IsSlabOnLargePages() ? "yes" : "no"
+                         , Pool2::TObjectPool::IsSlabOnLargePages() ? "yes" : "no"
+                         , Pool3::TObjectPool::IsSlabOnLargePages() ? "yes" : "no"
+                         , Pool4::TObjectPool::IsSlabOnLargePages() ? "yes" : "no"
+                         , Pool5::TObjectPool::IsSlabOnLargePages() ? "yes" : "no"
+                         , Pool6::TObjectPool::IsSlabOnLargePages() ? "yes" : "no" );
+
+                TSizeClasses::ForEachClass( []( auto InClassIndex ) noexcept -> void
+                {
+                    GLOG_INFO( "SkylakeGlobalMemoryManager large pages: SizeClass[%llu bytes][%s]"
+                             , static_cast<unsigned long long>( TSizeClasses::Sizes[decltype( InClassIndex )::value] )
+                             , TSizeClassPool<decltype( InClassIndex )::value>::TObjectPool::IsSlabOnLargePages() ? "yes" : "no" );
+                } );
+            }
+
             return RSuccess;
         }
 
         //! Zero memory all pools, this will force the OS to have the all pages ready in memory (hot)
+        //! \remarks Slabs backed by large pages are already resident and are skipped
         static void ZeroAllMemory() noexcept
         {
-            Pool1::TObjectPool::ZeroAllMemory();
-            Pool2::TObjectPool::ZeroAllMemory();
-            Pool3::TObjectPool::ZeroAllMemory();
-            Pool4::TObjectPool::ZeroAllMemory();
-            Pool5::TObjectPool::ZeroAllMemory();
-            Pool6::TObjectPool::ZeroAllMemory();
+            Pool1::ZeroPartitions();
+            Pool2::ZeroPartitions();
+            Pool3::ZeroPartitions();
+            Pool4::ZeroPartitions();
+            Pool5::ZeroPartitions();
+            Pool6::ZeroPartitions();
+
+            TSizeClasses::ForEachClass( []( auto InClassIndex ) noexcept -> void
+            {
+                TSizeClassPool<decltype( InClassIndex )::value>::ZeroPartitions();
+            } );
+        }
+
+        //! Is the memory block carved out of one of the pools slabs [always false if CMemoryManager_UseSlabPreallocation is false]
+        SKL_FORCEINLINE SKL_NODISCARD static bool IsOwnedByPools( const void* InPointer ) noexcept
+        {
+            return Pool1::IsOwnedByPartitions( InPointer )
+                || Pool2::IsOwnedByPartitions( InPointer )
+                || Pool3::IsOwnedByPartitions( InPointer )
+                || Pool4::IsOwnedByPartitions( InPointer )
+                || Pool5::IsOwnedByPartitions( InPointer )
+                || Pool6::IsOwnedByPartitions( InPointer )
+                || IsOwnedBySizeClassPools( InPointer, std::make_index_sequence<TSizeClasses::ClassesCount>{} );
         }
         
+        //! Return all the blocks cached by the calling thread to the pools [see GlobalMemoryThreadCache]
+        static void FlushThreadCache() noexcept;
+
+        //! Get the size of the memory block that serves an allocation of InSize bytes [compile time, see Allocate()]
+        SKL_NODISCARD static consteval size_t GetMemoryBlockSizeFor( size_t InSize ) noexcept
+        {
+                 if( InSize <= CMemoryManager_Pool1_BlockSize ) { return CMemoryManager_Pool1_BlockSize; }
+            else if( InSize <= CMemoryManager_Pool2_BlockSize ) { return CMemoryManager_Pool2_BlockSize; }
+            else if( InSize <= CMemoryManager_Pool3_BlockSize ) { return CMemoryManager_Pool3_BlockSize; }
+            else if( InSize <= CMemoryManager_Pool4_BlockSize ) { return CMemoryManager_Pool4_BlockSize; }
+            else if( TSizeClasses::IsInRange( InSize ) )        { return TSizeClasses::Sizes[TSizeClasses::GetClassIndex( InSize )]; }
+            else if( InSize <= CMemoryManager_Pool5_BlockSize ) { return CMemoryManager_Pool5_BlockSize; }
+            else if( InSize <= CMemoryManager_Pool6_BlockSize ) { return CMemoryManager_Pool6_BlockSize; }
+            
+            return InSize;
+        }
+
         //! Allocate new memory block with the size known at compile time
         template<size_t AllocateSize>
         static AllocResult Allocate() noexcept
@@ -132,7 +413,7 @@ namespace SKL
             if constexpr( AllocateSize <= CMemoryManager_Pool1_BlockSize )
             {
                 Result.MemoryBlockSize = CMemoryManager_Pool1_BlockSize;
-                Result.MemoryBlock     = reinterpret_cast<void*>( Pool1::TObjectPool::Allocate() );
+                Result.MemoryBlock     = AllocateFromPool<Pool1>();
                 
                 #if defined(SKL_MEM_TIME_GLOBAL)
                 KPIContext::Static_SetAverageKPIValue<EKPIValuePoints::Allocator_Pool1>( TimeMesurement.GetElapsedSeconds() );
@@ -145,7 +426,7 @@ namespace SKL
             else if constexpr( AllocateSize <= CMemoryManager_Pool2_BlockSize )
             {
                 Result.MemoryBlockSize = CMemoryManager_Pool2_BlockSize;
-                Result.MemoryBlock     = reinterpret_cast<void*>( Pool2::TObjectPool::Allocate() );
+                Result.MemoryBlock     = AllocateFromPool<Pool2>();
                 
                 #if defined(SKL_MEM_TIME_GLOBAL)
                 KPIContext::Static_SetAverageKPIValue<EKPIValuePoints::Allocator_Pool2>( TimeMesurement.GetElapsedSeconds() );
@@ -158,7 +439,7 @@ namespace SKL
             else if constexpr( AllocateSize <= CMemoryManager_Pool3_BlockSize )
             {
                 Result.MemoryBlockSize = CMemoryManager_Pool3_BlockSize;
-                Result.MemoryBlock     = reinterpret_cast<void*>( Pool3::TObjectPool::Allocate() );
+                Result.MemoryBlock     = AllocateFromPool<Pool3>();
                 
                 #if defined(SKL_MEM_TIME_GLOBAL)
                 KPIContext::Static_SetAverageKPIValue<EKPIValuePoints::Allocator_Pool3>( TimeMesurement.GetElapsedSeconds() );
@@ -171,7 +452,7 @@ namespace SKL
             else if constexpr( AllocateSize <= CMemoryManager_Pool4_BlockSize )
             {
                 Result.MemoryBlockSize = CMemoryManager_Pool4_BlockSize;
-                Result.MemoryBlock     = reinterpret_cast<void*>( Pool4::TObjectPool::Allocate() );
+                Result.MemoryBlock     = AllocateFromPool<Pool4>();
                 
                 #if defined(SKL_MEM_TIME_GLOBAL)
                 KPIContext::Static_SetAverageKPIValue<EKPIValuePoints::Allocator_Pool4>( TimeMesurement.GetElapsedSeconds() );
@@ -181,10 +462,19 @@ namespace SKL
                 KPIContext::IncrementAllocCount<EKPIValuePoints::Allocator_Pool4>();
                 #endif
             }
+            else if constexpr( TSizeClasses::IsInRange( AllocateSize ) )
+            {
+                constexpr size_t ClassIndex = TSizeClasses::template ClassIndexOf<AllocateSize>;
+
+                Result.MemoryBlockSize = TSizeClasses::Sizes[ClassIndex];
+                Result.MemoryBlock     = AllocateFromPool<TSizeClassPool<ClassIndex>>();
+
+                SizeClassesStats.OnAllocation( ClassIndex, AllocateSize );
+            }
             else if constexpr( AllocateSize <= CMemoryManager_Pool5_BlockSize )
             {
                 Result.MemoryBlockSize = CMemoryManager_Pool5_BlockSize;
-                Result.MemoryBlock     = reinterpret_cast<void*>( Pool5::TObjectPool::Allocate() );
+                Result.MemoryBlock     = AllocateFromPool<Pool5>();
                 
                 #if defined(SKL_MEM_TIME_GLOBAL)
                 KPIContext::Static_SetAverageKPIValue<EKPIValuePoints::Allocator_Pool5>( TimeMesurement.GetElapsedSeconds() );
@@ -197,7 +487,7 @@ namespace SKL
             else if constexpr( AllocateSize <= CMemoryManager_Pool6_BlockSize )
             {
                 Result.MemoryBlockSize = CMemoryManager_Pool6_BlockSize;
-                Result.MemoryBlock     = reinterpret_cast<void*>( Pool6::TObjectPool::Allocate() );
+                Result.MemoryBlock     = AllocateFromPool<Pool6>();
                 
                 #if defined(SKL_MEM_TIME_GLOBAL)
                 KPIContext::Static_SetAverageKPIValue<EKPIValuePoints::Allocator_Pool6>( TimeMesurement.GetElapsedSeconds() );
@@ -222,6 +512,7 @@ namespace SKL
             }
 
             SKL_IFMEMORYSTATS( ++TotalAllocations );
+            SKL_IFMEMORYSITEPROFILER( AllocationSiteProfiler::OnAllocation( SKL_RETURN_ADDRESS(), Result.MemoryBlock, AllocateSize, Result.MemoryBlockSize ) );
             SKL_ASSERT( 0 == ( ( uintptr_t )Result.MemoryBlock ) % CMemoryManager_Alignment );
 
 #if defined(SKL_DEBUG_MEMORY_ALLOCATORS)
@@ -280,7 +571,7 @@ namespace SKL
             if( AllocateSize <= CMemoryManager_Pool1_BlockSize )
             {
                 Result.MemoryBlockSize = CMemoryManager_Pool1_BlockSize;
-                Result.MemoryBlock     = reinterpret_cast<void*>( Pool1::TObjectPool::Allocate() );
+                Result.MemoryBlock     = AllocateFromPool<Pool1>();
                 
                 #if defined(SKL_MEM_TIME_OS)
                 KPIContext::Static_SetAverageKPIValue<EKPIValuePoints::Allocator_Pool1>( TimeMesurement.GetElapsedSeconds() );
@@ -293,7 +584,7 @@ namespace SKL
             else if( AllocateSize <= CMemoryManager_Pool2_BlockSize )
             {
                 Result.MemoryBlockSize = CMemoryManager_Pool2_BlockSize;
-                Result.MemoryBlock     = reinterpret_cast<void*>( Pool2::TObjectPool::Allocate() );
+                Result.MemoryBlock     = AllocateFromPool<Pool2>();
                 
                 #if defined(SKL_MEM_TIME_OS)
                 KPIContext::Static_SetAverageKPIValue<EKPIValuePoints::Allocator_Pool2>( TimeMesurement.GetElapsedSeconds() );
@@ -306,7 +597,7 @@ namespace SKL
             else if( AllocateSize <= CMemoryManager_Pool3_BlockSize )
             {
                 Result.MemoryBlockSize = CMemoryManager_Pool3_BlockSize;
-                Result.MemoryBlock     = reinterpret_cast<void*>( Pool3::TObjectPool::Allocate() );
+                Result.MemoryBlock     = AllocateFromPool<Pool3>();
                 
                 #if defined(SKL_MEM_TIME_OS)
                 KPIContext::Static_SetAverageKPIValue<EKPIValuePoints::Allocator_Pool3>( TimeMesurement.GetElapsedSeconds() );
@@ -319,7 +610,7 @@ namespace SKL
             else if( AllocateSize <= CMemoryManager_Pool4_BlockSize )
             {
                 Result.MemoryBlockSize = CMemoryManager_Pool4_BlockSize;
-                Result.MemoryBlock     = reinterpret_cast<void*>( Pool4::TObjectPool::Allocate() );
+                Result.MemoryBlock     = AllocateFromPool<Pool4>();
                 
                 #if defined(SKL_MEM_TIME_OS)
                 KPIContext::Static_SetAverageKPIValue<EKPIValuePoints::Allocator_Pool4>( TimeMesurement.GetElapsedSeconds() );
@@ -329,10 +620,22 @@ namespace SKL
                 KPIContext::IncrementAllocCount<EKPIValuePoints::Allocator_Pool4>();
                 #endif
             }
+            else if( TSizeClasses::IsInRange( AllocateSize ) )
+            {
+                const size_t ClassIndex{ TSizeClasses::GetClassIndex( AllocateSize ) };
+
+                TSizeClasses::VisitClass( ClassIndex, [&Result]( auto InClassIndex ) noexcept -> void
+                {
+                    Result.MemoryBlock = AllocateFromPool<TSizeClassPool<decltype( InClassIndex )::value>>();
+                } );
+                Result.MemoryBlockSize = TSizeClasses::Sizes[ClassIndex];
+
+                SizeClassesStats.OnAllocation( ClassIndex, AllocateSize );
+            }
             else if( AllocateSize <= CMemoryManager_Pool5_BlockSize )
             {
                 Result.MemoryBlockSize = CMemoryManager_Pool5_BlockSize;
-                Result.MemoryBlock     = reinterpret_cast<void*>( Pool5::TObjectPool::Allocate() );
+                Result.MemoryBlock     = AllocateFromPool<Pool5>();
                 
                 #if defined(SKL_MEM_TIME_OS)
                 KPIContext::Static_SetAverageKPIValue<EKPIValuePoints::Allocator_Pool5>( TimeMesurement.GetElapsedSeconds() );
@@ -345,7 +648,7 @@ namespace SKL
             else if( AllocateSize <= CMemoryManager_Pool6_BlockSize )
             {
                 Result.MemoryBlockSize = CMemoryManager_Pool6_BlockSize;
-                Result.MemoryBlock     = reinterpret_cast<void*>( Pool6::TObjectPool::Allocate() );
+                Result.MemoryBlock     = AllocateFromPool<Pool6>();
                 
                 #if defined(SKL_MEM_TIME_OS)
                 KPIContext::Static_SetAverageKPIValue<EKPIValuePoints::Allocator_Pool6>( TimeMesurement.GetElapsedSeconds() );
@@ -372,6 +675,7 @@ namespace SKL
             }
 
             SKL_IFMEMORYSTATS( ++TotalAllocations );
+            SKL_IFMEMORYSITEPROFILER( AllocationSiteProfiler::OnAllocation( SKL_RETURN_ADDRESS(), Result.MemoryBlock, AllocateSize, Result.MemoryBlockSize ) );
             SKL_ASSERT( 0 == ( ( uintptr_t )Result.MemoryBlock ) % CMemoryManager_Alignment );
                                 
 #if defined(SKL_DEBUG_MEMORY_ALLOCATORS)
@@ -398,6 +702,7 @@ namespace SKL
         SKL_NOINLINE static void Deallocate( void* InPointer ) noexcept 
         {
             SKL_ASSERT( 0 == ( ( uintptr_t )InPointer ) % CMemoryManager_Alignment );
+            SKL_IFMEMORYSITEPROFILER( AllocationSiteProfiler::OnDeallocation( InPointer ) );
                      
 #if defined(SKL_MEM_MANAGER_DECAY_TO_GLOBAL)
             SKL_IFMEMORYSTATS( ++TotalDeallocations );
@@ -421,27 +726,31 @@ namespace SKL
 
             if constexpr( AllocateSize <= CMemoryManager_Pool1_BlockSize )
             {
-                Pool1::TObjectPool::Deallocate( reinterpret_cast<Pool1::TMemoryBlock*>( InPointer ) );
+                DeallocateToPool<Pool1>( InPointer );
             }
             else if constexpr( AllocateSize <= CMemoryManager_Pool2_BlockSize )
             {
-                Pool2::TObjectPool::Deallocate( reinterpret_cast<Pool2::TMemoryBlock*>( InPointer ) );
+                DeallocateToPool<Pool2>( InPointer );
             }
             else if constexpr( AllocateSize <= CMemoryManager_Pool3_BlockSize )
             {
-                Pool3::TObjectPool::Deallocate( reinterpret_cast<Pool3::TMemoryBlock*>( InPointer ) );
+                DeallocateToPool<Pool3>( InPointer );
             }
             else if constexpr( AllocateSize <= CMemoryManager_Pool4_BlockSize )
             {
-                Pool4::TObjectPool::Deallocate( reinterpret_cast<Pool4::TMemoryBlock*>( InPointer ) );
+                DeallocateToPool<Pool4>( InPointer );
+            }
+            else if constexpr( TSizeClasses::IsInRange( AllocateSize ) )
+            {
+                DeallocateToPool<TSizeClassPool<TSizeClasses::template ClassIndexOf<AllocateSize>>>( InPointer );
             }
             else if constexpr( AllocateSize <= CMemoryManager_Pool5_BlockSize )
             {
-                Pool5::TObjectPool::Deallocate( reinterpret_cast<Pool5::TMemoryBlock*>( InPointer ) );
+                DeallocateToPool<Pool5>( InPointer );
             }
             else if constexpr( AllocateSize <= CMemoryManager_Pool6_BlockSize )
             {
-                Pool6::TObjectPool::Deallocate( reinterpret_cast<Pool6::TMemoryBlock*>( InPointer ) );
+                DeallocateToPool<Pool6>( InPointer );
             }
             else
             {
@@ -456,6 +765,7 @@ namespace SKL
         SKL_NOINLINE static void Deallocate( void* InPointer, size_t AllocateSize ) noexcept 
         {
             SKL_ASSERT( 0 == ( ( uintptr_t )InPointer ) % CMemoryManager_Alignment );
+            SKL_IFMEMORYSITEPROFILER( AllocationSiteProfiler::OnDeallocation( InPointer ) );
                
 #if defined(SKL_MEM_MANAGER_DECAY_TO_GLOBAL)
             SKL_IFMEMORYSTATS( ++TotalDeallocations );
@@ -479,27 +789,34 @@ namespace SKL
 
             if( AllocateSize <= CMemoryManager_Pool1_BlockSize )
             {
-                Pool1::TObjectPool::Deallocate( reinterpret_cast<Pool1::TMemoryBlock*>( InPointer ) );
+                DeallocateToPool<Pool1>( InPointer );
             }
             else if( AllocateSize <= CMemoryManager_Pool2_BlockSize )
             {
-                Pool2::TObjectPool::Deallocate( reinterpret_cast<Pool2::TMemoryBlock*>( InPointer ) );
+                DeallocateToPool<Pool2>( InPointer );
             }
             else if( AllocateSize <= CMemoryManager_Pool3_BlockSize )
             {
-                Pool3::TObjectPool::Deallocate( reinterpret_cast<Pool3::TMemoryBlock*>( InPointer ) );
+                DeallocateToPool<Pool3>( InPointer );
             }
             else if( AllocateSize <= CMemoryManager_Pool4_BlockSize )
             {
-                Pool4::TObjectPool::Deallocate( reinterpret_cast<Pool4::TMemoryBlock*>( InPointer ) );
+                DeallocateToPool<Pool4>( InPointer );
+            }
+            else if( TSizeClasses::IsInRange( AllocateSize ) )
+            {
+                TSizeClasses::VisitClass( TSizeClasses::GetClassIndex( AllocateSize ), [InPointer]( auto InClassIndex ) noexcept -> void
+                {
+                    DeallocateToPool<TSizeClassPool<decltype( InClassIndex )::value>>( InPointer );
+                } );
             }
             else if( AllocateSize <= CMemoryManager_Pool5_BlockSize )
             {
-                Pool5::TObjectPool::Deallocate( reinterpret_cast<Pool5::TMemoryBlock*>( InPointer ) );
+                DeallocateToPool<Pool5>( InPointer );
             }
             else if( AllocateSize <= CMemoryManager_Pool6_BlockSize )
             {
-                Pool6::TObjectPool::Deallocate( reinterpret_cast<Pool6::TMemoryBlock*>( InPointer ) );
+                DeallocateToPool<Pool6>( InPointer );
             }
             else
             {
@@ -605,11 +922,194 @@ namespace SKL
 #endif
         }
 
+        //! Sample all pools and return the memory of their idle blocks to the OS [see PoolTrimPolicy]
+        //! \remarks Cheap to call every tick from any worker, the pools are sampled by one thread at a time, at most once every CMemoryManager_TrimSampleIntervalMs
+        //! \returns the number of bytes returned to the OS
+        static size_t TickTrimming( TEpochTimePoint InNow ) noexcept
+        {
+            if constexpr( false == CMemoryManager_UsePoolTrimming || false == CMemoryManager_UseSlabPreallocation )
+            {
+                ( void )InNow;
+                return 0U;
+            }
+            else
+            {
+                if( InNow < NextTrimSample.load( std::memory_order_relaxed ) ) SKL_LIKELY
+                {
+                    return 0U;
+                }
+
+                if( false == TrimLock.TryLock() )
+                {
+                    // another worker is sampling the pools
+                    return 0U;
+                }
+
+                size_t TrimmedBytes{ 0U };
+                if( InNow >= NextTrimSample.load( std::memory_order_relaxed ) )
+                {
+                    NextTrimSample.store( InNow + CMemoryManager_TrimSampleIntervalMs, std::memory_order_relaxed );
+
+                    TrimmedBytes += Pool1::TrimPartitions( InNow );
+                    TrimmedBytes += Pool2::TrimPartitions( InNow );
+                    TrimmedBytes += Pool3::TrimPartitions( InNow );
+                    TrimmedBytes += Pool4::TrimPartitions( InNow );
+                    TrimmedBytes += Pool5::TrimPartitions( InNow );
+                    TrimmedBytes += Pool6::TrimPartitions( InNow );
+                    TSizeClasses::ForEachClass( [InNow, &TrimmedBytes]( auto InClassIndex ) noexcept -> void
+                    {
+                        TrimmedBytes += TSizeClassPool<decltype( InClassIndex )::value>::TrimPartitions( InNow );
+                    } );
+                }
+
+                TrimLock.Unlock();
+
+                if( 0U != TrimmedBytes )
+                {
+                    GLOG_DEBUG( "SkylakeGlobalMemoryManager::TickTrimming() Returned %llu bytes to the OS", static_cast<unsigned long long>( TrimmedBytes ) );
+                }
+
+                return TrimmedBytes;
+            }
+        }
+
+        //! Log the fragmentation report of each size class
+        SKL_FORCEINLINE static void LogSizeClassesReport() noexcept
+        {
+            SizeClassesStats.LogReport( L"SkylakeGlobalMemoryManager" );
+        }
+
+        //! Get the per size class allocation statistics
+        SKL_FORCEINLINE SKL_NODISCARD static const TSizeClassesStatistics& GetSizeClassesStatistics() noexcept
+        {
+            return SizeClassesStats;
+        }
+
+        //! Get the number of NUMA nodes with their own pools [1 if CMemoryManager_UseNumaPartitions is false]
+        //! \remarks Nodes above CMemoryManager_MaxNumaNodes share the pools of the lower nodes
+        SKL_NODISCARD static uint32_t GetNumaPartitionsCount() noexcept
+        {
+            if constexpr( CMemoryManager_UseNumaPartitions )
+            {
+                static const uint32_t PartitionsCount{ std::min( GetNumaNodesCount(), CMemoryManager_MaxNumaNodes ) };
+                return PartitionsCount;
+            }
+            else
+            {
+                return 1U;
+            }
+        }
+
+        //! Get the pools partition for the NUMA node the calling thread is running on [0 if CMemoryManager_UseNumaPartitions is false]
+        SKL_NODISCARD static uint32_t GetCurrentNumaPartition() noexcept
+        {
+            if constexpr( CMemoryManager_UseNumaPartitions )
+            {
+                return GetCurrentNumaNode() % GetNumaPartitionsCount();
+            }
+            else
+            {
+                return 0U;
+            }
+        }
+
+        //! Get the pools partition used by the calling thread [fixed when the thread cache is created, see GlobalMemoryThreadCache]
+        SKL_NODISCARD static uint32_t GetThreadNumaPartition() noexcept;
+
+        //! Get the statistics of the pools of InNumaNode
+        //! \remarks The counters are available only if SKL_MEMORY_STATISTICS is defined, only SlabBytes is always set
+        SKL_NODISCARD static NumaPartitionStatistics GetNumaPartitionStatistics( uint32_t InNumaNode ) noexcept
+        {
+            SKL_ASSERT( InNumaNode < Pool1::PartitionsCount );
+
+            NumaPartitionStatistics Result{};
+            ForEachPool( [InNumaNode, &Result]( auto InPool ) noexcept -> void
+            {
+                using TPool = typename decltype( InPool )::type;
+                TPool::VisitPartition( InNumaNode, [&Result]( auto InPartition ) noexcept -> void
+                {
+                    using TPartitionObjectPool = typename decltype( InPartition )::type::TObjectPool;
+
+                    if( nullptr != TPartitionObjectPool::GetSlab() )
+                    {
+                        Result.SlabBytes += TPartitionObjectPool::PoolTraits::SlabSize;
+                    }
+
+#if defined(SKL_MEMORY_STATISTICS)
+                    Result.Allocations     += TPartitionObjectPool::GetTotalAllocations();
+                    Result.Deallocations   += TPartitionObjectPool::GetTotalDeallocations();
+                    Result.OSAllocations   += TPartitionObjectPool::GetTotalOSAllocations();
+                    Result.OSDeallocations += TPartitionObjectPool::GetTotalOSDeallocations();
+#endif
+                } );
+            } );
+
+            SKL_IFMEMORYSTATS( Result.RemoteDeallocations = NumaRemoteDeallocations[InNumaNode].load( std::memory_order_relaxed ) );
+
+            return Result;
+        }
+
+        //! Log the statistics of the pools of each NUMA node
+        static void LogNumaStatistics() noexcept
+        {
+            for( uint32_t i = 0; i < GetNumaPartitionsCount(); ++i )
+            {
+                const auto Statistics{ GetNumaPartitionStatistics( i ) };
+                GLOG_INFO( "SkylakeGlobalMemoryManager NUMA Node[%u]:\n\t\tSlabBytes:%llu\n\t\tAllocations:%llu\n\t\tDeallocations:%llu\n\t\tOSAllocations:%llu\n\t\tOSDeallocations:%llu\n\t\tRemoteDeallocations:%llu"
+                         , i
+                         , static_cast<unsigned long long>( Statistics.SlabBytes )
+                         , static_cast<unsigned long long>( Statistics.Allocations )
+                         , static_cast<unsigned long long>( Statistics.Deallocations )
+                         , static_cast<unsigned long long>( Statistics.OSAllocations )
+                         , static_cast<unsigned long long>( Statistics.OSDeallocations )
+                         , static_cast<unsigned long long>( Statistics.RemoteDeallocations ) );
+            }
+        }
+
+    private:
+        //! Call InFunctor( std::type_identity<TPool>{} ) for each pool [partition 0 of each pool]
+        template<typename TFunctor>
+        static void ForEachPool( TFunctor&& InFunctor ) noexcept
+        {
+            InFunctor( std::type_identity<Pool1>{} );
+            InFunctor( std::type_identity<Pool2>{} );
+            InFunctor( std::type_identity<Pool3>{} );
+            InFunctor( std::type_identity<Pool4>{} );
+            InFunctor( std::type_identity<Pool5>{} );
+            InFunctor( std::type_identity<Pool6>{} );
+            TSizeClasses::ForEachClass( [&InFunctor]( auto InClassIndex ) noexcept -> void
+            {
+                InFunctor( std::type_identity<TSizeClassPool<decltype( InClassIndex )::value>>{} );
+            } );
+        }
+
+        template<size_t... ClassIndices>
+        SKL_FORCEINLINE SKL_NODISCARD static bool IsOwnedBySizeClassPools( const void* InPointer, std::index_sequence<ClassIndices...> ) noexcept
+        {
+            return ( false || ... || TSizeClassPool<ClassIndices>::IsOwnedByPartitions( InPointer ) );
+        }
+
+        //! Allocate block from TPool, through the calling thread's magazine if the pool is cached
+        template<typename TPool>
+        SKL_FORCEINLINE static void* AllocateFromPool() noexcept;
+
+        //! Deallocate block to TPool, through the calling thread's magazine if the pool is cached
+        template<typename TPool>
+        SKL_FORCEINLINE static void DeallocateToPool( void* InPointer ) noexcept;
+
+    public:
         // Stats variables
         SKL_IFMEMORYSTATS( SKL_CACHE_ALIGNED static std::atomic<size_t> CustomSizeAllocations   );
         SKL_IFMEMORYSTATS( SKL_CACHE_ALIGNED static std::atomic<size_t> CustomSizeDeallocations );
         SKL_IFMEMORYSTATS( SKL_CACHE_ALIGNED static std::atomic<size_t> TotalAllocations        );
         SKL_IFMEMORYSTATS( SKL_CACHE_ALIGNED static std::atomic<size_t> TotalDeallocations      );
+        SKL_IFMEMORYSTATS( SKL_CACHE_ALIGNED static std::atomic<size_t> NumaRemoteDeallocations[CMemoryManager_MaxNumaNodes] );
+
+        SKL_CACHE_ALIGNED static inline TSizeClassesStatistics SizeClassesStats{};
+
+        // Trimming
+        SKL_CACHE_ALIGNED static inline std::atomic<TEpochTimePoint> NextTrimSample{ 0U };
+        SKL_CACHE_ALIGNED static inline SpinLock                     TrimLock{};
 
 #if defined(SKL_DEBUG_MEMORY_ALLOCATORS)
         static inline std::mutex                         AllocationsMutex;
@@ -617,6 +1117,252 @@ namespace SKL
 #endif
     };
 
+    //! Per thread stack (magazine) of free blocks of one SkylakeGlobalMemoryManager pool
+    //! \remarks Refilled from and flushed to the pool in batches of CMemoryManager_ThreadCacheBatchSize, so the pool is locked once per batch instead of once per operation
+    //! \remarks If CMemoryManager_UseNumaPartitions is true the magazine is bound to the pool partition of its thread's NUMA node
+    template<typename TObjectPool>
+    struct GlobalMemoryMagazine
+    {
+        static constexpr uint32_t Capacity  = CMemoryManager_ThreadCacheSize;
+        static constexpr uint32_t BatchSize = CMemoryManager_ThreadCacheBatchSize;
+
+        static_assert( Capacity <= TObjectPool::PoolTraits::MyPoolSize, "The magazine can't be larger than its pool" );
+
+        GlobalMemoryMagazine() noexcept = default;
+        GlobalMemoryMagazine( PoolBatchFunctions InPartitionBatchFunctions ) noexcept
+            : PartitionBatchFunctions{ InPartitionBatchFunctions } {}
+        ~GlobalMemoryMagazine() noexcept
+        {
+            Flush();
+        }
+
+        // Can't copy or move
+        GlobalMemoryMagazine( const GlobalMemoryMagazine& ) = delete;
+        GlobalMemoryMagazine& operator=( const GlobalMemoryMagazine& ) = delete;
+        GlobalMemoryMagazine( GlobalMemoryMagazine&& ) = delete;
+        GlobalMemoryMagazine& operator=( GlobalMemoryMagazine&& ) = delete;
+
+        //! Pop a block, refill the magazine from the pool if empty
+        SKL_FORCEINLINE SKL_NODISCARD void* Allocate() noexcept
+        {
+            if( 0U == Count ) SKL_UNLIKELY
+            {
+                Count = static_cast<uint32_t>( AllocateBatch( Blocks, BatchSize ) );
+                if( 0U == Count ) SKL_UNLIKELY
+                {
+                    return nullptr;
+                }
+            }
+
+            return Blocks[--Count];
+        }
+
+        //! Push a block, flush the oldest batch of blocks to the pool if full
+        SKL_FORCEINLINE void Deallocate( void* InBlock ) noexcept
+        {
+            if( Capacity == Count ) SKL_UNLIKELY
+            {
+                // the most recently freed blocks are kept, they are the most likely to still be in the cache
+                DeallocateBatch( Blocks, BatchSize );
+                ( void )memmove( Blocks, Blocks + BatchSize, sizeof( void* ) * ( Capacity - BatchSize ) );
+                Count -= BatchSize;
+            }
+
+            Blocks[Count++] = InBlock;
+        }
+
+        //! Return all blocks to the pool
+        void Flush() noexcept
+        {
+            if( 0U != Count )
+            {
+                DeallocateBatch( Blocks, Count );
+                Count = 0U;
+            }
+        }
+
+        //! Number of blocks cached
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t GetCount() const noexcept { return Count; }
+
+    private:
+        SKL_FORCEINLINE size_t AllocateBatch( void** OutBlocks, size_t InCount ) const noexcept
+        {
+            if constexpr( CMemoryManager_UseNumaPartitions )
+            {
+                return PartitionBatchFunctions.AllocateBatch( OutBlocks, InCount );
+            }
+            else
+            {
+                return TObjectPool::AllocateBatch( OutBlocks, InCount );
+            }
+        }
+
+        SKL_FORCEINLINE void DeallocateBatch( void** InOutBlocks, size_t InCount ) const noexcept
+        {
+            if constexpr( CMemoryManager_UseNumaPartitions )
+            {
+                PartitionBatchFunctions.DeallocateBatch( InOutBlocks, InCount );
+            }
+            else
+            {
+                TObjectPool::DeallocateBatch( InOutBlocks, InCount );
+            }
+        }
+
+        PoolBatchFunctions PartitionBatchFunctions{ &TObjectPool::AllocateBatch, &TObjectPool::DeallocateBatch };
+        uint32_t           Count{ 0U };
+        void*              Blocks[Capacity];
+    };
+
+    //! Per thread magazines in front of the SkylakeGlobalMemoryManager pools with blocks up to CMemoryManager_ThreadCacheMaxBlockSize
+    //! \remarks Created and destroyed by Skylake_InitializeLibrary_Thread()/Skylake_TerminateLibrary_Thread(), threads without an instance use the pools directly
+    struct GlobalMemoryThreadCache final : public ITLSSingleton<GlobalMemoryThreadCache>
+    {
+        using Pool1 = SkylakeGlobalMemoryManager::Pool1;
+        using Pool2 = SkylakeGlobalMemoryManager::Pool2;
+        using Pool3 = SkylakeGlobalMemoryManager::Pool3;
+        using Pool4 = SkylakeGlobalMemoryManager::Pool4;
+
+        const char *GetName() const noexcept override
+        { 
+            return "[GlobalMemoryThreadCache]"; 
+        }
+
+        //! Get the magazine for TPool
+        template<typename TPool>
+        SKL_FORCEINLINE SKL_NODISCARD auto& GetMagazine() noexcept
+        {
+            if constexpr( std::is_same_v<TPool, Pool1> )
+            {
+                return Magazine1;
+            }
+            else if constexpr( std::is_same_v<TPool, Pool2> )
+            {
+                return Magazine2;
+            }
+            else if constexpr( std::is_same_v<TPool, Pool3> )
+            {
+                return Magazine3;
+            }
+            else
+            {
+                static_assert( std::is_same_v<TPool, Pool4>, "GlobalMemoryThreadCache only caches Pool1-Pool4" );
+                return Magazine4;
+            }
+        }
+
+        //! Return all cached blocks to the pools
+        void Flush() noexcept
+        {
+            Magazine1.Flush();
+            Magazine2.Flush();
+            Magazine3.Flush();
+            Magazine4.Flush();
+        }
+
+        //! Get the pools partition of this thread [NUMA node the thread was running on when the cache was created]
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t GetNumaPartition() const noexcept { return NumaPartition; }
+
+    private:
+        const uint32_t                           NumaPartition{ SkylakeGlobalMemoryManager::GetCurrentNumaPartition() };
+        GlobalMemoryMagazine<Pool1::TObjectPool> Magazine1{ Pool1::GetPartitionBatchFunctions( NumaPartition ) };
+        GlobalMemoryMagazine<Pool2::TObjectPool> Magazine2{ Pool2::GetPartitionBatchFunctions( NumaPartition ) };
+        GlobalMemoryMagazine<Pool3::TObjectPool> Magazine3{ Pool3::GetPartitionBatchFunctions( NumaPartition ) };
+        GlobalMemoryMagazine<Pool4::TObjectPool> Magazine4{ Pool4::GetPartitionBatchFunctions( NumaPartition ) };
+    };
+
+    inline void SkylakeGlobalMemoryManager::FlushThreadCache() noexcept
+    {
+        if constexpr( CMemoryManager_UseThreadCache )
+        {
+            if( auto* Cache{ GlobalMemoryThreadCache::GetInstance() }; nullptr != Cache )
+            {
+                Cache->Flush();
+            }
+        }
+    }
+
+    inline uint32_t SkylakeGlobalMemoryManager::GetThreadNumaPartition() noexcept
+    {
+        if constexpr( CMemoryManager_UseNumaPartitions )
+        {
+            if( auto* Cache{ GlobalMemoryThreadCache::GetInstance() }; nullptr != Cache ) SKL_LIKELY
+            {
+                return Cache->GetNumaPartition();
+            }
+
+            return GetCurrentNumaPartition();
+        }
+        else
+        {
+            return 0U;
+        }
+    }
+
+    template<typename TPool>
+    SKL_FORCEINLINE void* SkylakeGlobalMemoryManager::AllocateFromPool() noexcept
+    {
+        if constexpr( TPool::bUseThreadCache )
+        {
+            if( auto* Cache{ GlobalMemoryThreadCache::GetInstance() }; nullptr != Cache ) SKL_LIKELY
+            {
+                return Cache->template GetMagazine<TPool>().Allocate();
+            }
+        }
+
+        if constexpr( CMemoryManager_UseNumaPartitions )
+        {
+            return TPool::AllocateFromPartition( GetThreadNumaPartition() );
+        }
+        else
+        {
+            return reinterpret_cast<void*>( TPool::TObjectPool::Allocate() );
+        }
+    }
+
+    template<typename TPool>
+    SKL_FORCEINLINE void SkylakeGlobalMemoryManager::DeallocateToPool( void* InPointer ) noexcept
+    {
+        if constexpr( CMemoryManager_UseNumaPartitions )
+        {
+            auto*          Cache          { GlobalMemoryThreadCache::GetInstance() };
+            const uint32_t ThreadPartition{ nullptr != Cache ? Cache->GetNumaPartition() : GetCurrentNumaPartition() };
+            const uint32_t HomePartition  { TPool::GetHomeNumaNode( InPointer ) };
+
+            if( CNoNumaNode != HomePartition && ThreadPartition != HomePartition ) SKL_UNLIKELY
+            {
+                // the block goes back to its home node, it must not be reused by the threads of this node
+                SKL_IFMEMORYSTATS( ++NumaRemoteDeallocations[HomePartition] );
+                TPool::DeallocateToPartition( HomePartition, InPointer );
+                return;
+            }
+
+            if constexpr( TPool::bUseThreadCache )
+            {
+                if( nullptr != Cache ) SKL_LIKELY
+                {
+                    Cache->template GetMagazine<TPool>().Deallocate( InPointer );
+                    return;
+                }
+            }
+
+            TPool::DeallocateToPartition( ThreadPartition, InPointer );
+        }
+        else
+        {
+            if constexpr( TPool::bUseThreadCache )
+            {
+                if( auto* Cache{ GlobalMemoryThreadCache::GetInstance() }; nullptr != Cache ) SKL_LIKELY
+                {
+                    Cache->template GetMagazine<TPool>().Deallocate( InPointer );
+                    return;
+                }
+            }
+
+            TPool::TObjectPool::Deallocate( reinterpret_cast<typename TPool::TMemoryBlock*>( InPointer ) );
+        }
+    }
+
     // GlobalMemoryManager - Override here if the global memory manager must be changed
     using GlobalMemoryManager = SkylakeGlobalMemoryManager;
 }
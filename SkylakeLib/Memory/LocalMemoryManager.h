@@ -85,15 +85,25 @@ namespace SKL
                , size_t TBlockCount
                , bool bThreadSafe             = StaticConfig::bIsThreadSafe
                , bool bUseSpinLock_Or_Atomics = StaticConfig::bUseSpinLock_Or_Atomics
-               , size_t Alignment             = MemoryBlockAlignment> 
+               , size_t Alignment             = MemoryBlockAlignment
+               , bool bUseSlab                = StaticConfig::bUseSlabPreallocation
+               , bool bUseLargePages          = StaticConfig::bUseLargePages> 
         struct MemoryPool
         {
             static constexpr size_t BlockSize  = TBlockSize;
             static constexpr size_t BlockCount = TBlockCount;
             using TMemoryBlock                 = MemoryBlock<BlockSize>;
-            using TObjectPool                  = LocalObjectPool<TMemoryBlock, BlockCount, false == bThreadSafe, bUseSpinLock_Or_Atomics, false, false, Alignment>;    
+            using TObjectPool                  = LocalObjectPool<TMemoryBlock, BlockCount, false == bThreadSafe, bUseSpinLock_Or_Atomics, false, false, Alignment, bUseSlab, bUseLargePages>;    
             
-            TObjectPool Pool{};  
+            TObjectPool    Pool{};  
+            PoolTrimPolicy TrimPolicy{};
+
+            //! Sample the pool and return the memory of its idle blocks to the OS at the end of each trim window
+            //! \returns the number of bytes returned to the OS
+            SKL_FORCEINLINE size_t Trim( TEpochTimePoint InNow ) noexcept
+            {
+                return TrimPool<BlockSize, BlockCount>( Pool, TrimPolicy, InNow );
+            }
         };        
 
         struct AllocResult
@@ -119,6 +129,17 @@ namespace SKL
         using TPool6 = MemoryPool<TStaticConfig::Pool6_BlockSize, TStaticConfig::Pool6_BlockCount>;
         using TProfilingData = std::conditional_t<EnableProfiling, LocalMemoryManagerProfiling, LocalMemoryManagerProfilingDummy>;
 
+        // Size classes [between Pool4 and Pool5]
+        using TSizeClasses = SizeClassesTable<TStaticConfig::Pool4_BlockSize
+                                            , TStaticConfig::bUseSizeClasses ? TStaticConfig::SizeClassesCount : 0U
+                                            , TStaticConfig::SizeClassesSpacingPercent>;
+        template<size_t TClassIndex>
+        using TSizeClassPool          = MemoryPool<TSizeClasses::Sizes[TClassIndex], TSizeClasses::GetBlockCount( TClassIndex, TStaticConfig::SizeClassPoolBytes )>;
+        using TSizeClassesPools       = typename SizeClassesPools<TSizeClasses, TSizeClassPool>::Type;
+        using TSizeClassesStatistics  = SizeClassesStatistics<TSizeClasses, StaticConfig::bIsThreadSafe>;
+
+        static_assert( TSizeClasses::MaxSize < TStaticConfig::Pool5_BlockSize, "The size classes must fit between Pool4 and Pool5" );
+
         //! Preallocate all pools
         RStatus Preallocate() noexcept
         {
@@ -153,8 +174,42 @@ namespace SKL
                 return RFail;
             }
 
+            bool bSizeClassesPreallocated{ true };
+            ForEachSizeClassPool( [this, &bSizeClassesPreallocated]( auto& InPool ) noexcept -> void
+            {
+                if( RSuccess != InPool.Pool.Preallocate() ) SKL_UNLIKELY
+                {
+                    GLOG_FATAL( "LocalMemoryManager[%ws]::Preallocate() -> Failed to Preallocate SizeClass[%llu bytes]", Name, static_cast<unsigned long long>( std::remove_cvref_t<decltype( InPool )>::BlockSize ) );
+                    bSizeClassesPreallocated = false;
+                }
+            } );
+            if( false == bSizeClassesPreallocated ) SKL_UNLIKELY
+            {
+                return RFail;
+            }
+
             GLOG_DEBUG( "LocalMemoryManager[%ws] ALL POOLS PREALLOCATED!", Name );
 
+            if constexpr( StaticConfig::bUseLargePages )
+            {
+                GLOG_INFO( "LocalMemoryManager[%ws] large pages: Pool1[%s] Pool2[%s] Pool3[%s] Pool4[%s] Pool5[%s] Pool6[%s]"
+                         , Name
+                         , Pool1.Pool.IsSlabOnLargePages() ? "yes" : "no"
+                         , Pool2.Pool.IsSlabOnLargePages() ? "yes" : "no"
+                         , Pool3.Pool.IsSlabOnLargePages() ? "yes" : "no"
+                         , Pool4.Pool.IsSlabOnLargePages() ? "yes" : "no"
+                         , Pool5.Pool.IsSlabOnLargePages() ? "yes" : "no"
+                         , Pool6.Pool.IsSlabOnLargePages() ? "yes" : "no" );
+
+                ForEachSizeClassPool( [this]( auto& InPool ) noexcept -> void
+                {
+                    GLOG_INFO( "LocalMemoryManager[%ws] large pages: SizeClass[%llu bytes][%s]"
+                             , Name
+                             , static_cast<unsigned long long>( std::remove_cvref_t<decltype( InPool )>::BlockSize )
+                             , InPool.Pool.IsSlabOnLargePages() ? "yes" : "no" );
+                } );
+            }
+
             return RSuccess;
         }
 
@@ -166,9 +221,12 @@ namespace SKL
             Pool4.Pool.FreePool();
             Pool5.Pool.FreePool();
             Pool6.Pool.FreePool();
+
+            ForEachSizeClassPool( []( auto& InPool ) noexcept -> void { InPool.Pool.FreePool(); } );
         }
 
         //! Zero memory all pools, this will force the OS to have the all pages ready in memory (hot)
+        //! \remarks Slabs backed by large pages are already resident and are skipped
         void ZeroAllMemory( ) noexcept
         {
             Pool1.Pool.ZeroAllMemory();
@@ -177,6 +235,20 @@ namespace SKL
             Pool4.Pool.ZeroAllMemory();
             Pool5.Pool.ZeroAllMemory();
             Pool6.Pool.ZeroAllMemory();
+
+            ForEachSizeClassPool( []( auto& InPool ) noexcept -> void { InPool.Pool.ZeroAllMemory(); } );
+        }
+
+        //! Is the memory block carved out of one of the pools slabs [always false if StaticConfig::bUseSlabPreallocation is false]
+        SKL_FORCEINLINE SKL_NODISCARD bool IsOwnedByPools( const void* InPointer ) const noexcept
+        {
+            return Pool1.Pool.IsOwnedBySlab( InPointer )
+                || Pool2.Pool.IsOwnedBySlab( InPointer )
+                || Pool3.Pool.IsOwnedBySlab( InPointer )
+                || Pool4.Pool.IsOwnedBySlab( InPointer )
+                || Pool5.Pool.IsOwnedBySlab( InPointer )
+                || Pool6.Pool.IsOwnedBySlab( InPointer )
+                || std::apply( [InPointer]( const auto&... InPools ) noexcept -> bool { return ( false || ... || InPools.Pool.IsOwnedBySlab( InPointer ) ); }, SizeClassPools );
         }
         
         //! Allocate new memory block with the size known at compile time
@@ -249,6 +321,15 @@ namespace SKL
                 if constexpr( CHasProfilingFlag( ELocalMemoryManagerProfilingFlags::Count_PoolAllocations ) )
                     ProfilingData.template IncrementAllocationForPool<ELocalMemoryManagerSourceType::Pool4>();
             }
+            else if constexpr( TSizeClasses::IsInRange( AllocateSize ) )
+            {
+                constexpr size_t ClassIndex = TSizeClasses::template ClassIndexOf<AllocateSize>;
+
+                Result.MemoryBlockSize = TSizeClasses::Sizes[ClassIndex];
+                Result.MemoryBlock     = reinterpret_cast<void*>( std::get<ClassIndex>( SizeClassPools ).Pool.Allocate() );
+
+                SizeClassesStats.OnAllocation( ClassIndex, AllocateSize );
+            }
             else if constexpr( AllocateSize <= TStaticConfig::Pool5_BlockSize )
             {
                 Result.MemoryBlockSize = TStaticConfig::Pool5_BlockSize;
@@ -313,6 +394,7 @@ namespace SKL
 #endif
 
             SKL_IFMEMORYSTATS( ++TotalAllocations );
+            SKL_IFMEMORYSITEPROFILER( AllocationSiteProfiler::OnAllocation( SKL_RETURN_ADDRESS(), Result.MemoryBlock, AllocateSize, Result.MemoryBlockSize ) );
 
             #endif
             return Result;
@@ -391,6 +473,18 @@ namespace SKL
                 if constexpr( CHasProfilingFlag( ELocalMemoryManagerProfilingFlags::Count_PoolAllocations ) )
                     ProfilingData.template IncrementAllocationForPool<ELocalMemoryManagerSourceType::Pool4>();
             }
+            else if ( TSizeClasses::IsInRange( AllocateSize ) )
+            {
+                const size_t ClassIndex{ TSizeClasses::GetClassIndex( AllocateSize ) };
+
+                TSizeClasses::VisitClass( ClassIndex, [this, &Result]( auto InClassIndex ) noexcept -> void
+                {
+                    Result.MemoryBlock = reinterpret_cast<void*>( std::get<decltype( InClassIndex )::value>( SizeClassPools ).Pool.Allocate() );
+                } );
+                Result.MemoryBlockSize = TSizeClasses::Sizes[ClassIndex];
+
+                SizeClassesStats.OnAllocation( ClassIndex, AllocateSize );
+            }
             else if ( AllocateSize <= TStaticConfig::Pool5_BlockSize )
             {
                 Result.MemoryBlockSize = TStaticConfig::Pool5_BlockSize;
@@ -456,6 +550,7 @@ namespace SKL
 #endif
 
             SKL_IFMEMORYSTATS( ++TotalAllocations );
+            SKL_IFMEMORYSITEPROFILER( AllocationSiteProfiler::OnAllocation( SKL_RETURN_ADDRESS(), Result.MemoryBlock, AllocateSize, Result.MemoryBlockSize ) );
 
             #endif
 
@@ -467,6 +562,7 @@ namespace SKL
         void Deallocate( void* InPointer ) noexcept 
         {
             SKL_ASSERT( 0 == ( ( uintptr_t )InPointer ) % MemoryBlockAlignment );
+            SKL_IFMEMORYSITEPROFILER( AllocationSiteProfiler::OnDeallocation( InPointer ) );
 #if defined(SKL_DEBUG_MEMORY_ALLOCATORS)
             {
                 if constexpr( true == StaticConfig::bIsThreadSafe )
@@ -511,6 +607,11 @@ namespace SKL
             {
                 Pool4.Pool.Deallocate( reinterpret_cast<TPool4::TMemoryBlock*>( InPointer ) );
             }
+            else if constexpr( TSizeClasses::IsInRange( AllocateSize ) )
+            {
+                constexpr size_t ClassIndex = TSizeClasses::template ClassIndexOf<AllocateSize>;
+                std::get<ClassIndex>( SizeClassPools ).Pool.Deallocate( reinterpret_cast<typename TSizeClassPool<ClassIndex>::TMemoryBlock*>( InPointer ) );
+            }
             else if constexpr( AllocateSize <= TStaticConfig::Pool5_BlockSize )
             {
                 Pool5.Pool.Deallocate( reinterpret_cast<TPool5::TMemoryBlock*>( InPointer ) );
@@ -532,6 +633,7 @@ namespace SKL
         void Deallocate( void* InPointer, size_t AllocateSize ) noexcept 
         {
             SKL_ASSERT( 0 == ( ( uintptr_t )InPointer ) % MemoryBlockAlignment );
+            SKL_IFMEMORYSITEPROFILER( AllocationSiteProfiler::OnDeallocation( InPointer ) );
 #if defined(SKL_DEBUG_MEMORY_ALLOCATORS)
             {
                 if constexpr( true == StaticConfig::bIsThreadSafe )
@@ -576,6 +678,14 @@ namespace SKL
             {
                 Pool4.Pool.Deallocate( reinterpret_cast<TPool4::TMemoryBlock*>( InPointer ) );
             }
+            else if( TSizeClasses::IsInRange( AllocateSize ) )
+            {
+                TSizeClasses::VisitClass( TSizeClasses::GetClassIndex( AllocateSize ), [this, InPointer]( auto InClassIndex ) noexcept -> void
+                {
+                    using TClassPool = TSizeClassPool<decltype( InClassIndex )::value>;
+                    std::get<decltype( InClassIndex )::value>( SizeClassPools ).Pool.Deallocate( reinterpret_cast<typename TClassPool::TMemoryBlock*>( InPointer ) );
+                } );
+            }
             else if( AllocateSize <= TStaticConfig::Pool5_BlockSize )
             {
                 Pool5.Pool.Deallocate( reinterpret_cast<TPool5::TMemoryBlock*>( InPointer ) );
@@ -689,15 +799,74 @@ namespace SKL
             GLOG_DEBUG( "LocalMemoryManager[%ws]::LogStatistics()\n\t\tTried to log memory statistics, but the LocalMemoryManager has the statistics turned off!", Name );
 #endif
         }
+
+        //! Sample all pools and return the memory of their idle blocks to the OS [see PoolTrimPolicy]
+        //! \remarks Cheap to call every tick, the pools are sampled at most once every CMemoryManager_TrimSampleIntervalMs
+        //! \remarks Must be called by the thread that owns the manager (or under the same sync the pools use)
+        //! \returns the number of bytes returned to the OS
+        size_t TickTrimming( TEpochTimePoint InNow ) noexcept
+        {
+            if constexpr( false == StaticConfig::bUsePoolTrimming || false == StaticConfig::bUseSlabPreallocation )
+            {
+                ( void )InNow;
+                return 0U;
+            }
+            else
+            {
+                if( InNow < NextTrimSample ) SKL_LIKELY
+                {
+                    return 0U;
+                }
+                NextTrimSample = InNow + CMemoryManager_TrimSampleIntervalMs;
+
+                size_t TrimmedBytes{ 0U };
+                TrimmedBytes += Pool1.Trim( InNow );
+                TrimmedBytes += Pool2.Trim( InNow );
+                TrimmedBytes += Pool3.Trim( InNow );
+                TrimmedBytes += Pool4.Trim( InNow );
+                TrimmedBytes += Pool5.Trim( InNow );
+                TrimmedBytes += Pool6.Trim( InNow );
+                ForEachSizeClassPool( [InNow, &TrimmedBytes]( auto& InPool ) noexcept -> void { TrimmedBytes += InPool.Trim( InNow ); } );
+
+                if( 0U != TrimmedBytes )
+                {
+                    GLOG_DEBUG( "LocalMemoryManager[%ws]::TickTrimming() Returned %llu bytes to the OS", Name, static_cast<unsigned long long>( TrimmedBytes ) );
+                }
+
+                return TrimmedBytes;
+            }
+        }
+
+        //! Log the fragmentation report of each size class
+        SKL_FORCEINLINE void LogSizeClassesReport() const noexcept
+        {
+            SizeClassesStats.LogReport( Name );
+        }
+
+        //! Get the per size class allocation statistics
+        SKL_FORCEINLINE SKL_NODISCARD const TSizeClassesStatistics& GetSizeClassesStatistics() const noexcept
+        {
+            return SizeClassesStats;
+        }
+
+        //! Call InFunctor( Pool ) for each size class pool
+        template<typename TFunctor>
+        SKL_FORCEINLINE void ForEachSizeClassPool( TFunctor&& InFunctor ) noexcept
+        {
+            std::apply( [&InFunctor]( auto&... InPools ) noexcept -> void { ( InFunctor( InPools ), ... ); }, SizeClassPools );
+        }
         
-        TPool1         Pool1{};
-        TPool2         Pool2{};
-        TPool3         Pool3{};
-        TPool4         Pool4{};
-        TPool5         Pool5{};
-        TPool6         Pool6{};
-        TProfilingData ProfilingData;
-        const wchar_t* Name { TStaticConfig::PoolName };
+        TPool1                 Pool1{};
+        TPool2                 Pool2{};
+        TPool3                 Pool3{};
+        TPool4                 Pool4{};
+        TPool5                 Pool5{};
+        TPool6                 Pool6{};
+        TSizeClassesPools      SizeClassPools{};
+        TSizeClassesStatistics SizeClassesStats{};
+        TProfilingData         ProfilingData;
+        TEpochTimePoint        NextTrimSample{ 0U };
+        const wchar_t*         Name { TStaticConfig::PoolName };
         
         // Stats variables
         SKL_IFMEMORYSTATS( alignas( InternalAlignment ) TStatisticsValue CustomSizeAllocations  { 0 }; );
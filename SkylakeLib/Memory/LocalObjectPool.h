@@ -9,13 +9,19 @@
 //!         bUseSpinLock:
 //!             [true] : SpinLock is used for thread synchronization [default]
 //!             [false]: Atomic operations are used for thread synchronization (might spill when under heavy contention)
+//!         bUseSlab:
+//!             [true] : Preallocate() reserves one contiguous region (slab) and carves all the pool blocks out of it, FreePool() releases it in one call
+//!             [false]: Preallocate() allocates each pool block separately [default]
+//!         bUseLargePages:
+//!             [true] : The slab is backed by large (huge) pages if possible, falls back to regular pages [requires bUseSlab]
+//!             [false]: The slab is allocated with SKL_MALLOC_ALIGNED [default]
 //!         
 //! \author Balan Narcis (balannarcis96@gmail.com)
 //! 
 
 namespace SKL
 {
-    template<typename T, size_t PoolSize, bool TbNoSync = false, bool TbUseSpinLock = true, bool TbPerformConstruction = true, bool TbPerformDestruction = true, size_t TAlignment = SKL_ALIGNMENT>
+    template<typename T, size_t PoolSize, bool TbNoSync = false, bool TbUseSpinLock = true, bool TbPerformConstruction = true, bool TbPerformDestruction = true, size_t TAlignment = SKL_ALIGNMENT, bool TbUseSlab = false, bool TbUseLargePages = false>
     class LocalObjectPool
     {
     public:
@@ -30,6 +36,11 @@ namespace SKL
             static constexpr bool   bUseSpinLock        { true == bNoSync || true == TbUseSpinLock };
             static constexpr bool   bPerformConstruction{ TbPerformConstruction };
             static constexpr bool   bPerformDestruction { TbPerformDestruction };
+            static constexpr bool   bUseSlab            { TbUseSlab };
+            static constexpr bool   bUseLargePages      { TbUseSlab && TbUseLargePages };
+            static constexpr size_t SlabBlockSize       { ( ( MyObjectSize + Alignment - 1 ) / Alignment ) * Alignment };
+            static constexpr size_t SlabSize            { SlabBlockSize * MyPoolSize };
+            static constexpr ESlabSource SlabSource     { bUseLargePages ? ESlabSource::LargePages : ESlabSource::Heap };
 
             using MyPoolType       = T;
             using MyType           = ObjectPool<T, PoolSize>;
@@ -45,6 +56,37 @@ namespace SKL
         //! Preallocate and fill the whole Pool with [PoolSize] elements
         constexpr RStatus Preallocate() noexcept
         {
+            if constexpr( PoolTraits::bUseSlab )
+            {
+                SKL_ASSERT( nullptr == Slab );
+
+                // one allocation for the whole pool, the blocks are carved out of it
+                if constexpr( PoolTraits::bUseLargePages )
+                {
+                    Slab = reinterpret_cast<uint8_t*>( GAllocLargePages( PoolTraits::SlabSize, bIsSlabOnLargePages ) );
+                }
+                else
+                {
+                    Slab = reinterpret_cast<uint8_t*>( SKL_MALLOC_ALIGNED( PoolTraits::SlabSize, PoolTraits::Alignment ) );
+                }
+
+                if( nullptr == Slab ) SKL_UNLIKELY
+                {
+                    return RFail;
+                }
+
+                SKL_IFSHIPPING( memset( Slab, 0, PoolTraits::SlabSize ) );
+
+                for( size_t i = 0; i < PoolSize; i++ )
+                {
+                    Pool[i] = reinterpret_cast<void*>( Slab + ( i * PoolTraits::SlabBlockSize ) );
+                }
+
+                SlabRegistry::Register( Slab, PoolTraits::SlabSize );
+
+                return RSuccess;
+            }
+
             // ! Hopefully SKL_MALLOC_ALIGNED will allocate in a continuous fashion.
             for( size_t i = 0; i < PoolSize; i++ )
             {
@@ -62,8 +104,11 @@ namespace SKL
         }
 
         //! Safely free all pool blocks
+        //! \remarks If some of the slab blocks are still in use the slab is freed only after the last of them is deallocated [see SlabRegistry]
         constexpr void FreePool() noexcept
         {
+            size_t CachedSlabBlocks{ 0U };
+
             if constexpr ( false == PoolTraits::bNoSync )
             {
                 if constexpr( true == PoolTraits::bUseSpinLock )
@@ -77,7 +122,7 @@ namespace SKL
                             Pool[i] = nullptr;
                             if( nullptr != PopValue )
                             {
-                                SKL_FREE_SIZE_ALIGNED( PopValue, PoolTraits::MyObjectSize, PoolTraits::Alignment );
+                                FreeCachedBlock( PopValue, CachedSlabBlocks );
                             }
                         }
                     }
@@ -89,7 +134,7 @@ namespace SKL
                         auto* PopValue = Pool[i].exchange( nullptr );
                         if( nullptr != PopValue )
                         {
-                            SKL_FREE_SIZE_ALIGNED( PopValue, PoolTraits::MyObjectSize, PoolTraits::Alignment );
+                            FreeCachedBlock( PopValue, CachedSlabBlocks );
                         }
                     }
                 }
@@ -102,11 +147,24 @@ namespace SKL
                     Pool[i] = nullptr;
                     if( nullptr != PopValue )
                     {
-                        SKL_FREE_SIZE_ALIGNED( PopValue, PoolTraits::MyObjectSize, PoolTraits::Alignment );
+                        FreeCachedBlock( PopValue, CachedSlabBlocks );
                     }
                 }
             }
 
+            if constexpr( PoolTraits::bUseSlab )
+            {
+                if( nullptr != Slab )
+                {
+                    // all the slab blocks are released at once, when the last block in use is deallocated if any
+                    SKL_ASSERT( CachedSlabBlocks <= PoolSize );
+                    SlabRegistry::Release( Slab, PoolTraits::SlabSize, PoolTraits::Alignment, PoolTraits::SlabSource, PoolSize - CachedSlabBlocks );
+
+                    Slab                = nullptr;
+                    bIsSlabOnLargePages = false;
+                }
+            }
+
 #if defined(SKL_MEMORY_STATISTICS) 
             TotalAllocations     = 0;
             TotalDeallocations   = 0;
@@ -129,8 +187,22 @@ namespace SKL
         }
 
         //! Zero all pool items [not thread safe]
+        //! \remarks When slab backed the whole slab is zeroed in one go, call it before any block is handed out
         constexpr void ZeroAllMemory() noexcept
         {
+            if constexpr( PoolTraits::bUseSlab )
+            {
+                if( nullptr != Slab )
+                {
+                    // large pages are resident and zeroed from the moment they are allocated, no need to touch them
+                    if( false == bIsSlabOnLargePages )
+                    {
+                        memset( Slab, 0, PoolTraits::SlabSize );
+                    }
+                    return;
+                }
+            }
+
             for( size_t i = 0; i < PoolSize; i++ )
             {
                 memset( Pool[i], 0, sizeof( T ) );
@@ -143,6 +215,88 @@ namespace SKL
             return reinterpret_cast<size_t>( &PoolTraits::MyType::Preallocate );
         }
 
+        //! Is the block carved out of this pool's slab
+        //! \remarks Simple range check, always false if the pool is not slab backed or the slab is not allocated
+        SKL_FORCEINLINE SKL_NODISCARD constexpr bool IsOwnedBySlab( const void* InBlock ) const noexcept
+        {
+            if constexpr( PoolTraits::bUseSlab )
+            {
+                return nullptr != Slab && ( reinterpret_cast<uintptr_t>( InBlock ) - reinterpret_cast<uintptr_t>( Slab ) ) < PoolTraits::SlabSize;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        //! Get the start of the slab [nullptr if the pool is not slab backed or the slab is not allocated]
+        SKL_FORCEINLINE SKL_NODISCARD constexpr void* GetSlab() const noexcept { return Slab; }
+
+        //! Is the slab backed by large (huge) pages
+        SKL_FORCEINLINE SKL_NODISCARD constexpr bool IsSlabOnLargePages() const noexcept { return bIsSlabOnLargePages; }
+
+        //! Can the pool return the physical memory of its idle blocks to the OS [see DiscardColdBlocks()]
+        SKL_FORCEINLINE SKL_NODISCARD constexpr bool SupportsTrimming() const noexcept
+        {
+            if constexpr( PoolTraits::bUseSlab && PoolTraits::bUseSpinLock )
+            {
+                // large pages are locked in memory
+                return nullptr != Slab && false == bIsSlabOnLargePages;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        //! Get the number of blocks cached by the pool [slab backed pools only, the slab provides all the blocks]
+        SKL_NODISCARD size_t GetCachedBlocksCount() noexcept
+        {
+            if constexpr( PoolTraits::bUseSlab && PoolTraits::bUseSpinLock )
+            {
+                SpinLockScopeGuard Guard{ SpinLock };
+                return GetCachedBlocksCountUnsafe();
+            }
+            else
+            {
+                return 0U;
+            }
+        }
+
+        //! Return the physical memory of the InCount least recently used cached blocks to the OS [see GDiscardPages()]
+        //! \remarks The blocks keep their slots in the pool, the next use of a block only faults its pages back in, it is never allocated from the OS again
+        //! \remarks Only the whole pages inside each block are discarded, blocks smaller than a page are left untouched
+        //! \returns the number of bytes discarded
+        size_t DiscardColdBlocks( size_t InCount ) noexcept
+        {
+            if( false == SupportsTrimming() )
+            {
+                return 0U;
+            }
+
+            size_t DiscardedBytes{ 0U };
+
+            if constexpr( PoolTraits::bUseSlab && PoolTraits::bUseSpinLock )
+            {
+                { //Critical section [the blocks must not be handed out while their pages are discarded]
+                    SpinLockScopeGuard Guard{ SpinLock };
+
+                    // the slots right before the tail (in ring order) are the last ones to be handed out again
+                    const size_t Count{ std::min( InCount, GetCachedBlocksCountUnsafe() ) };
+                    for( size_t i = 0; i < Count; ++i )
+                    {
+                        void* Block{ Pool[( TailPosition + PoolSize - 1U - i ) & PoolTraits::MyPoolMask] };
+                        if( nullptr != Block && true == IsOwnedBySlab( Block ) )
+                        {
+                            DiscardedBytes += GDiscardPages( Block, PoolTraits::SlabBlockSize );
+                        }
+                    }
+                }
+            }
+
+            return DiscardedBytes;
+        }
+
 #if defined(SKL_MEMORY_STATISTICS) 
         SKL_FORCEINLINE SKL_NODISCARD constexpr size_t GetTotalDeallocations() noexcept
         {
@@ -192,18 +346,34 @@ namespace SKL
 
                     PrevVal                               = Pool[InsPos & PoolTraits::MyPoolMask];
                     Pool[InsPos & PoolTraits::MyPoolMask] = reinterpret_cast<void*>( Obj );
+
+                    if constexpr( PoolTraits::bUseSlab )
+                    {
+                        if( nullptr != PrevVal ) SKL_UNLIKELY
+                        {
+                            PrevVal = KeepSlabBlockCached( reinterpret_cast<void*>( Obj ), PrevVal, InsPos );
+                        }
+                    }
                 }
             }
             else
             {
                 const uint64_t InsPos{ TailPosition.fetch_add( 1, std::memory_order_relaxed ) };
                 PrevVal = Pool[InsPos & PoolTraits::MyPoolMask].exchange( reinterpret_cast<void*>( Obj ) );
+
+                if constexpr( PoolTraits::bUseSlab )
+                {
+                    if( nullptr != PrevVal ) SKL_UNLIKELY
+                    {
+                        PrevVal = KeepSlabBlockCached( reinterpret_cast<void*>( Obj ), PrevVal, InsPos );
+                    }
+                }
             }
 
             if( nullptr != PrevVal ) SKL_UNLIKELY
             {
                 // stomped over valid pointer, just deallocate to OS
-                SKL_FREE_SIZE_ALIGNED( PrevVal, PoolTraits::MyObjectSize, PoolTraits::Alignment );
+                FreeBlockToOS( PrevVal );
                 SKL_IFMEMORYSTATS( ++TotalOSDeallocations );
                 return;
             }
@@ -224,6 +394,94 @@ namespace SKL
         }
 
     private:
+        SKL_FORCEINLINE SKL_NODISCARD size_t GetCachedBlocksCountUnsafe() const noexcept
+        {
+            const uint64_t Outstanding{ HeadPosition > TailPosition ? HeadPosition - TailPosition : 0U };
+            return Outstanding >= PoolSize ? 0U : static_cast<size_t>( PoolSize - Outstanding );
+        }
+
+        //! Free a block that is no longer cached by the pool [never one of this pool's slab blocks]
+        //! \remarks Only the OS allocated blocks are freed to the OS, blocks of released slabs are counted back by the SlabRegistry
+        SKL_FORCEINLINE constexpr void FreeBlockToOS( void* InBlock ) noexcept
+        {
+            SKL_ASSERT( false == IsOwnedBySlab( InBlock ) );
+            SlabRegistry::FreeBlock( InBlock, PoolTraits::MyObjectSize, PoolTraits::Alignment );
+        }
+
+        //! Free a block popped out of the pool by FreePool(), the slab blocks are only counted [they are released together with the slab]
+        SKL_FORCEINLINE constexpr void FreeCachedBlock( void* InBlock, size_t& OutCachedSlabBlocks ) noexcept
+        {
+            if( true == IsOwnedBySlab( InBlock ) )
+            {
+                ++OutCachedSlabBlocks;
+                return;
+            }
+
+            FreeBlockToOS( InBlock );
+        }
+
+        //! Swap InBlock into the slot at InPosition
+        //! \returns the block previously in the slot
+        SKL_FORCEINLINE void* ExchangeSlot( uint64_t InPosition, void* InBlock ) noexcept
+        {
+            if constexpr( PoolTraits::bUseSpinLock )
+            {
+                void* PrevVal{ Pool[InPosition & PoolTraits::MyPoolMask] };
+                Pool[InPosition & PoolTraits::MyPoolMask] = InBlock;
+                return PrevVal;
+            }
+            else
+            {
+                return Pool[InPosition & PoolTraits::MyPoolMask].exchange( InBlock );
+            }
+        }
+
+        //! Resolve a slot stomped over by a deallocation, the slab blocks must stay cached [there are exactly PoolSize of them, they are never freed to the OS]
+        //! \remarks Must be called under the SpinLock if the pool uses one
+        //! \returns the block to be freed to the OS [nullptr if none]
+        SKL_NODISCARD void* KeepSlabBlockCached( void* InInserted, void* InStomped, uint64_t InPosition ) noexcept
+        {
+            if( false == IsOwnedBySlab( InStomped ) )
+            {
+                return InStomped;
+            }
+
+            if( false == IsOwnedBySlab( InInserted ) )
+            {
+                // put the slab block back, the inserted block goes to the OS instead
+                if constexpr( PoolTraits::bUseSpinLock )
+                {
+                    Pool[InPosition & PoolTraits::MyPoolMask] = InStomped;
+                    return InInserted;
+                }
+                else
+                {
+                    void* Expected{ InInserted };
+                    if( true == Pool[InPosition & PoolTraits::MyPoolMask].compare_exchange_strong( Expected, InStomped, std::memory_order_acq_rel ) )
+                    {
+                        return InInserted;
+                    }
+                }
+            }
+
+            // move the slab block over the next slot not holding a slab block [the slab has exactly PoolSize blocks so there always is one]
+            void* Block{ InStomped };
+            for( size_t i = 1U; i < PoolSize; ++i )
+            {
+                void* Displaced{ ExchangeSlot( InPosition + i, Block ) };
+                if( nullptr == Displaced || false == IsOwnedBySlab( Displaced ) )
+                {
+                    return Displaced;
+                }
+
+                Block = Displaced;
+            }
+
+            // only reachable when racing other deallocations in the lock free mode, the block is leaked and the slab stays allocated
+            SKL_ASSERT_MSG( false, "LocalObjectPool failed to keep a slab block cached" );
+            return nullptr;
+        }
+
         template<typename... TArgs>
         SKL_NODISCARD SKL_FORCEINLINE constexpr T *AllocateImpl( TArgs... Args ) noexcept
         {
@@ -273,6 +531,8 @@ namespace SKL
         alignas( PoolTraits::InternalAlignment ) typename PoolTraits::TPoolTail     TailPosition  { 0U };
         alignas( PoolTraits::InternalAlignment ) typename PoolTraits::TPoolPtr      Pool[PoolSize]{};
         alignas( PoolTraits::InternalAlignment ) typename PoolTraits::TPoolSpinLock SpinLock      {};
+        uint8_t*                                                                    Slab          { nullptr };
+        bool                                                                        bIsSlabOnLargePages{ false };
  
 #if defined(SKL_MEMORY_STATISTICS) 
         alignas( PoolTraits::InternalAlignment ) typename PoolTraits::TStatisticsValue TotalAllocations    { 0U };
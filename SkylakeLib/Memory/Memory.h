@@ -151,13 +151,20 @@ namespace std
     }
 }
 
+#include "SlabRegistry.h"
 #include "StaticObjectPool.h"
 #include "LocalObjectPool.h"
+#include "SizeClasses.h"
+#include "PoolTrimming.h"
+#include "AllocationSiteProfiler.h"
 #include "LocalMemoryManager.h"
 #include "GlobalMemoryManagement.h"
 #include "ThreadMemoryManagement.h"
+#include "FrameArena.h"
 
 #include "MemoryPolicy.h"
 #include "SharedPointer.h"
 #include "AllocationStrategies.h"
+#include "DeferredRelease.h"
+#include "EpochReclamation.h"
 #include "STLAllocator.h"
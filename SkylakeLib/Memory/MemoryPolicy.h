@@ -17,7 +17,7 @@ namespace SKL::MemoryPolicy
 {
     //[SemVer] Any changes must bump at least one of these components
     constexpr int32_t CVersionMajor = 1;
-    constexpr int32_t CVersionMinor = 1;
+    constexpr int32_t CVersionMinor = 4;
     constexpr int32_t CVersionPatch = 1;
 
     struct ArrayHeader
@@ -63,13 +63,151 @@ namespace SKL::MemoryPolicy
         //! \returns true if reached 0 ref count
         SKL_FORCEINLINE bool ReleaseReference() noexcept
         {
-            return 1U == ReferenceCount.fetch_sub( 1, std::memory_order_acq_rel );
+            return 1U == ( ReferenceCount.fetch_sub( 1, std::memory_order_acq_rel ) & CReferenceCountMask );
         }
 
+        //! Adds InCount to the reference count of this instance in one atomic operation
+        //! \remarks Only call this function while holding a valid reference to this instance
+        SKL_FORCEINLINE void AddReferences( uint32_t InCount ) noexcept
+        {
+            ( void )ReferenceCount.fetch_add( InCount, std::memory_order_relaxed );
+        }
+
+        //! Removes InCount from the reference count of this instance in one atomic operation
+        //! \remarks Only call this function when you know that removing InCount references will not 0 reference count
+        SKL_FORCEINLINE void ReleaseReferencesChecked( uint32_t InCount ) noexcept
+        {
+            SKL_ASSERT( InCount < GetReferenceCount() );
+            ( void )ReferenceCount.fetch_sub( InCount, std::memory_order_acq_rel );
+        }
+
+        //! Adds 1 to the reference count of this instance using a plain (non locked) increment
+        //! \remarks Only call this function from the thread that owns this instance, while holding a valid reference to this instance
+        //! \remarks Falls back to AddReference() if the instance escaped to other threads
+        SKL_FORCEINLINE void AddReferenceLocal() noexcept
+        {
+            const uint32_t Value{ ReferenceCount.load( std::memory_order_relaxed ) };
+            if( 0U != ( Value & CEscapedFlag ) ) SKL_UNLIKELY
+            {
+                AddReference();
+                return;
+            }
+
+            ReferenceCount.store( Value + 1U, std::memory_order_relaxed );
+        }
+
+        //! Removes 1 from the reference count of this instance using a plain (non locked) decrement
+        //! \remarks Only call this function from the thread that owns this instance
+        //! \returns false if the reference was not released [last reference or the instance escaped], release it through ReleaseReference()
+        SKL_FORCEINLINE bool TryReleaseReferenceLocal() noexcept
+        {
+            const uint32_t Value{ ReferenceCount.load( std::memory_order_relaxed ) };
+            if( 1U == Value || 0U != ( Value & CEscapedFlag ) ) SKL_UNLIKELY
+            {
+                return false;
+            }
+
+            ReferenceCount.store( Value - 1U, std::memory_order_relaxed );
+            return true;
+        }
+
+        //! Mark this instance as shared with other threads, from now on all reference count updates are atomic
+        //! \remarks Only call this function from the thread that owns this instance, before publishing the instance to other threads
+        //! \remarks Safe to call on an already escaped instance, the reference count updates of the other threads are never lost
+        SKL_FORCEINLINE void MarkEscaped() noexcept
+        {
+            if( true == IsEscaped() )
+            {
+                return;
+            }
+
+            ( void )ReferenceCount.fetch_or( CEscapedFlag, std::memory_order_relaxed );
+        }
+
+        //! Was this instance shared with other threads
+        SKL_FORCEINLINE SKL_NODISCARD bool IsEscaped() const noexcept
+        {
+            return 0U != ( ReferenceCount.load( std::memory_order_relaxed ) & CEscapedFlag );
+        }
+
+        //! Get the reference count of this instance
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t GetReferenceCount() const noexcept
+        {
+            return ReferenceCount.load( std::memory_order_relaxed ) & CReferenceCountMask;
+        }
+
+        //! Adds 1 to the reference count of this instance only if it is not 0 [lock-free]
+        //! \returns true if the reference was added
+        SKL_FORCEINLINE SKL_NODISCARD bool TryAddReference() noexcept
+        {
+            uint32_t Value{ ReferenceCount.load( std::memory_order_relaxed ) };
+            while( 0U != ( Value & CReferenceCountMask ) )
+            {
+                if( true == ReferenceCount.compare_exchange_weak( Value, Value + 1U, std::memory_order_acquire, std::memory_order_relaxed ) )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        static constexpr uint32_t CEscapedFlag        = 1U << 31U;      //!< Set once a thread confined instance is shared with other threads
+        static constexpr uint32_t CReferenceCountMask = ~CEscapedFlag;
+
         std::atomic<uint32_t>  ReferenceCount; //!< ref count
         const uint32_t         BlockSize;      //!< total size of the shared memory block
     };
 
+    static_assert( 8U == sizeof( ControlBlock ) );
+
+    //! Control block of the shared objects that can be weak referenced [see TWeakPtr]
+    struct WeakControlBlock : ControlBlock
+    {
+        WeakControlBlock( uint32_t ReferenceCount, uint32_t BlockSize ) noexcept 
+            : ControlBlock{ ReferenceCount, BlockSize }
+        {}
+        ~WeakControlBlock() noexcept = default;
+
+        //! Adds 1 to the weak reference count of this instance
+        //! \remarks Only call this function while holding a valid strong or weak reference to this instance
+        SKL_FORCEINLINE void AddWeakReference() noexcept
+        {
+            ( void )WeakReferenceCount.fetch_add( 1, std::memory_order_relaxed );
+        }
+
+        //! Removes 1 from the weak reference count of this instance
+        //! \returns true if reached 0 weak ref count, the memory block must be freed
+        SKL_FORCEINLINE bool ReleaseWeakReference() noexcept
+        {
+            return 1U == WeakReferenceCount.fetch_sub( 1, std::memory_order_acq_rel );
+        }
+
+        //! Removes the weak reference held by all the strong references together, call after the reference count reached 0 and the object was destroyed
+        //! \returns true if there are no weak references left, the memory block must be freed
+        SKL_FORCEINLINE bool ReleaseStrongsWeakReference() noexcept
+        {
+            // no weak references and none can be created anymore, skip the atomic decrement
+            if( 1U == WeakReferenceCount.load( std::memory_order_acquire ) ) SKL_LIKELY
+            {
+                return true;
+            }
+
+            return ReleaseWeakReference();
+        }
+
+        //! Get the weak reference count of this instance [including the one held by the strong references]
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t GetWeakReferenceCount() const noexcept
+        {
+            return WeakReferenceCount.load( std::memory_order_relaxed );
+        }
+
+        std::atomic<uint32_t>  WeakReferenceCount{ 1U }; //!< weak ref count, +1 while the ref count is not 0
+        const uint32_t         Reserved{ 0U };           //!< keeps the object that follows the control block 16 bytes aligned
+    };
+
+    static_assert( 16U == sizeof( WeakControlBlock ) );
+
     struct UniqueMemoryPolicy final
     {
         static constexpr size_t CArrayHeaderSize   = sizeof( ArrayHeader );
@@ -303,12 +441,17 @@ namespace SKL::MemoryPolicy
         }
     };
 
-    template<bool bVirtualDeleter = false>
+    template<bool bVirtualDeleter = false, bool bWeakReferences = false>
     struct SharedMemoryPolicy final
     {
+        static_assert( false == bVirtualDeleter || false == bWeakReferences, "Weak references to virtual deleted objects are not supported!" );
+
+        using TControlBlock = std::conditional_t<bWeakReferences, WeakControlBlock, ControlBlock>;
+
         static constexpr bool   CHasVirtualDeleter      = bVirtualDeleter;
+        static constexpr bool   CHasWeakReferences      = bWeakReferences;
         static constexpr size_t CArrayHeaderSize        = sizeof( ArrayHeader );
-        static constexpr size_t CControlBlockSize       = sizeof( ControlBlock );
+        static constexpr size_t CControlBlockSize       = sizeof( TControlBlock );
         static constexpr size_t CSharedObjectHeaderSize = CControlBlockSize;
         static constexpr size_t CSharedArrayHeaderSize  = CControlBlockSize + CArrayHeaderSize;
 
@@ -324,6 +467,12 @@ namespace SKL::MemoryPolicy
             return *reinterpret_cast<ControlBlock*>( reinterpret_cast<uint8_t*>( InPtr ) - CSharedArrayHeaderSize );
         }
 
+        //! Get weak control block header pointer for the shared object
+        SKL_FORCEINLINE SKL_NODISCARD static WeakControlBlock& GetWeakControlBlockForObject( void* InPtr ) noexcept requires( true == bWeakReferences )
+        {
+            return *reinterpret_cast<WeakControlBlock*>( reinterpret_cast<uint8_t*>( InPtr ) - CSharedObjectHeaderSize );
+        }
+
         //! Increment reference count for object allocation
         SKL_FORCEINLINE static void IncrementReferenceForObject( void* InPtr ) noexcept
         {
@@ -352,6 +501,34 @@ namespace SKL::MemoryPolicy
             CBlock.ReleaseReferenceChecked();
         }
 
+        //! Increment reference count by InCount for object allocation
+        SKL_FORCEINLINE static void IncrementReferencesForObject( void* InPtr, uint32_t InCount ) noexcept
+        {
+            auto& CBlock{ GetControlBlockForObject( InPtr ) };
+            CBlock.AddReferences( InCount );
+        }
+
+        //! Increment reference count by InCount for array allocation
+        SKL_FORCEINLINE static void IncrementReferencesForArray( void* InPtr, uint32_t InCount ) noexcept
+        {
+            auto& CBlock{ GetControlBlockForArray( InPtr ) };
+            CBlock.AddReferences( InCount );
+        }
+
+        //! Decrement reference count by InCount for object allocation
+        SKL_FORCEINLINE static void DecrementReferencesForObject( void* InPtr, uint32_t InCount ) noexcept
+        {
+            auto& CBlock{ GetControlBlockForObject( InPtr ) };
+            CBlock.ReleaseReferencesChecked( InCount );
+        }
+
+        //! Decrement reference count by InCount for array allocation
+        SKL_FORCEINLINE static void DecrementReferencesForArray( void* InPtr, uint32_t InCount ) noexcept
+        {
+            auto& CBlock{ GetControlBlockForArray( InPtr ) };
+            CBlock.ReleaseReferencesChecked( InCount );
+        }
+
         //! Set reference count for object allocation
         SKL_FORCEINLINE static void SetReferenceCountForObject( void* InPtr, uint32_t InRefCount ) noexcept
         {
@@ -369,13 +546,13 @@ namespace SKL::MemoryPolicy
         //! Get reference count for object allocation
         SKL_FORCEINLINE SKL_NODISCARD static uint32_t GetReferenceCountForObject( void* InPtr ) noexcept
         {
-            return GetControlBlockForObject( InPtr ).ReferenceCount.load( std::memory_order_relaxed );
+            return GetControlBlockForObject( InPtr ).GetReferenceCount();
         }
 
         //! Get reference count for array allocation
         SKL_FORCEINLINE SKL_NODISCARD static uint32_t GetReferenceCountForArray( void* InPtr ) noexcept
         {
-            return GetControlBlockForArray( InPtr ).ReferenceCount.load( std::memory_order_relaxed );
+            return GetControlBlockForArray( InPtr ).GetReferenceCount();
         }
 
         //! Get array header pointer for the shared array
@@ -542,7 +719,7 @@ namespace SKL::MemoryPolicy
                        , "TArrayItem must be [bAcceptThrowConstructor ? throw : nothrow] default constructible" );
 
             // construct the control block
-            GConstructNothrow<ControlBlock>( InMemoryBlockPointer, 1, ( ItemSize * ItemCount ) + static_cast<uint32_t>( CSharedArrayHeaderSize ) );
+            GConstructNothrow<TControlBlock>( InMemoryBlockPointer, 1, ( ItemSize * ItemCount ) + static_cast<uint32_t>( CSharedArrayHeaderSize ) );
     
             // construct array header
             GConstructNothrow<ArrayHeader>( reinterpret_cast<uint8_t*>( InMemoryBlockPointer ) + CControlBlockSize, ItemSize, ItemCount );
@@ -585,7 +762,7 @@ namespace SKL::MemoryPolicy
                        , "TObject must be [bAcceptThrowConstructor ? throw : nothrow] constructible" );
 
             // construct the control block
-            GConstructNothrow<ControlBlock>( InMemoryBlockPointer, 1, AllocSize );
+            GConstructNothrow<TControlBlock>( InMemoryBlockPointer, 1, AllocSize );
     
             // calculate the object pointer
             TObject* Result{ reinterpret_cast<TObject*>( reinterpret_cast<uint8_t*>( InMemoryBlockPointer ) + CSharedObjectHeaderSize ) };
@@ -684,6 +861,15 @@ namespace SKL::MemoryPolicy
                     }  
                 }
 
+                // the memory block is kept while weak references exist [see TWeakPtr]
+                if constexpr( true == CHasWeakReferences )
+                {
+                    if( false == GetWeakControlBlockForObject( InObjectPtr ).ReleaseStrongsWeakReference() ) SKL_UNLIKELY
+                    {
+                        return nullptr;
+                    }
+                }
+
                 return &ControlBlock;
             }
 
@@ -721,7 +907,7 @@ namespace SKL::MemoryDeallocation
         }
     };
 
-    template<typename TObject, typename TMyMemoryPolicy, bool bDestruct = true> requires( std::is_same_v<TMyMemoryPolicy, MemoryPolicy::SharedMemoryPolicy<true>> || std::is_same_v<TMyMemoryPolicy, MemoryPolicy::SharedMemoryPolicy<false>> )
+    template<typename TObject, typename TMyMemoryPolicy, bool bDestruct = true> requires( std::is_same_v<TMyMemoryPolicy, MemoryPolicy::SharedMemoryPolicy<true>> || std::is_same_v<TMyMemoryPolicy, MemoryPolicy::SharedMemoryPolicy<false>> || std::is_same_v<TMyMemoryPolicy, MemoryPolicy::SharedMemoryPolicy<false, true>> )
     struct SharedMemoryDeallocator final
     {
         using TDecayObject   = std::remove_all_extents_t<TObject>;
@@ -738,6 +924,7 @@ namespace SKL::MemoryDeallocation
         static void Deallocate( TDecayObject* InPtr ) noexcept
         {
             static_assert( false == std::is_array_v<TObject> || false == CHasVirtualDeleter, "Virtual deleter for array is not yet supported!" );
+            static_assert( false == std::is_array_v<TObject> || false == MyMemoryPolicy::CHasWeakReferences, "Weak references to shared arrays are not supported!" );
 
             if constexpr( true == std::is_array_v<TObject> )
             {
@@ -842,6 +1029,50 @@ namespace SKL::TLSMemoryDeallocation
             }
         }
     };
+
+    //! Layout of the thread local shared objects that can escape their owner thread [see TLocalSharedPtr]
+    //! \remarks The owner tag of the allocating thread is stored after the object, the last reference can be released on any thread
+    template<typename TObject>
+    struct LocalSharedMemoryLayout final
+    {
+        using MyMemoryPolicy = MemoryPolicy::SharedMemoryPolicy<false>;
+        using TOwnerTag      = ThreadLocalMemoryManager::TOwnerTag;
+
+        static constexpr size_t COwnerTagOffset{ ( ( MyMemoryPolicy::template CalculateNeededSizeForObject<TObject>() + alignof( TOwnerTag ) - 1U ) / alignof( TOwnerTag ) ) * alignof( TOwnerTag ) };
+        static constexpr size_t CAllocSize     { COwnerTagOffset + sizeof( TOwnerTag ) };
+
+        //! Get the owner tag stored in the memory block
+        SKL_FORCEINLINE SKL_NODISCARD static TOwnerTag& GetOwnerTag( void* InMemoryBlock ) noexcept
+        {
+            return *reinterpret_cast<TOwnerTag*>( reinterpret_cast<uint8_t*>( InMemoryBlock ) + COwnerTagOffset );
+        }
+    };
+
+    template<typename TObject, bool bDestruct = true>
+    struct LocalSharedMemoryDeallocator final
+    {
+        using TDecayObject   = std::remove_all_extents_t<TObject>;
+        using MyMemoryPolicy = MemoryPolicy::SharedMemoryPolicy<false>;
+        using MyLayout       = LocalSharedMemoryLayout<TDecayObject>;
+
+        static_assert( false == std::is_array_v<TObject>, "Thread confined shared arrays are not supported!" );
+
+        // std api
+        void operator()( TDecayObject* InPtr ) const noexcept
+        {
+            Deallocate( InPtr );
+        }
+
+        static void Deallocate( TDecayObject* InPtr ) noexcept
+        {
+            void* Result{ MyMemoryPolicy::template DestroyForObject<TObject, bDestruct, false>( InPtr ) };
+            if( nullptr != Result )
+            {
+                // the last reference can be released on any thread, the block goes back to the allocating thread's pools
+                ThreadLocalMemoryManager::DeallocateFromAnyThread( MyLayout::GetOwnerTag( Result ), Result, MyLayout::CAllocSize );
+            }
+        }
+    };
 }
 
 namespace SKL
@@ -899,7 +1130,7 @@ namespace SKL
 
 namespace SKL::MemoryAllocation
 {
-    template<typename TObject, typename TMyMemoryPolicy> requires( std::is_same_v<TMyMemoryPolicy, MemoryPolicy::UniqueMemoryPolicy> || std::is_same_v<TMyMemoryPolicy, MemoryPolicy::SharedMemoryPolicy<true>> || std::is_same_v<TMyMemoryPolicy, MemoryPolicy::SharedMemoryPolicy<false>> )
+    template<typename TObject, typename TMyMemoryPolicy> requires( std::is_same_v<TMyMemoryPolicy, MemoryPolicy::UniqueMemoryPolicy> || std::is_same_v<TMyMemoryPolicy, MemoryPolicy::SharedMemoryPolicy<true>> || std::is_same_v<TMyMemoryPolicy, MemoryPolicy::SharedMemoryPolicy<false>> || std::is_same_v<TMyMemoryPolicy, MemoryPolicy::SharedMemoryPolicy<false, true>> )
     struct MemoryAllocator final
     {
         using TDecayObject   = std::remove_all_extents_t<TObject>;
@@ -1136,6 +1367,55 @@ namespace SKL::MemoryStrategy
         using DestructDeallocator = SKL::MemoryDeallocation::SharedMemoryDeallocator<TObject, MemoryPolicy>;
         using Allocator           = SKL::MemoryAllocation::MemoryAllocator<TObject, MemoryPolicy>;
     };
+
+    //! Strategy of the shared objects that can be weak referenced, the control block holds the weak ref count [see TWeakPtr]
+    template<typename TObject>
+    struct WeakSharedMemoryStrategy
+    {
+        using MemoryPolicy        = SKL::MemoryPolicy::SharedMemoryPolicy<false, true>;
+        using Deallocator         = SKL::MemoryDeallocation::SharedMemoryDeallocator<TObject, MemoryPolicy, false>;
+        using DestructDeallocator = SKL::MemoryDeallocation::SharedMemoryDeallocator<TObject, MemoryPolicy>;
+        using Allocator           = SKL::MemoryAllocation::MemoryAllocator<TObject, MemoryPolicy>;
+    };
+}
+
+namespace SKL::TLSMemoryAllocation
+{
+    template<typename TObject>
+    struct LocalSharedMemoryAllocator final
+    {
+        using TDecayObject   = std::remove_all_extents_t<TObject>;
+        using MyMemoryPolicy = MemoryPolicy::SharedMemoryPolicy<false>;
+        using MyLayout       = TLSMemoryDeallocation::LocalSharedMemoryLayout<TDecayObject>;
+
+        static_assert( false == std::is_array_v<TObject>, "Thread confined shared arrays are not supported!" );
+
+        //! Allocate new object, the owner tag of the calling thread is stored along the object
+        template<bool bConstruct = true, bool bAcceptThrowConstructor = false, typename ...TArgs>
+        static TDecayObject* AllocateObject( TArgs... Args ) noexcept
+        {
+            constexpr uint32_t AllocSize{ static_cast<uint32_t>( MyLayout::CAllocSize ) };
+
+            TDecayObject* Result;
+
+            // allocate block
+            auto AllocResult = ThreadLocalMemoryManager::Allocate<AllocSize>();
+            if( AllocResult.IsValid() ) SKL_LIKELY
+            {
+                MyLayout::GetOwnerTag( AllocResult.MemoryBlock ) = ThreadLocalMemoryManager::GetOwnerTag();
+
+                // apply the object policy on the block
+                Result = MyMemoryPolicy::template ConstructObject<TDecayObject, bConstruct, bAcceptThrowConstructor, TArgs...>( AllocResult.MemoryBlock, std::forward<TArgs>( Args )... );
+            }
+            else
+            {
+                GLOG_DEBUG( "LocalSharedMemoryAllocator<>::AllocateObject(size:%u) Failed to allocate from ThreadLocalMemoryManager!", AllocSize );
+                Result = nullptr;
+            }
+            
+            return Result;
+        }
+    };
 }
 
 namespace SKL::TLSMemoryStrategy
@@ -1159,6 +1439,16 @@ namespace SKL::TLSMemoryStrategy
         using DestructDeallocator = SKL::TLSMemoryDeallocation::SharedMemoryDeallocator<TObject, MemoryPolicy>;
         using Allocator           = SKL::TLSMemoryAllocation::MemoryAllocator<TObject, MemoryPolicy>;
     };
+
+    //! Strategy of the thread local shared objects that can escape their owner thread, the last reference can be released on any thread [see TLocalSharedPtr]
+    template<typename TObject>
+    struct LocalSharedMemoryStrategy
+    {
+        using MemoryPolicy        = SKL::MemoryPolicy::SharedMemoryPolicy<false>;
+        using Deallocator         = SKL::TLSMemoryDeallocation::LocalSharedMemoryDeallocator<TObject, false>;
+        using DestructDeallocator = SKL::TLSMemoryDeallocation::LocalSharedMemoryDeallocator<TObject>;
+        using Allocator           = SKL::TLSMemoryAllocation::LocalSharedMemoryAllocator<TObject>;
+    };
 }
 
 namespace SKL
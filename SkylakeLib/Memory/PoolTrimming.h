@@ -0,0 +1,79 @@
+//!
+//! \file PoolTrimming.h
+//!
+//! \brief Decay policy for the memory pools, returns the memory of the blocks idle after a usage spike to the OS
+//!
+//! \author Balan Narcis (balannarcis96@gmail.com)
+//!
+#pragma once
+
+namespace SKL
+{
+    //! Tracks the low-water mark of the blocks cached by one pool over a time window and decides how many of them can be trimmed
+    //! \remarks The blocks under the low-water mark were not needed for the whole window, all of them except a reserve are trimmed
+    //! \remarks The reserve is CMemoryManager_TrimReservePercent of the peak number of blocks in use during the window [at least CMemoryManager_TrimMinCachedBlocks]
+    //! \remarks Not thread safe, each pool must be sampled by one thread at a time
+    struct PoolTrimPolicy
+    {
+        //! Sample the number of blocks cached by the pool
+        //! \returns the number of blocks to trim [non zero only at the end of a window]
+        SKL_NODISCARD size_t Sample( TEpochTimePoint InNow, size_t InCachedBlocks, size_t InPoolSize ) noexcept
+        {
+            if( 0U == WindowStart ) SKL_UNLIKELY
+            {
+                WindowStart = InNow;
+            }
+
+            LowWaterMark = std::min( LowWaterMark, InCachedBlocks );
+
+            if( InNow - WindowStart < CMemoryManager_TrimWindowMs ) SKL_LIKELY
+            {
+                return 0U;
+            }
+
+            const size_t PeakInUse{ InPoolSize - std::min( InPoolSize, LowWaterMark ) };
+            const size_t Reserve  { std::max<size_t>( CMemoryManager_TrimMinCachedBlocks, ( PeakInUse * CMemoryManager_TrimReservePercent ) / 100U ) };
+            const size_t Result   { LowWaterMark > Reserve ? std::min<size_t>( LowWaterMark - Reserve, CMemoryManager_TrimMaxBlocksPerPass ) : 0U };
+
+            // start a new window
+            WindowStart  = InNow;
+            LowWaterMark = std::numeric_limits<size_t>::max();
+
+            return Result;
+        }
+
+        //! Get the lowest number of cached blocks sampled in the current window
+        SKL_FORCEINLINE SKL_NODISCARD size_t GetLowWaterMark() const noexcept { return LowWaterMark; }
+
+    private:
+        TEpochTimePoint WindowStart { 0U };                                  //!< Time point when the current window started
+        size_t          LowWaterMark{ std::numeric_limits<size_t>::max() };  //!< Lowest number of cached blocks in the current window
+    };
+
+    //! Sample the pool and trim its idle blocks at the end of each window
+    //! \remarks Pools with blocks smaller than CMemoryManager_TrimMinBlockSize are skipped, only whole pages can be returned to the OS
+    //! \returns the number of bytes returned to the OS
+    template<size_t TBlockSize, size_t TBlockCount, typename TPool>
+    SKL_FORCEINLINE size_t TrimPool( TPool& InPool, PoolTrimPolicy& InPolicy, TEpochTimePoint InNow ) noexcept
+    {
+        if constexpr( TBlockSize < CMemoryManager_TrimMinBlockSize )
+        {
+            return 0U;
+        }
+        else
+        {
+            if( false == InPool.SupportsTrimming() )
+            {
+                return 0U;
+            }
+
+            const size_t TrimCount{ InPolicy.Sample( InNow, InPool.GetCachedBlocksCount(), TBlockCount ) };
+            if( 0U == TrimCount ) SKL_LIKELY
+            {
+                return 0U;
+            }
+
+            return InPool.DiscardColdBlocks( TrimCount );
+        }
+    }
+}
@@ -128,6 +128,402 @@ namespace SKL
             return reinterpret_cast<T*>( AllocResult.MemoryBlock );
         }
     };
+
+    //! Per container pool of same size nodes, refilled in chunks from the ThreadLocalMemoryManager
+    //! \remarks Shared by all the copies [and rebinds] of one STLTLSNodeAllocator, the chunks are returned to the ThreadLocalMemoryManager when the last copy is destroyed
+    //! \remarks The first CSTLNodePool_MaxNodeSizes distinct sizes [up to CSTLNodePool_MaxNodeSize bytes] are pooled, the rest are forwarded to the ThreadLocalMemoryManager
+    //! \remarks Not thread safe, thread confined like the ThreadLocalMemoryManager
+    struct STLNodePool
+    {
+        //! Create a new pool with one reference
+        //! \returns nullptr if the allocation failed
+        SKL_NODISCARD static STLNodePool* Create() noexcept
+        {
+            auto AllocResult{ ThreadLocalMemoryManager::Allocate( sizeof( STLNodePool ) ) };
+            if( false == AllocResult.IsValid() ) SKL_UNLIKELY
+            {
+                return nullptr;
+            }
+
+            return new ( AllocResult.MemoryBlock ) STLNodePool();
+        }
+
+        SKL_FORCEINLINE void AddReference() noexcept
+        {
+            ++ReferenceCount;
+        }
+
+        //! Release one reference, the pool and all its chunks are freed when the last reference is released
+        SKL_FORCEINLINE void ReleaseReference() noexcept
+        {
+            SKL_ASSERT( 0U != ReferenceCount );
+            if( 0U == --ReferenceCount )
+            {
+                Destroy();
+            }
+        }
+
+        //! Allocate one node of InSize bytes
+        //! \remarks The pooled nodes are only taken from the chunks of this pool, OutNode is nullptr if no chunk could be allocated
+        //! \returns false if InSize is not pooled [must be allocated from the ThreadLocalMemoryManager]
+        SKL_NODISCARD bool Allocate( uint32_t InSize, void*& OutNode ) noexcept
+        {
+            NodeList* List{ FindList( InSize ) };
+            if( nullptr == List ) SKL_UNLIKELY
+            {
+                List = ClaimList( InSize );
+                if( nullptr == List )
+                {
+                    return false;
+                }
+            }
+
+            if( nullptr == List->FreeList ) SKL_UNLIKELY
+            {
+                if( false == Refill( *List ) )
+                {
+                    OutNode = nullptr;
+                    return true;
+                }
+            }
+
+            OutNode        = List->FreeList;
+            List->FreeList = LoadNext( OutNode );
+            return true;
+        }
+
+        //! Deallocate one node of InSize bytes
+        //! \returns false if InSize is not pooled [must be deallocated to the ThreadLocalMemoryManager]
+        SKL_NODISCARD bool Deallocate( void* InPtr, uint32_t InSize ) noexcept
+        {
+            NodeList* List{ FindList( InSize ) };
+            if( nullptr == List ) SKL_UNLIKELY
+            {
+                return false;
+            }
+
+            StoreNext( InPtr, List->FreeList );
+            List->FreeList = InPtr;
+            return true;
+        }
+
+        //! Get the number of chunks allocated from the ThreadLocalMemoryManager
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t GetChunksCount() const noexcept { return ChunksCount; }
+
+    private:
+        struct NodeList
+        {
+            uint32_t NodeSize{ 0U };      //!< Size of the nodes [0 if the list is not claimed]
+            void*    FreeList{ nullptr }; //!< Free nodes
+        };
+
+        struct ChunkHeader
+        {
+            ChunkHeader* Next{ nullptr }; //!< Next chunk
+            uint32_t     Size{ 0U };      //!< Size of the chunk in bytes
+        };
+
+        static constexpr uint32_t CChunkHeaderSize = static_cast<uint32_t>( ( sizeof( ChunkHeader ) + alignof( std::max_align_t ) - 1U ) & ~( alignof( std::max_align_t ) - 1U ) );
+
+        STLNodePool() noexcept = default;
+
+        SKL_FORCEINLINE SKL_NODISCARD static void* LoadNext( void* InNode ) noexcept
+        {
+            // the nodes are only aligned as their type
+            void* Result;
+            ( void )memcpy( &Result, InNode, sizeof( void* ) );
+            return Result;
+        }
+
+        SKL_FORCEINLINE static void StoreNext( void* InNode, void* InNext ) noexcept
+        {
+            ( void )memcpy( InNode, &InNext, sizeof( void* ) );
+        }
+
+        SKL_FORCEINLINE SKL_NODISCARD NodeList* FindList( uint32_t InSize ) noexcept
+        {
+            for( NodeList& List : Lists )
+            {
+                if( InSize == List.NodeSize )
+                {
+                    return &List;
+                }
+            }
+
+            return nullptr;
+        }
+
+        SKL_NODISCARD NodeList* ClaimList( uint32_t InSize ) noexcept
+        {
+            if( CSTLNodePool_MaxNodeSize < InSize || 0U == InSize )
+            {
+                return nullptr;
+            }
+
+            for( NodeList& List : Lists )
+            {
+                if( 0U == List.NodeSize )
+                {
+                    // claimed for good, a size is either always or never pooled so each node is returned to where it came from [the free lists only hold nodes of this pool's chunks]
+                    List.NodeSize = InSize;
+                    return &List;
+                }
+            }
+
+            return nullptr;
+        }
+
+        SKL_NODISCARD bool Refill( NodeList& InList ) noexcept
+        {
+            if( true == AddChunk( InList, CSTLNodePool_NodesPerChunk ) ) SKL_LIKELY
+            {
+                return true;
+            }
+
+            // low on memory, try a one node chunk
+            return AddChunk( InList, 1U );
+        }
+
+        SKL_NODISCARD bool AddChunk( NodeList& InList, uint32_t InNodesCount ) noexcept
+        {
+            const uint32_t Stride   { std::max<uint32_t>( InList.NodeSize, static_cast<uint32_t>( sizeof( void* ) ) ) };
+            const uint32_t ChunkSize{ CChunkHeaderSize + Stride * InNodesCount };
+
+            auto AllocResult{ ThreadLocalMemoryManager::Allocate( ChunkSize ) };
+            if( false == AllocResult.IsValid() ) SKL_UNLIKELY
+            {
+                GLOG_DEBUG( "STLNodePool::AddChunk() Failed to allocate %u bytes", ChunkSize );
+                return false;
+            }
+
+            auto* Chunk{ new ( AllocResult.MemoryBlock ) ChunkHeader{ Chunks, ChunkSize } };
+            Chunks = Chunk;
+            ++ChunksCount;
+
+            // link the new nodes in front of the free list
+            auto* FirstNode{ reinterpret_cast<uint8_t*>( Chunk ) + CChunkHeaderSize };
+            for( uint32_t i = 0; i < InNodesCount; ++i )
+            {
+                void* Node{ FirstNode + static_cast<size_t>( i ) * Stride };
+                StoreNext( Node, i + 1U < InNodesCount ? FirstNode + static_cast<size_t>( i + 1U ) * Stride : InList.FreeList );
+            }
+            InList.FreeList = FirstNode;
+
+            return true;
+        }
+
+        void Destroy() noexcept
+        {
+            ChunkHeader* Chunk{ Chunks };
+            while( nullptr != Chunk )
+            {
+                ChunkHeader* Next{ Chunk->Next };
+                ThreadLocalMemoryManager::Deallocate( Chunk, Chunk->Size );
+                Chunk = Next;
+            }
+
+            this->~STLNodePool();
+            ThreadLocalMemoryManager::Deallocate( this, sizeof( STLNodePool ) );
+        }
+
+        NodeList     Lists[CSTLNodePool_MaxNodeSizes]{}; //!< Free lists, one per pooled node size
+        ChunkHeader* Chunks        { nullptr };          //!< All the chunks allocated by this pool
+        uint32_t     ChunksCount   { 0U };               //!< Number of chunks allocated by this pool
+        uint32_t     ReferenceCount{ 1U };               //!< Number of allocators using this pool
+    };
+
+    //! ThreadLocalMemoryManager allocator for node based containers [std::deque, std::map etc.]
+    //! \remarks Each container keeps a small free list per node size, refilled in chunks of CSTLNodePool_NodesPerChunk nodes from the ThreadLocalMemoryManager [see STLNodePool]
+    //! \remarks The nodes are recycled inside the container, the chunks are returned when the container is destroyed
+    //! \remarks The containers must be created, used and destroyed on one thread with a ThreadLocalMemoryManager instance
+    template<typename T>
+    class STLTLSNodeAllocator
+    {
+    public:
+        static_assert( false == std::is_const_v<T>, "The C++ Standard forbids containers of const elements "
+                                                       "because allocator<const T> is ill-formed." );
+
+        using value_type      = std::conditional_t<std::is_array_v<T>, std::remove_all_extents_t<T>, T>;
+        using size_type       = uint32_t;
+        using difference_type = ptrdiff_t;
+        using pointer         = T*;
+        using const_pointer   = const T*;
+        using reference       = T&;
+        using const_reference = const T&;
+
+        // the pool travels with the nodes
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap            = std::true_type;
+        using is_always_equal                        = std::false_type;
+
+        STLTLSNodeAllocator() noexcept : Pool{ STLNodePool::Create() } {}
+        STLTLSNodeAllocator( const STLTLSNodeAllocator& Other ) noexcept : Pool{ Other.Pool }
+        {
+            if( nullptr != Pool )
+            {
+                Pool->AddReference();
+            }
+        }
+        template <class _Other>
+        STLTLSNodeAllocator( const STLTLSNodeAllocator<_Other>& Other ) noexcept : Pool{ Other.GetPool() }
+        {
+            if( nullptr != Pool )
+            {
+                Pool->AddReference();
+            }
+        }
+
+        ~STLTLSNodeAllocator() noexcept
+        {
+            if( nullptr != Pool )
+            {
+                Pool->ReleaseReference();
+            }
+        }
+
+        STLTLSNodeAllocator& operator=( const STLTLSNodeAllocator& Other ) noexcept
+        {
+            if( nullptr != Other.Pool )
+            {
+                Other.Pool->AddReference();
+            }
+            if( nullptr != Pool )
+            {
+                Pool->ReleaseReference();
+            }
+
+            Pool = Other.Pool;
+            return *this;
+        }
+
+        //! The copy of a container gets its own node pool
+        SKL_NODISCARD STLTLSNodeAllocator select_on_container_copy_construction() const noexcept
+        {
+            return STLTLSNodeAllocator{};
+        }
+
+        void deallocate( T* const InPtr, const size_t InCount ) noexcept
+        {
+            SKL_ASSERT_MSG( InPtr != nullptr || InCount == 0, "null pointer cannot point to a block of non-zero size");
+            constexpr uint32_t TSize{ static_cast<uint32_t>( sizeof( T ) ) };
+            // no overflow check on the following multiply; we assume _Allocate did that check
+            const uint32_t AllocateSize{ TSize * static_cast<uint32_t>( InCount ) };
+            if( nullptr != Pool && true == Pool->Deallocate( InPtr, AllocateSize ) ) SKL_LIKELY
+            {
+                return;
+            }
+
+            ThreadLocalMemoryManager::Deallocate( InPtr, AllocateSize );
+        }
+
+        SKL_NODISCARD SKL_ALLOCATOR_FUNCTION T* allocate( const size_t InCount ) noexcept 
+        {
+            static_assert( sizeof(value_type) > 0, "value_type must be complete before calling allocate." );
+
+            constexpr uint32_t TSize{ static_cast<uint32_t>( sizeof( T ) ) };
+#if !defined(SKL_BUILD_SHIPPING)
+            constexpr bool bOverflowIsPossible{ TSize > 1 };
+            if constexpr( true == bOverflowIsPossible ) 
+            {
+                constexpr uint32_t MaxPossible{ static_cast<uint32_t>( -1 ) / TSize };
+                SKL_ASSERT_MSG( static_cast<uint32_t>( InCount ) <= MaxPossible, "STLTLSNodeAllocator<T>::allocate() multiply overflow" );
+            }
+#endif
+            const uint32_t AllocateSize{ TSize * static_cast<uint32_t>( InCount ) };
+            if( nullptr != Pool ) SKL_LIKELY
+            {
+                // the pooled sizes never fall back to the ThreadLocalMemoryManager, their nodes are returned to the pool by deallocate()
+                void* Node;
+                if( true == Pool->Allocate( AllocateSize, Node ) ) SKL_LIKELY
+                {
+                    if( nullptr == Node ) SKL_UNLIKELY
+                    {
+                        GLOG_DEBUG( "STLTLSNodeAllocator<T>::Allocate() Failed to allocate %u bytes (%llu items)", AllocateSize, InCount );
+                    }
+
+                    return reinterpret_cast<T*>( Node );
+                }
+            }
+
+            auto AllocResult{ ThreadLocalMemoryManager::Allocate( AllocateSize ) };
+            if( false == AllocResult.IsValid() ) SKL_UNLIKELY
+            {
+                GLOG_DEBUG( "STLTLSNodeAllocator<T>::Allocate() Failed to allocate %u bytes (%llu items)", AllocateSize, InCount );
+                return nullptr;
+            }
+            
+            return reinterpret_cast<T*>( AllocResult.MemoryBlock );
+        }
+
+        //! Get the node pool shared by all the copies of this allocator [nullptr if it could not be allocated]
+        SKL_FORCEINLINE SKL_NODISCARD STLNodePool* GetPool() const noexcept { return Pool; }
+
+        template<typename TOther>
+        SKL_FORCEINLINE SKL_NODISCARD bool operator==( const STLTLSNodeAllocator<TOther>& Other ) const noexcept { return Pool == Other.GetPool(); }
+
+    private:
+        STLNodePool* Pool; //!< Node pool shared by all the copies of this allocator
+    };
+
+    //! FrameArena allocator, the memory is valid until the end of the current tick
+    //! \remarks deallocate() is a no-op, the memory is reclaimed in bulk when the worker's FrameArena is reset
+    template<typename T>
+    class STLFrameAllocator
+    {
+    public:
+        static_assert( false == std::is_const_v<T>, "The C++ Standard forbids containers of const elements "
+                                                       "because allocator<const T> is ill-formed." );
+
+        using value_type      = std::conditional_t<std::is_array_v<T>, std::remove_all_extents_t<T>, T>;
+        using size_type       = uint32_t;
+        using difference_type = ptrdiff_t;
+        using pointer         = T*;
+        using const_pointer   = const T*;
+        using reference       = T&;
+        using const_reference = const T&;
+
+        using propagate_on_container_move_assignment           = std::true_type;
+        //using is_always_equal _CXX20_DEPRECATE_IS_ALWAYS_EQUAL = std::true_type;
+
+        constexpr STLFrameAllocator() noexcept {}
+        constexpr STLFrameAllocator( const STLFrameAllocator& ) noexcept = default;
+        template <class _Other>
+        constexpr STLFrameAllocator( const STLFrameAllocator<_Other>& ) noexcept {}
+
+        constexpr ~STLFrameAllocator() = default;
+        constexpr STLFrameAllocator& operator=( const STLFrameAllocator& ) = default;
+
+        constexpr void deallocate( T* const InPtr, const size_t InCount ) noexcept
+        {
+            SKL_ASSERT_MSG( InPtr != nullptr || InCount == 0, "null pointer cannot point to a block of non-zero size");
+            ( void )InPtr;
+            ( void )InCount;
+        }
+
+        SKL_NODISCARD constexpr SKL_ALLOCATOR_FUNCTION T* allocate( const size_t InCount ) noexcept 
+        {
+            static_assert( sizeof(value_type) > 0, "value_type must be complete before calling allocate." );
+
+            constexpr uint32_t TSize{ static_cast<uint32_t>( sizeof( T ) ) };
+#if !defined(SKL_BUILD_SHIPPING)
+            constexpr bool bOverflowIsPossible{ TSize > 1 };
+            if constexpr( true == bOverflowIsPossible ) 
+            {
+                constexpr uint32_t MaxPossible{ static_cast<uint32_t>( -1 ) / TSize };
+                SKL_ASSERT_MSG( static_cast<uint32_t>( InCount ) <= MaxPossible, "STLFrameAllocator<T>::allocate() multiply overflow" );
+            }
+#endif
+            const uint32_t AllocateSize{ TSize * static_cast<uint32_t>( InCount ) };
+            auto* Result{ FrameArena::Allocate( AllocateSize, alignof( T ) ) };
+            if( nullptr == Result ) SKL_UNLIKELY
+            {
+                GLOG_DEBUG( "STLFrameAllocator<T>::Allocate() Failed to allocate %u bytes (%llu items)", AllocateSize, InCount );
+                return nullptr;
+            }
+            
+            return reinterpret_cast<T*>( Result );
+        }
+    };
 }
 
 namespace SKL
@@ -156,6 +552,18 @@ namespace SKL
     template<typename T>
     using TLSManagedQueue = std::queue<T, std::deque<T, STLTLSAllocator<T>>>;
 
+    //! ThreadLocalMemoryManager stl deque, the blocks are recycled by a per container node pool
+    template<typename T>
+    using TLSNodeManagedDeque = std::deque<T, STLTLSNodeAllocator<T>>;
+
+    //! ThreadLocalMemoryManager stl queue, the blocks are recycled by a per container node pool
+    template<typename T>
+    using TLSNodeManagedQueue = std::queue<T, TLSNodeManagedDeque<T>>;
+
+    //! ThreadLocalMemoryManager stl map, the nodes are recycled by a per container node pool
+    template<typename TKey, typename TValue, typename Comparator = std::less<TKey>>
+    using TLSNodeManagedMap = std::map<TKey, TValue, Comparator, STLTLSNodeAllocator<std::pair<const TKey, TValue>>>;
+
     //! GlobalMemoryManager stl vector
     template<typename T>
     using ManagedVector = std::vector<T, STLAllocator<T>>;
@@ -164,6 +572,10 @@ namespace SKL
     template<typename T>
     using TLSManagedVector = std::vector<T, STLTLSAllocator<T>>;
 
+    //! FrameArena stl vector [valid until the end of the current tick]
+    template<typename T>
+    using FrameVector = std::vector<T, STLFrameAllocator<T>>;
+
     //! GlobalMemoryManager stl vector
     template<typename T>
     using ManagedStack = std::stack<T, ManagedDeque<T>>;
@@ -271,6 +271,52 @@ namespace SKL
                 MemoryPolicy::DecrementReferenceForObject( InPtr );
             }
         }
+
+        //! 
+        //! Increment the reference count for InPtr by InCount in one atomic operation
+        //! 
+        //! \invariant InPtr must be a valid pointer allocated using the same MemoryPolicy as this call
+        //! \remarks Use to hand out InCount references to the same object (eg. fan out one buffer to many targets)
+        //! 
+        SKL_FORCEINLINE static void Static_AddReferences( TObjectDecay* InPtr, uint32_t InCount ) noexcept
+        {
+            SKL_ASSERT( nullptr != InPtr );
+
+            if constexpr( std::is_array_v<TObject> )
+            {
+                MemoryPolicy::IncrementReferencesForArray( InPtr, InCount );
+            }
+            else
+            {
+                MemoryPolicy::IncrementReferencesForObject( InPtr, InCount );
+            }
+        }
+
+        //! 
+        //! Release InCount shared references for InPtr
+        //! 
+        //! \invariant InPtr must be a valid pointer allocated using the same MemoryPolicy as this call
+        //! \remarks InCount - 1 references are released in one atomic operation, the last one is released through Static_Reset()
+        //! 
+        SKL_FORCEINLINE static void Static_ResetMultiple( TObjectDecay* InPtr, uint32_t InCount ) noexcept
+        {
+            SKL_ASSERT( nullptr != InPtr );
+            SKL_ASSERT( 0U != InCount );
+
+            if( 1U < InCount )
+            {
+                if constexpr( std::is_array_v<TObject> )
+                {
+                    MemoryPolicy::DecrementReferencesForArray( InPtr, InCount - 1U );
+                }
+                else
+                {
+                    MemoryPolicy::DecrementReferencesForObject( InPtr, InCount - 1U );
+                }
+            }
+
+            Static_Reset( InPtr );
+        }
         
         //! 
         //! Increment the reference count for InPtr
@@ -356,6 +402,282 @@ namespace SKL
     template<typename TObject, bool bDestruct = true>
     using TVirtualDeletedSharedPtr = TSharedPtr<TObject, typename SKL::MemoryStrategy::SharedMemoryStrategy<TObject, true>, bDestruct>;
 
+    //! Shared object that can be weak referenced [see TWeakPtr, MakeSharedWeakable()]
+    template<typename TObject>
+    using TWeakableSharedPtr = TSharedPtr<TObject, typename SKL::MemoryStrategy::WeakSharedMemoryStrategy<TObject>>;
+
+    //! 
+    //! Thread confined shared pointer, the reference count is updated with plain (non locked) loads and stores
+    //! 
+    //! \remarks Only for objects allocated through the ThreadLocalMemoryManager [see TLSMakeLocalShared()], the memory strategy is fixed to TLSMemoryStrategy::LocalSharedMemoryStrategy
+    //! \remarks Must not leave the thread that allocated the object [asserted in non shipping builds], use ToShared() to get a TSharedPtr that can cross threads
+    //! \remarks Once ToShared() is called the object is marked as escaped and all its references, local ones included, use atomic operations
+    //! \remarks The last reference of an escaped object can be released on any thread, the memory block is returned to the allocating thread [see ThreadLocalMemoryManager::DeallocateFromAnyThread()]
+    //! 
+    template<typename TObject, bool bVirtualDeleter = false, bool bDestruct = true>
+    struct TLocalSharedPtr
+    {
+        static_assert( false == bVirtualDeleter, "Virtual deleter for thread local shared objects not yet supported" );
+
+        using MyType         = TLocalSharedPtr<TObject, bVirtualDeleter, bDestruct>;
+        using TObjectDecay   = std::remove_all_extents_t<TObject>;
+        using element_type   = TObjectDecay;
+        using MemoryStrategy = typename SKL::TLSMemoryStrategy::LocalSharedMemoryStrategy<TObject>;
+        using MemoryPolicy   = typename MemoryStrategy::MemoryPolicy;
+        using SharedPtrType  = TSharedPtr<TObject, MemoryStrategy, bDestruct>;
+
+        TLocalSharedPtr() noexcept = default;
+        explicit TLocalSharedPtr( TObjectDecay* InPointer ) noexcept : Pointer{ InPointer } {}
+        TLocalSharedPtr( const TLocalSharedPtr& Other ) noexcept : Pointer{ Other.Pointer } 
+        { 
+            Other.AssertOwnerThread();
+            if( nullptr != Pointer ){ Static_IncrementReference( Pointer ); } 
+        }
+        TLocalSharedPtr( TLocalSharedPtr&& Other ) noexcept : Pointer{ Other.Pointer } 
+        { 
+            Other.AssertOwnerThread();
+            Other.Pointer = nullptr; 
+        }
+        TLocalSharedPtr& operator=( const TLocalSharedPtr& Other ) noexcept
+        {
+            SKL_ASSERT( this != &Other );
+            Other.AssertOwnerThread();
+
+            reset();
+
+            Pointer = Other.Pointer;
+            if( nullptr != Pointer )
+            { 
+                Static_IncrementReference( Pointer ); 
+            }
+
+            return *this;
+        }
+        TLocalSharedPtr& operator=( TLocalSharedPtr&& Other ) noexcept
+        {
+            SKL_ASSERT( this != &Other );
+            Other.AssertOwnerThread();
+
+            reset();
+
+            Pointer       = Other.Pointer;
+            Other.Pointer = nullptr;
+
+            return *this;
+        }
+        ~TLocalSharedPtr() noexcept
+        {
+            reset();
+        }
+
+        // STL compatible API
+        SKL_FORCEINLINE SKL_NODISCARD          TObjectDecay* get()        const noexcept { AssertOwnerThread(); return Pointer; }
+        SKL_FORCEINLINE SKL_NODISCARD          TObjectDecay* operator->() const noexcept { AssertOwnerThread(); SKL_ASSERT( Pointer != nullptr ); return Pointer; }
+        SKL_FORCEINLINE SKL_NODISCARD          TObjectDecay& operator*()  const noexcept { AssertOwnerThread(); SKL_ASSERT( Pointer != nullptr ); return *Pointer; }
+        SKL_FORCEINLINE SKL_NODISCARD          size_t        use_count()  const noexcept { SKL_ASSERT( Pointer != nullptr ); return static_cast<size_t>( GetControlBlock( Pointer ).GetReferenceCount() ); }
+        SKL_FORCEINLINE SKL_NODISCARD explicit               operator bool() const noexcept { return nullptr != Pointer; }
+        SKL_FORCEINLINE SKL_NODISCARD          bool          is_escaped() const noexcept { SKL_ASSERT( Pointer != nullptr ); return GetControlBlock( Pointer ).IsEscaped(); }
+
+        //! Release the held reference
+        SKL_FORCEINLINE void reset() noexcept 
+        { 
+            if( nullptr != Pointer ) SKL_LIKELY 
+            { 
+                AssertOwnerThread();
+                Static_Reset( Pointer ); 
+                Pointer = nullptr;  
+            } 
+        }
+
+        //! Get a new atomic reference to the object, that can be passed to other threads
+        //! \remarks The object is marked as escaped, all the local references to it will use atomic operations from now on
+        SKL_NODISCARD SharedPtrType ToShared() const noexcept
+        {
+            if( nullptr == Pointer )
+            {
+                return {};
+            }
+
+            AssertOwnerThread();
+
+            auto& CBlock{ GetControlBlock( Pointer ) };
+            CBlock.MarkEscaped();
+            CBlock.AddReference();
+
+            return { Pointer };
+        }
+
+        //! Move the held reference into an atomic TSharedPtr, that can be passed to other threads
+        //! \remarks The object is marked as escaped, all the local references to it will use atomic operations from now on
+        SKL_NODISCARD SharedPtrType MoveToShared() noexcept
+        {
+            if( nullptr == Pointer )
+            {
+                return {};
+            }
+
+            AssertOwnerThread();
+
+            GetControlBlock( Pointer ).MarkEscaped();
+
+            TObjectDecay* Result{ Pointer };
+            Pointer = nullptr;
+            return { Result };
+        }
+
+        //! Increment the reference count for InPtr [plain increment unless the object escaped]
+        SKL_FORCEINLINE static void Static_IncrementReference( TObjectDecay* InPtr ) noexcept
+        {
+            SKL_ASSERT( nullptr != InPtr );
+            GetControlBlock( InPtr ).AddReferenceLocal();
+        }
+
+        //! Release the reference for InPtr, the last reference and the references of escaped objects are released through the atomic TSharedPtr path
+        SKL_FORCEINLINE static void Static_Reset( TObjectDecay* InPtr ) noexcept
+        {
+            SKL_ASSERT( nullptr != InPtr );
+
+            if( false == GetControlBlock( InPtr ).TryReleaseReferenceLocal() ) SKL_UNLIKELY
+            {
+                SharedPtrType::Static_Reset( InPtr );
+            }
+        }
+
+    private:
+        SKL_FORCEINLINE SKL_NODISCARD static SKL::MemoryPolicy::ControlBlock& GetControlBlock( TObjectDecay* InPtr ) noexcept
+        {
+            if constexpr( std::is_array_v<TObject> )
+            {
+                return MemoryPolicy::GetControlBlockForArray( InPtr );
+            }
+            else
+            {
+                return MemoryPolicy::GetControlBlockForObject( InPtr );
+            }
+        }
+
+        SKL_FORCEINLINE void AssertOwnerThread() const noexcept
+        {
+#if !defined(SKL_BUILD_SHIPPING)
+            SKL_ASSERT_MSG( OwnerThreadId == GetCurrentThreadId(), "TLocalSharedPtr used outside of its owner thread, use ToShared() to pass the object to other threads!" );
+#endif
+        }
+
+        TObjectDecay* Pointer      { nullptr };                //!< Raw ptr to the thread confined shared object
+#if !defined(SKL_BUILD_SHIPPING)
+        uint32_t      OwnerThreadId{ GetCurrentThreadId() };   //!< Thread that created this pointer
+#endif
+    };
+
+    //! 
+    //! Weak reference to an object owned by TWeakableSharedPtr, does not keep the object alive
+    //! 
+    //! \remarks The object is destroyed when the last TWeakableSharedPtr is released, the memory block is freed when the last TWeakPtr is released as well
+    //! \remarks Lock() is lock-free, it only succeeds while at least one TWeakableSharedPtr to the object exists
+    //! \remarks Only for objects allocated through MakeSharedWeakable(), the default shared objects keep the 8 bytes control block without weak ref count
+    //! 
+    template<typename TObject>
+    struct TWeakPtr
+    {
+        using TObjectDecay   = std::remove_all_extents_t<TObject>;
+        using element_type   = TObjectDecay;
+        using MemoryStrategy = typename SKL::MemoryStrategy::WeakSharedMemoryStrategy<TObject>;
+        using MemoryPolicy   = typename MemoryStrategy::MemoryPolicy;
+        using SharedPtrType  = TSharedPtr<TObject, MemoryStrategy, true>;
+
+        static_assert( false == std::is_array_v<TObject>, "Weak references to shared arrays are not supported!" );
+
+        TWeakPtr() noexcept = default;
+        TWeakPtr( const SharedPtrType& InShared ) noexcept : Pointer{ InShared.get() } { if( nullptr != Pointer ){ GetControlBlock( Pointer ).AddWeakReference(); } }
+        TWeakPtr( const TWeakPtr& Other ) noexcept : Pointer{ Other.Pointer } { if( nullptr != Pointer ){ GetControlBlock( Pointer ).AddWeakReference(); } }
+        TWeakPtr( TWeakPtr&& Other ) noexcept : Pointer{ Other.Pointer } { Other.Pointer = nullptr; }
+        TWeakPtr& operator=( const TWeakPtr& Other ) noexcept
+        {
+            SKL_ASSERT( this != &Other );
+
+            reset();
+
+            Pointer = Other.Pointer;
+            if( nullptr != Pointer )
+            {
+                GetControlBlock( Pointer ).AddWeakReference();
+            }
+
+            return *this;
+        }
+        TWeakPtr& operator=( TWeakPtr&& Other ) noexcept
+        {
+            SKL_ASSERT( this != &Other );
+
+            reset();
+
+            Pointer       = Other.Pointer;
+            Other.Pointer = nullptr;
+
+            return *this;
+        }
+        TWeakPtr& operator=( const SharedPtrType& InShared ) noexcept
+        {
+            reset();
+
+            Pointer = InShared.get();
+            if( nullptr != Pointer )
+            {
+                GetControlBlock( Pointer ).AddWeakReference();
+            }
+
+            return *this;
+        }
+        ~TWeakPtr() noexcept
+        {
+            reset();
+        }
+
+        //! Try to get a strong reference to the object
+        //! \returns empty TSharedPtr if the object was destroyed
+        SKL_NODISCARD SharedPtrType Lock() const noexcept
+        {
+            if( nullptr != Pointer && true == GetControlBlock( Pointer ).TryAddReference() ) SKL_LIKELY
+            {
+                return { Pointer };
+            }
+
+            return {};
+        }
+
+        //! Was the object destroyed [or is this pointer empty]
+        SKL_FORCEINLINE SKL_NODISCARD bool expired() const noexcept { return nullptr == Pointer || 0U == GetControlBlock( Pointer ).GetReferenceCount(); }
+
+        //! Get the number of strong references to the object
+        SKL_FORCEINLINE SKL_NODISCARD size_t use_count() const noexcept { return nullptr == Pointer ? 0U : static_cast<size_t>( GetControlBlock( Pointer ).GetReferenceCount() ); }
+
+        //! Does this pointer reference the same object as InShared [valid even if the object was destroyed]
+        SKL_FORCEINLINE SKL_NODISCARD bool IsSameObject( const SharedPtrType& InShared ) const noexcept { return Pointer == InShared.get(); }
+
+        //! Release the weak reference, frees the memory block if the object was destroyed and this was the last weak reference
+        void reset() noexcept
+        {
+            if( nullptr != Pointer ) SKL_LIKELY
+            {
+                auto& CBlock{ GetControlBlock( Pointer ) };
+                Pointer = nullptr;
+
+                if( true == CBlock.ReleaseWeakReference() ) SKL_UNLIKELY
+                {
+                    GlobalMemoryManager::Deallocate( &CBlock, static_cast<size_t>( CBlock.BlockSize ) );
+                }
+            }
+        }
+
+    private:
+        SKL_FORCEINLINE SKL_NODISCARD static SKL::MemoryPolicy::WeakControlBlock& GetControlBlock( TObjectDecay* InPtr ) noexcept
+        {
+            return MemoryPolicy::GetWeakControlBlockForObject( InPtr );
+        }
+
+        TObjectDecay* Pointer{ nullptr }; //!< Raw ptr to the shared object, the object is alive only while the ref count is not 0
+    };
+
     template<typename TObject, typename TMemoryStrategy = typename SKL::MemoryStrategy::SharedMemoryStrategy<TObject>, bool bDestruct = true>
     struct TLockedSharedPtr
     {
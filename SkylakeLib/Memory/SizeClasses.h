@@ -0,0 +1,195 @@
+//!
+//! \file SizeClasses.h
+//!
+//! \brief Geometrically spaced memory block size classes
+//!
+//! \author Balan Narcis (balannarcis96@gmail.com)
+//!
+#pragma once
+
+namespace SKL
+{
+    //! Table of geometrically spaced size classes
+    //! \remarks Class 0 is TSpacingPercent larger than TMinSize (exclusive lower bound), each next class is TSpacingPercent larger than the previous one
+    //! \remarks All class sizes are rounded up to TGranularity
+    template<size_t TMinSize, size_t TClassesCount, size_t TSpacingPercent, size_t TGranularity = SKL_CACHE_LINE_SIZE>
+    struct SizeClassesTable
+    {
+        static_assert( 0U < TSpacingPercent, "The size classes must grow" );
+        static_assert( 0U < TGranularity && 0U == ( TGranularity & ( TGranularity - 1U ) ), "The size classes granularity must be a power of two" );
+
+        static constexpr size_t MinSize      = TMinSize;
+        static constexpr size_t ClassesCount = TClassesCount;
+
+        //! Build the size of each class
+        static consteval std::array<size_t, ClassesCount> BuildSizes() noexcept
+        {
+            std::array<size_t, ClassesCount> Result{};
+
+            size_t Previous{ MinSize };
+            for( size_t i = 0; i < ClassesCount; ++i )
+            {
+                size_t Next{ Previous + ( Previous * TSpacingPercent ) / 100U };
+                Next = ( Next + TGranularity - 1U ) & ~( TGranularity - 1U );
+                if( Next <= Previous )
+                {
+                    Next = Previous + TGranularity;
+                }
+
+                Result[i] = Next;
+                Previous  = Next;
+            }
+
+            return Result;
+        }
+
+        static constexpr std::array<size_t, ClassesCount> Sizes   = BuildSizes();
+        static constexpr size_t                           MaxSize = 0U == ClassesCount ? MinSize : Sizes[ClassesCount - 1U];
+
+        //! Is InSize served by one of the size classes
+        SKL_FORCEINLINE SKL_NODISCARD static constexpr bool IsInRange( size_t InSize ) noexcept
+        {
+            return MinSize < InSize && InSize <= MaxSize;
+        }
+
+        //! Get the index of the smallest class that fits InSize [InSize must be in range, see IsInRange()]
+        SKL_FORCEINLINE SKL_NODISCARD static constexpr size_t GetClassIndex( size_t InSize ) noexcept
+        {
+            SKL_ASSERT( true == IsInRange( InSize ) );
+            return static_cast<size_t>( std::lower_bound( Sizes.begin(), Sizes.end(), InSize ) - Sizes.begin() );
+        }
+
+        //! Index of the smallest class that fits TSize, resolved at compile time
+        template<size_t TSize>
+        static constexpr size_t ClassIndexOf = GetClassIndex( TSize );
+
+        //! Number of blocks of the class InClassIndex that fit in InPoolBytes, rounded down to a power of two [at least one, the object pools require a power of two size]
+        SKL_FORCEINLINE SKL_NODISCARD static constexpr size_t GetBlockCount( size_t InClassIndex, size_t InPoolBytes ) noexcept
+        {
+            const size_t MaxBlocks{ InPoolBytes / Sizes[InClassIndex] };
+
+            size_t Result{ 1U };
+            while( ( Result << 1U ) <= MaxBlocks )
+            {
+                Result <<= 1U;
+            }
+
+            return Result;
+        }
+
+        //! Call InFunctor( std::integral_constant<size_t, ClassIndex> ) for each class
+        template<typename TFunctor>
+        SKL_FORCEINLINE static void ForEachClass( TFunctor&& InFunctor ) noexcept
+        {
+            [&]<size_t... ClassIndices>( std::index_sequence<ClassIndices...> ) noexcept -> void
+            {
+                ( InFunctor( std::integral_constant<size_t, ClassIndices>{} ), ... );
+            }( std::make_index_sequence<ClassesCount>{} );
+        }
+
+        //! Call InFunctor( std::integral_constant<size_t, ClassIndex> ) for the class InClassIndex only [run time index to compile time index]
+        template<typename TFunctor>
+        SKL_FORCEINLINE static void VisitClass( size_t InClassIndex, TFunctor&& InFunctor ) noexcept
+        {
+            SKL_ASSERT( InClassIndex < ClassesCount );
+
+            [&]<size_t... ClassIndices>( std::index_sequence<ClassIndices...> ) noexcept -> void
+            {
+                ( void )( ( ClassIndices == InClassIndex && ( InFunctor( std::integral_constant<size_t, ClassIndices>{} ), true ) ) || ... );
+            }( std::make_index_sequence<ClassesCount>{} );
+        }
+    };
+
+    //! std::tuple of one pool per size class [TPoolForClass<ClassIndex>]
+    template<typename TSizeClasses, template<size_t> typename TPoolForClass, typename TClassIndices = std::make_index_sequence<TSizeClasses::ClassesCount>>
+    struct SizeClassesPools;
+
+    template<typename TSizeClasses, template<size_t> typename TPoolForClass, size_t... ClassIndices>
+    struct SizeClassesPools<TSizeClasses, TPoolForClass, std::index_sequence<ClassIndices...>>
+    {
+        using Type = std::tuple<TPoolForClass<ClassIndices>...>;
+    };
+
+    //! Per size class allocation statistics, used to report the internal fragmentation of each class
+    template<typename TSizeClasses, bool bThreadSafe>
+    struct SizeClassesStatistics
+    {
+        using TValue = std::conditional_t<bThreadSafe, std::atomic<uint64_t>, uint64_t>;
+
+        //! Record one allocation of InRequestedSize bytes served by the class InClassIndex
+        SKL_FORCEINLINE void OnAllocation( size_t InClassIndex, size_t InRequestedSize ) noexcept
+        {
+            SKL_ASSERT( InClassIndex < TSizeClasses::ClassesCount );
+
+            if constexpr( bThreadSafe )
+            {
+                ( void )Allocations[InClassIndex].fetch_add( 1U, std::memory_order_relaxed );
+                ( void )RequestedBytes[InClassIndex].fetch_add( static_cast<uint64_t>( InRequestedSize ), std::memory_order_relaxed );
+            }
+            else
+            {
+                ( void )++Allocations[InClassIndex];
+                RequestedBytes[InClassIndex] += static_cast<uint64_t>( InRequestedSize );
+            }
+        }
+
+        //! Get the number of allocations served by the class InClassIndex
+        SKL_FORCEINLINE SKL_NODISCARD uint64_t GetAllocations( size_t InClassIndex ) const noexcept
+        {
+            if constexpr( bThreadSafe )
+            {
+                return Allocations[InClassIndex].load( std::memory_order_relaxed );
+            }
+            else
+            {
+                return Allocations[InClassIndex];
+            }
+        }
+
+        //! Get the total number of bytes requested from the class InClassIndex
+        SKL_FORCEINLINE SKL_NODISCARD uint64_t GetRequestedBytes( size_t InClassIndex ) const noexcept
+        {
+            if constexpr( bThreadSafe )
+            {
+                return RequestedBytes[InClassIndex].load( std::memory_order_relaxed );
+            }
+            else
+            {
+                return RequestedBytes[InClassIndex];
+            }
+        }
+
+        //! Get the fragmentation ratio of the class InClassIndex [0.0 - every byte of the served blocks was requested, 1.0 - every byte was wasted]
+        SKL_NODISCARD double GetFragmentationRatio( size_t InClassIndex ) const noexcept
+        {
+            const uint64_t AllocationsCount{ GetAllocations( InClassIndex ) };
+            if( 0U == AllocationsCount )
+            {
+                return 0.0;
+            }
+
+            const double ServedBytes{ static_cast<double>( AllocationsCount ) * static_cast<double>( TSizeClasses::Sizes[InClassIndex] ) };
+            return 1.0 - ( static_cast<double>( GetRequestedBytes( InClassIndex ) ) / ServedBytes );
+        }
+
+        //! Log the fragmentation ratio of each class
+        void LogReport( const wchar_t* InName ) const noexcept
+        {
+            GLOG_INFO( "[%ws] Size classes report ################################################", InName );
+            for( size_t i = 0; i < TSizeClasses::ClassesCount; ++i )
+            {
+                GLOG_INFO( "[%ws] SizeClass[%2llu] %6llu bytes -> Allocations:%llu RequestedBytes:%llu Fragmentation:%.2f%%"
+                         , InName
+                         , static_cast<unsigned long long>( i )
+                         , static_cast<unsigned long long>( TSizeClasses::Sizes[i] )
+                         , static_cast<unsigned long long>( GetAllocations( i ) )
+                         , static_cast<unsigned long long>( GetRequestedBytes( i ) )
+                         , GetFragmentationRatio( i ) * 100.0 );
+            }
+        }
+
+    private:
+        TValue Allocations   [TSizeClasses::ClassesCount == 0U ? 1U : TSizeClasses::ClassesCount]{}; //!< Allocations count for each class
+        TValue RequestedBytes[TSizeClasses::ClassesCount == 0U ? 1U : TSizeClasses::ClassesCount]{}; //!< Total requested bytes for each class
+    };
+}
@@ -0,0 +1,54 @@
+//!
+//! \file SlabRegistry.h
+//!
+//! \brief Registry of the memory pools slabs, keeps a released slab alive until all its blocks are returned
+//!
+//! \author Balan Narcis (balannarcis96@gmail.com)
+//!
+#pragma once
+
+namespace SKL
+{
+    //! How the slab memory was allocated [selects the matching free function]
+    enum class ESlabSource : uint8_t
+    {
+        Heap,       //!< SKL_MALLOC_ALIGNED
+        LargePages, //!< GAllocLargePages()
+        NumaNode    //!< GAllocOnNumaNode()
+    };
+
+    //! Registry of all the slabs carved by the memory pools
+    //! \remarks A pool releases its slab in FreePool(), if some of the slab blocks are still in use the slab is kept alive and freed together with its last block
+    //! \remarks The pools free all the blocks they can't cache through FreeBlock(), only the blocks that don't belong to any slab (OS allocated) are freed to the OS
+    struct SlabRegistry
+    {
+        //! Register a newly allocated slab
+        static void Register( void* InSlab, size_t InSlabSize ) noexcept;
+
+        //! Release the slab of a pool, the slab is freed now if InOutstandingBlocks is 0, otherwise after the last of the InOutstandingBlocks is freed [see FreeBlock()]
+        static void Release( void* InSlab, size_t InSlabSize, size_t InAlignment, ESlabSource InSource, size_t InOutstandingBlocks ) noexcept;
+
+        //! Free a block that is not cached by its pool
+        //! \remarks Blocks of released slabs are counted back, the slab is freed with its last block
+        //! \remarks Blocks of slabs still owned by a pool are never freed, they must be returned to their own pool [asserted]
+        //! \remarks All the other blocks are freed to the OS
+        SKL_FORCEINLINE static void FreeBlock( void* InBlock, size_t InBlockSize, size_t InAlignment ) noexcept
+        {
+            if( 0U == SlabsCount.load_relaxed() ) SKL_LIKELY
+            {
+                SKL_FREE_SIZE_ALIGNED( InBlock, InBlockSize, InAlignment );
+                return;
+            }
+
+            FreeBlockSlow( InBlock, InBlockSize, InAlignment );
+        }
+
+        //! Get the number of released slabs still waiting for their blocks
+        SKL_NODISCARD static size_t GetPendingSlabsCount() noexcept;
+
+    private:
+        static void FreeBlockSlow( void* InBlock, size_t InBlockSize, size_t InAlignment ) noexcept;
+
+        SKL_CACHE_ALIGNED static std::synced_value<size_t> SlabsCount; //!< Number of registered slabs [live and pending release]
+    };
+}
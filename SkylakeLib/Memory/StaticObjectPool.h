@@ -9,13 +9,22 @@
 //!         bUseSpinLock:
 //!             [true] : SpinLock is used for thread synchronization [default]
 //!             [false]: Atomic operations are used for thread synchronization (might spill when under heavy contention)
+//!         bUseSlab:
+//!             [true] : Preallocate() reserves one contiguous region (slab) and carves all the pool blocks out of it, FreePool() releases it in one call
+//!             [false]: Preallocate() allocates each pool block separately [default]
+//!         bUseLargePages:
+//!             [true] : The slab is backed by large (huge) pages if possible, falls back to regular pages [requires bUseSlab]
+//!             [false]: The slab is allocated with SKL_MALLOC_ALIGNED [default]
+//!         NumaNode:
+//!             [CNoNumaNode]: The slab memory is taken from any NUMA node [default]
+//!             [Node Index] : The slab memory is preferably taken from the given NUMA node [requires bUseSlab]
 //!         
 //! \author Balan Narcis (balannarcis96@gmail.com)
 //! 
 
 namespace SKL
 {
-    template<typename T, size_t PoolSize, bool TbNoSync = false, bool TbUseSpinLock = true, bool TbPerformConstruction = true, bool TbPerformDestruction = true, size_t TAlignment = SKL_ALIGNMENT>
+    template<typename T, size_t PoolSize, bool TbNoSync = false, bool TbUseSpinLock = true, bool TbPerformConstruction = true, bool TbPerformDestruction = true, size_t TAlignment = SKL_ALIGNMENT, bool TbUseSlab = false, bool TbUseLargePages = false, uint32_t TNumaNode = CNoNumaNode>
     class ObjectPool
     {
     public:
@@ -29,6 +38,13 @@ namespace SKL
             static constexpr bool   bUseSpinLock        { bNoSync || TbUseSpinLock };
             static constexpr bool   bPerformConstruction{ TbPerformConstruction };
             static constexpr bool   bPerformDestruction { TbPerformDestruction };
+            static constexpr bool   bUseSlab            { TbUseSlab };
+            static constexpr bool   bUseLargePages      { TbUseSlab && TbUseLargePages };
+            static constexpr uint32_t NumaNode          { TNumaNode };
+            static constexpr bool   bUseNumaNode        { TbUseSlab && CNoNumaNode != TNumaNode };
+            static constexpr size_t SlabBlockSize       { ( ( MyObjectSize + Alignment - 1 ) / Alignment ) * Alignment };
+            static constexpr size_t SlabSize            { SlabBlockSize * MyPoolSize };
+            static constexpr ESlabSource SlabSource     { bUseLargePages ? ESlabSource::LargePages : ( bUseNumaNode ? ESlabSource::NumaNode : ESlabSource::Heap ) };
 
             using MyPoolType    = T;
             using MyType        = ObjectPool<T, PoolSize>;
@@ -43,6 +59,42 @@ namespace SKL
         //! Preallocate and fill the whole Pool with [PoolSize] elements
         constexpr static RStatus Preallocate() noexcept
         {
+            if constexpr( PoolTraits::bUseSlab )
+            {
+                SKL_ASSERT( nullptr == Slab );
+
+                // one allocation for the whole pool, the blocks are carved out of it
+                if constexpr( PoolTraits::bUseLargePages )
+                {
+                    Slab = reinterpret_cast<uint8_t*>( GAllocLargePages( PoolTraits::SlabSize, bIsSlabOnLargePages, PoolTraits::NumaNode ) );
+                }
+                else if constexpr( PoolTraits::bUseNumaNode )
+                {
+                    Slab = reinterpret_cast<uint8_t*>( GAllocOnNumaNode( PoolTraits::SlabSize, PoolTraits::NumaNode ) );
+                }
+                else
+                {
+                    Slab = reinterpret_cast<uint8_t*>( SKL_MALLOC_ALIGNED( PoolTraits::SlabSize, PoolTraits::Alignment ) );
+                }
+
+                if( nullptr == Slab ) SKL_UNLIKELY
+                {
+                    return RFail;
+                }
+
+                SKL_ASSERT( ((uintptr_t)Slab) % PoolTraits::Alignment == 0 );
+                SKL_IFSHIPPING( memset( Slab, 0, PoolTraits::SlabSize ) );
+
+                for( size_t i = 0; i < PoolSize; i++ )
+                {
+                    Pool[i] = reinterpret_cast<void*>( Slab + ( i * PoolTraits::SlabBlockSize ) );
+                }
+
+                SlabRegistry::Register( Slab, PoolTraits::SlabSize );
+
+                return RSuccess;
+            }
+
             // ! Hopefully SKL_MALLOC_ALIGNED will allocate in a continuous fashion.
             for( size_t i = 0; i < PoolSize; i++ )
             {
@@ -61,8 +113,11 @@ namespace SKL
         }
 
         //! Safely free all pool blocks
+        //! \remarks If some of the slab blocks are still in use the slab is freed only after the last of them is deallocated [see SlabRegistry]
         constexpr static void FreePool() noexcept
         {
+            size_t CachedSlabBlocks{ 0U };
+
             if constexpr ( false == PoolTraits::bNoSync )
             {
                 if constexpr( true == PoolTraits::bUseSpinLock )
@@ -76,7 +131,7 @@ namespace SKL
                             Pool[i] = nullptr;
                             if( nullptr != PopValue )
                             {
-                                SKL_FREE_SIZE_ALIGNED( PopValue, PoolTraits::MyObjectSize, PoolTraits::Alignment );
+                                FreeCachedBlock( PopValue, CachedSlabBlocks );
                             }
                         }
                     }
@@ -88,7 +143,7 @@ namespace SKL
                         auto* PopValue = Pool[i].exchange( nullptr );
                         if( nullptr != PopValue )
                         {
-                            SKL_FREE_SIZE_ALIGNED( PopValue, PoolTraits::MyObjectSize, PoolTraits::Alignment );
+                            FreeCachedBlock( PopValue, CachedSlabBlocks );
                         }
                     }
                 }
@@ -101,11 +156,24 @@ namespace SKL
                     Pool[i] = nullptr;
                     if( nullptr != PopValue )
                     {
-                        SKL_FREE_SIZE_ALIGNED( PopValue, PoolTraits::MyObjectSize, PoolTraits::Alignment );
+                        FreeCachedBlock( PopValue, CachedSlabBlocks );
                     }
                 }
             }
 
+            if constexpr( PoolTraits::bUseSlab )
+            {
+                if( nullptr != Slab )
+                {
+                    // all the slab blocks are released at once, when the last block in use is deallocated if any
+                    SKL_ASSERT( CachedSlabBlocks <= PoolSize );
+                    SlabRegistry::Release( Slab, PoolTraits::SlabSize, PoolTraits::Alignment, PoolTraits::SlabSource, PoolSize - CachedSlabBlocks );
+
+                    Slab                = nullptr;
+                    bIsSlabOnLargePages = false;
+                }
+            }
+
 #if defined(SKL_MEMORY_STATISTICS) 
             TotalAllocations     = 0;
             TotalDeallocations   = 0;
@@ -128,8 +196,22 @@ namespace SKL
         }
 
         //! Zero all pool items [not thread safe]
+        //! \remarks When slab backed the whole slab is zeroed in one go, call it before any block is handed out
         constexpr static void ZeroAllMemory() noexcept
         {
+            if constexpr( PoolTraits::bUseSlab )
+            {
+                if( nullptr != Slab )
+                {
+                    // large pages are resident and zeroed from the moment they are allocated, no need to touch them
+                    if( false == bIsSlabOnLargePages )
+                    {
+                        memset( Slab, 0, PoolTraits::SlabSize );
+                    }
+                    return;
+                }
+            }
+
             for( size_t i = 0; i < PoolSize; i++ )
             {
                 memset( Pool[i], 0, sizeof( T ) );
@@ -142,6 +224,88 @@ namespace SKL
             return reinterpret_cast< size_t >( &PoolTraits::MyType::Preallocate );
         }
 
+        //! Is the block carved out of this pool's slab
+        //! \remarks Simple range check, always false if the pool is not slab backed or the slab is not allocated
+        SKL_FORCEINLINE SKL_NODISCARD constexpr static bool IsOwnedBySlab( const void* InBlock ) noexcept
+        {
+            if constexpr( PoolTraits::bUseSlab )
+            {
+                return nullptr != Slab && ( reinterpret_cast<uintptr_t>( InBlock ) - reinterpret_cast<uintptr_t>( Slab ) ) < PoolTraits::SlabSize;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        //! Get the start of the slab [nullptr if the pool is not slab backed or the slab is not allocated]
+        SKL_FORCEINLINE SKL_NODISCARD constexpr static void* GetSlab() noexcept { return Slab; }
+
+        //! Is the slab backed by large (huge) pages
+        SKL_FORCEINLINE SKL_NODISCARD constexpr static bool IsSlabOnLargePages() noexcept { return bIsSlabOnLargePages; }
+
+        //! Can the pool return the physical memory of its idle blocks to the OS [see DiscardColdBlocks()]
+        SKL_FORCEINLINE SKL_NODISCARD constexpr static bool SupportsTrimming() noexcept
+        {
+            if constexpr( PoolTraits::bUseSlab && PoolTraits::bUseSpinLock )
+            {
+                // large pages are locked in memory
+                return nullptr != Slab && false == bIsSlabOnLargePages;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        //! Get the number of blocks cached by the pool [slab backed pools only, the slab provides all the blocks]
+        SKL_NODISCARD static size_t GetCachedBlocksCount() noexcept
+        {
+            if constexpr( PoolTraits::bUseSlab && PoolTraits::bUseSpinLock )
+            {
+                SpinLockScopeGuard Guard{ SpinLock };
+                return GetCachedBlocksCountUnsafe();
+            }
+            else
+            {
+                return 0U;
+            }
+        }
+
+        //! Return the physical memory of the InCount least recently used cached blocks to the OS [see GDiscardPages()]
+        //! \remarks The blocks keep their slots in the pool, the next use of a block only faults its pages back in, it is never allocated from the OS again
+        //! \remarks Only the whole pages inside each block are discarded, blocks smaller than a page are left untouched
+        //! \returns the number of bytes discarded
+        static size_t DiscardColdBlocks( size_t InCount ) noexcept
+        {
+            if( false == SupportsTrimming() )
+            {
+                return 0U;
+            }
+
+            size_t DiscardedBytes{ 0U };
+
+            if constexpr( PoolTraits::bUseSlab && PoolTraits::bUseSpinLock )
+            {
+                { //Critical section [the blocks must not be handed out while their pages are discarded]
+                    SpinLockScopeGuard Guard{ SpinLock };
+
+                    // the slots right before the tail (in ring order) are the last ones to be handed out again
+                    const size_t Count{ std::min( InCount, GetCachedBlocksCountUnsafe() ) };
+                    for( size_t i = 0; i < Count; ++i )
+                    {
+                        void* Block{ Pool[( TailPosition + PoolSize - 1U - i ) & PoolTraits::MyPoolMask] };
+                        if( nullptr != Block && true == IsOwnedBySlab( Block ) )
+                        {
+                            DiscardedBytes += GDiscardPages( Block, PoolTraits::SlabBlockSize );
+                        }
+                    }
+                }
+            }
+
+            return DiscardedBytes;
+        }
+
 #if defined(SKL_MEMORY_STATISTICS) 
         SKL_FORCEINLINE constexpr static size_t GetTotalDeallocations() noexcept
         {
@@ -191,18 +355,34 @@ namespace SKL
 
                     PrevVal                               = Pool[InsPos & PoolTraits::MyPoolMask];
                     Pool[InsPos & PoolTraits::MyPoolMask] = reinterpret_cast<void*>( Obj );
+
+                    if constexpr( PoolTraits::bUseSlab )
+                    {
+                        if( nullptr != PrevVal ) SKL_UNLIKELY
+                        {
+                            PrevVal = KeepSlabBlockCached( reinterpret_cast<void*>( Obj ), PrevVal, InsPos );
+                        }
+                    }
                 }
             }
             else
             {
                 const uint64_t InsPos{ TailPosition.fetch_add( 1, std::memory_order_acq_rel) };
                 PrevVal = Pool[InsPos & PoolTraits::MyPoolMask].exchange( reinterpret_cast<void*>( Obj ) );
+
+                if constexpr( PoolTraits::bUseSlab )
+                {
+                    if( nullptr != PrevVal ) SKL_UNLIKELY
+                    {
+                        PrevVal = KeepSlabBlockCached( reinterpret_cast<void*>( Obj ), PrevVal, InsPos );
+                    }
+                }
             }
 
             if( nullptr != PrevVal ) SKL_UNLIKELY
             {
                 // stomped over valid pointer, just deallocate to OS
-                SKL_FREE_SIZE_ALIGNED( PrevVal, PoolTraits::MyObjectSize, PoolTraits::Alignment );
+                FreeBlockToOS( PrevVal );
                 SKL_IFMEMORYSTATS( ++TotalOSDeallocations );
                 return;
             }
@@ -210,6 +390,125 @@ namespace SKL
             SKL_IFMEMORYSTATS( ++TotalDeallocations );
         }
 
+        //! Allocate InCount raw blocks at once [no construction is performed], the SpinLock is taken once for the whole batch
+        //! \returns the number of blocks written at the start of OutBlocks [less than InCount only if the OS is out of memory]
+        static size_t AllocateBatch( void** OutBlocks, size_t InCount ) noexcept
+        {
+            SKL_ASSERT( InCount <= PoolSize );
+
+            if constexpr( PoolTraits::bUseSpinLock )
+            {
+                { //Critical section
+                    SpinLockScopeGuard Guard{ SpinLock };
+
+                    for( size_t i = 0; i < InCount; ++i )
+                    {
+                        const uint64_t PopPos{ HeadPosition++ };
+
+                        OutBlocks[i]                          = Pool[PopPos & PoolTraits::MyPoolMask];
+                        Pool[PopPos & PoolTraits::MyPoolMask] = nullptr;
+                    }
+                }
+            }
+            else
+            {
+                const uint64_t FirstPopPos{ HeadPosition.fetch_add( InCount, std::memory_order_acq_rel ) };
+                for( size_t i = 0; i < InCount; ++i )
+                {
+                    OutBlocks[i] = Pool[( FirstPopPos + i ) & PoolTraits::MyPoolMask].exchange( nullptr );
+                }
+            }
+
+            // dequeued nullptrs are allocated from the OS, outside of the lock
+            size_t Count{ 0U };
+            for( size_t i = 0; i < InCount; ++i )
+            {
+                void* Block{ OutBlocks[i] };
+                if( nullptr == Block ) SKL_UNLIKELY
+                {
+                    Block = SKL_MALLOC_ALIGNED( PoolTraits::MyObjectSize, PoolTraits::Alignment );
+                    if( nullptr == Block ) SKL_UNLIKELY
+                    {
+                        continue;
+                    }
+
+                    SKL_IFMEMORYSTATS( ++TotalOSAllocations );
+                }
+
+                SKL_ASSERT( reinterpret_cast<uint64_t>( Block ) % PoolTraits::Alignment == 0 );
+                OutBlocks[Count++] = Block;
+            }
+
+            SKL_IFMEMORYSTATS( TotalAllocations += Count );
+
+            return Count;
+        }
+
+        //! Deallocate InCount raw blocks at once [no destruction is performed], the SpinLock is taken once for the whole batch
+        //! \remarks InOutBlocks is used as scratch space, its content is undefined after the call
+        static void DeallocateBatch( void** InOutBlocks, size_t InCount ) noexcept
+        {
+            SKL_ASSERT( InCount <= PoolSize );
+
+            // each block is swapped with the value found in its slot, the stomped over blocks end up in InOutBlocks
+            if constexpr( PoolTraits::bUseSpinLock )
+            {
+                { //Critical section
+                    SpinLockScopeGuard Guard{ SpinLock };
+
+                    for( size_t i = 0; i < InCount; ++i )
+                    {
+                        const uint64_t InsPos{ TailPosition++ };
+
+                        void* PrevVal                         = Pool[InsPos & PoolTraits::MyPoolMask];
+                        Pool[InsPos & PoolTraits::MyPoolMask] = InOutBlocks[i];
+
+                        if constexpr( PoolTraits::bUseSlab )
+                        {
+                            if( nullptr != PrevVal ) SKL_UNLIKELY
+                            {
+                                PrevVal = KeepSlabBlockCached( InOutBlocks[i], PrevVal, InsPos );
+                            }
+                        }
+
+                        InOutBlocks[i] = PrevVal;
+                    }
+                }
+            }
+            else
+            {
+                const uint64_t FirstInsPos{ TailPosition.fetch_add( InCount, std::memory_order_acq_rel ) };
+                for( size_t i = 0; i < InCount; ++i )
+                {
+                    void* PrevVal{ Pool[( FirstInsPos + i ) & PoolTraits::MyPoolMask].exchange( InOutBlocks[i] ) };
+
+                    if constexpr( PoolTraits::bUseSlab )
+                    {
+                        if( nullptr != PrevVal ) SKL_UNLIKELY
+                        {
+                            PrevVal = KeepSlabBlockCached( InOutBlocks[i], PrevVal, FirstInsPos + i );
+                        }
+                    }
+
+                    InOutBlocks[i] = PrevVal;
+                }
+            }
+
+            for( size_t i = 0; i < InCount; ++i )
+            {
+                if( nullptr != InOutBlocks[i] ) SKL_UNLIKELY
+                {
+                    // stomped over valid pointer, just deallocate to OS
+                    FreeBlockToOS( InOutBlocks[i] );
+                    SKL_IFMEMORYSTATS( ++TotalOSDeallocations );
+                }
+                else
+                {
+                    SKL_IFMEMORYSTATS( ++TotalDeallocations );
+                }
+            }
+        }
+
         constexpr static T* Debug_ProbeAt( uint64_t InIndex ) noexcept
         {
             if constexpr ( false == PoolTraits::bNoSync && false == PoolTraits::bUseSpinLock )
@@ -223,6 +522,94 @@ namespace SKL
         }
 
     private:
+        SKL_FORCEINLINE SKL_NODISCARD static size_t GetCachedBlocksCountUnsafe() noexcept
+        {
+            const uint64_t Outstanding{ HeadPosition > TailPosition ? HeadPosition - TailPosition : 0U };
+            return Outstanding >= PoolSize ? 0U : static_cast<size_t>( PoolSize - Outstanding );
+        }
+
+        //! Free a block that is no longer cached by the pool [never one of this pool's slab blocks]
+        //! \remarks Only the OS allocated blocks are freed to the OS, blocks of released slabs are counted back by the SlabRegistry
+        SKL_FORCEINLINE constexpr static void FreeBlockToOS( void* InBlock ) noexcept
+        {
+            SKL_ASSERT( false == IsOwnedBySlab( InBlock ) );
+            SlabRegistry::FreeBlock( InBlock, PoolTraits::MyObjectSize, PoolTraits::Alignment );
+        }
+
+        //! Free a block popped out of the pool by FreePool(), the slab blocks are only counted [they are released together with the slab]
+        SKL_FORCEINLINE constexpr static void FreeCachedBlock( void* InBlock, size_t& OutCachedSlabBlocks ) noexcept
+        {
+            if( true == IsOwnedBySlab( InBlock ) )
+            {
+                ++OutCachedSlabBlocks;
+                return;
+            }
+
+            FreeBlockToOS( InBlock );
+        }
+
+        //! Swap InBlock into the slot at InPosition
+        //! \returns the block previously in the slot
+        SKL_FORCEINLINE static void* ExchangeSlot( uint64_t InPosition, void* InBlock ) noexcept
+        {
+            if constexpr( PoolTraits::bUseSpinLock )
+            {
+                void* PrevVal{ Pool[InPosition & PoolTraits::MyPoolMask] };
+                Pool[InPosition & PoolTraits::MyPoolMask] = InBlock;
+                return PrevVal;
+            }
+            else
+            {
+                return Pool[InPosition & PoolTraits::MyPoolMask].exchange( InBlock );
+            }
+        }
+
+        //! Resolve a slot stomped over by a deallocation, the slab blocks must stay cached [there are exactly PoolSize of them, they are never freed to the OS]
+        //! \remarks Must be called under the SpinLock if the pool uses one
+        //! \returns the block to be freed to the OS [nullptr if none]
+        SKL_NODISCARD static void* KeepSlabBlockCached( void* InInserted, void* InStomped, uint64_t InPosition ) noexcept
+        {
+            if( false == IsOwnedBySlab( InStomped ) )
+            {
+                return InStomped;
+            }
+
+            if( false == IsOwnedBySlab( InInserted ) )
+            {
+                // put the slab block back, the inserted block goes to the OS instead
+                if constexpr( PoolTraits::bUseSpinLock )
+                {
+                    Pool[InPosition & PoolTraits::MyPoolMask] = InStomped;
+                    return InInserted;
+                }
+                else
+                {
+                    void* Expected{ InInserted };
+                    if( true == Pool[InPosition & PoolTraits::MyPoolMask].compare_exchange_strong( Expected, InStomped, std::memory_order_acq_rel ) )
+                    {
+                        return InInserted;
+                    }
+                }
+            }
+
+            // move the slab block over the next slot not holding a slab block [the slab has exactly PoolSize blocks so there always is one]
+            void* Block{ InStomped };
+            for( size_t i = 1U; i < PoolSize; ++i )
+            {
+                void* Displaced{ ExchangeSlot( InPosition + i, Block ) };
+                if( nullptr == Displaced || false == IsOwnedBySlab( Displaced ) )
+                {
+                    return Displaced;
+                }
+
+                Block = Displaced;
+            }
+
+            // only reachable when racing other deallocations in the lock free mode, the block is leaked and the slab stays allocated
+            SKL_ASSERT_MSG( false, "ObjectPool failed to keep a slab block cached" );
+            return nullptr;
+        }
+
         template<typename... TArgs>
         SKL_NODISCARD SKL_FORCEINLINE constexpr static T *AllocateImpl( TArgs... Args ) noexcept
         {
@@ -272,6 +659,8 @@ namespace SKL
         SKL_CACHE_ALIGNED static inline typename PoolTraits::TPoolTail     TailPosition  { 0U };
         SKL_CACHE_ALIGNED static inline typename PoolTraits::TPoolPtr      Pool[PoolSize]{};
         SKL_CACHE_ALIGNED static inline typename PoolTraits::TPoolSpinLock SpinLock      {};
+        SKL_CACHE_ALIGNED static inline uint8_t*                           Slab          { nullptr };
+        static inline bool                                                 bIsSlabOnLargePages{ false };
 
 #if defined(SKL_MEMORY_STATISTICS) 
         SKL_CACHE_ALIGNED static std::atomic<size_t> TotalAllocations;
@@ -282,16 +671,16 @@ namespace SKL
     };
 
 #if defined(SKL_MEMORY_STATISTICS) 
-    template< typename T, size_t PoolSize, bool bNoSync, bool bUseSpinLock, bool bPerformConstruction, bool bPerformDestruction, size_t TAlignment>
-    SKL_CACHE_ALIGNED inline std::atomic<size_t> ObjectPool<T, PoolSize, bNoSync, bUseSpinLock, bPerformConstruction, bPerformDestruction, TAlignment>::TotalAllocations;
+    template< typename T, size_t PoolSize, bool bNoSync, bool bUseSpinLock, bool bPerformConstruction, bool bPerformDestruction, size_t TAlignment, bool bUseSlab, bool bUseLargePages, uint32_t TNumaNode>
+    SKL_CACHE_ALIGNED inline std::atomic<size_t> ObjectPool<T, PoolSize, bNoSync, bUseSpinLock, bPerformConstruction, bPerformDestruction, TAlignment, bUseSlab, bUseLargePages, TNumaNode>::TotalAllocations;
 
-    template< typename T, size_t PoolSize, bool bNoSync, bool bUseSpinLock, bool bPerformConstruction, bool bPerformDestruction, size_t TAlignment>
-    SKL_CACHE_ALIGNED inline std::atomic<size_t> ObjectPool<T, PoolSize, bNoSync, bUseSpinLock, bPerformConstruction, bPerformDestruction, TAlignment>::TotalDeallocations;
+    template< typename T, size_t PoolSize, bool bNoSync, bool bUseSpinLock, bool bPerformConstruction, bool bPerformDestruction, size_t TAlignment, bool bUseSlab, bool bUseLargePages, uint32_t TNumaNode>
+    SKL_CACHE_ALIGNED inline std::atomic<size_t> ObjectPool<T, PoolSize, bNoSync, bUseSpinLock, bPerformConstruction, bPerformDestruction, TAlignment, bUseSlab, bUseLargePages, TNumaNode>::TotalDeallocations;
 
-    template< typename T, size_t PoolSize, bool bNoSync, bool bUseSpinLock, bool bPerformConstruction, bool bPerformDestruction, size_t TAlignment>
-    SKL_CACHE_ALIGNED inline std::atomic<size_t> ObjectPool<T, PoolSize, bNoSync, bUseSpinLock, bPerformConstruction, bPerformDestruction, TAlignment>::TotalOSAllocations;
+    template< typename T, size_t PoolSize, bool bNoSync, bool bUseSpinLock, bool bPerformConstruction, bool bPerformDestruction, size_t TAlignment, bool bUseSlab, bool bUseLargePages, uint32_t TNumaNode>
+    SKL_CACHE_ALIGNED inline std::atomic<size_t> ObjectPool<T, PoolSize, bNoSync, bUseSpinLock, bPerformConstruction, bPerformDestruction, TAlignment, bUseSlab, bUseLargePages, TNumaNode>::TotalOSAllocations;
 
-    template< typename T, size_t PoolSize, bool bNoSync, bool bUseSpinLock, bool bPerformConstruction, bool bPerformDestruction, size_t TAlignment>
-    SKL_CACHE_ALIGNED inline std::atomic<size_t> ObjectPool<T, PoolSize, bNoSync, bUseSpinLock, bPerformConstruction, bPerformDestruction, TAlignment>::TotalOSDeallocations;
+    template< typename T, size_t PoolSize, bool bNoSync, bool bUseSpinLock, bool bPerformConstruction, bool bPerformDestruction, size_t TAlignment, bool bUseSlab, bool bUseLargePages, uint32_t TNumaNode>
+    SKL_CACHE_ALIGNED inline std::atomic<size_t> ObjectPool<T, PoolSize, bNoSync, bUseSpinLock, bPerformConstruction, bPerformDestruction, TAlignment, bUseSlab, bUseLargePages, TNumaNode>::TotalOSDeallocations;
 #endif
 } // namespace SKL
\ No newline at end of file
@@ -9,13 +9,154 @@
 
 namespace SKL
 {
+    //! Multiple producers single consumer lock free list of thread local memory blocks freed by threads other than the owner (the allocating thread)
+    //! \remarks The list node is placed in the freed block itself, the size of the block is stored in the node
+    //! \remarks The list is closed when the owner thread terminates, no more blocks are accepted after that [see Push()]
+    //! \remarks A closed list is reopened for a new owner thread once no block of a terminated thread is pending in a released slab [see ThreadLocalMemoryManager::AcquireRemoteFreeList()]
+    struct alignas( SKL_CACHE_LINE_SIZE ) ThreadLocalRemoteFreeList
+    {
+        using MemoryManager = LocalMemoryManager<ThreadLocalMemoryManagerConfig>;
+
+        struct Node
+        {
+            Node*  Next     { nullptr }; //!< Intrusive singly-linked list next pointer
+            size_t BlockSize{ 0U };      //!< Size the block was allocated with
+        };
+
+        static_assert( ThreadLocalMemoryManagerConfig::Pool1_BlockSize >= sizeof( Node ), "The smallest thread local block must fit the remote free list node" );
+
+        ThreadLocalRemoteFreeList() noexcept = default;
+        ~ThreadLocalRemoteFreeList() noexcept = default;
+
+        // Can't copy or move
+        ThreadLocalRemoteFreeList( const ThreadLocalRemoteFreeList & ) = delete;
+        ThreadLocalRemoteFreeList &operator=( const ThreadLocalRemoteFreeList & ) = delete;
+        ThreadLocalRemoteFreeList( ThreadLocalRemoteFreeList && ) = delete;
+        ThreadLocalRemoteFreeList &operator=( ThreadLocalRemoteFreeList && ) = delete;
+
+        //! Multiple producers push [InBlock must not be used after this call if pushed]
+        //! \returns false if the list is closed (the owner thread terminated), the block was not pushed and must be freed by the caller
+        SKL_FORCEINLINE SKL_NODISCARD bool Push( void* InBlock, size_t InBlockSize ) noexcept
+        {
+            SKL_ASSERT( nullptr != InBlock );
+
+            Node* NewNode { reinterpret_cast<Node*>( InBlock ) };
+            Node* Expected{ Head.load( std::memory_order_relaxed ) };
+
+            for( ;; )
+            {
+                if( GetClosedHead() == Expected ) SKL_UNLIKELY
+                {
+                    return false;
+                }
+
+                NewNode->BlockSize = InBlockSize;
+                NewNode->Next      = Expected;
+
+                if( true == Head.compare_exchange_weak( Expected, NewNode, std::memory_order_release, std::memory_order_relaxed ) )
+                {
+                    return true;
+                }
+
+                _mm_pause();
+            }
+        }
+
+        //! Single consumer, return all blocks to InManager [must be the manager of the owner thread]
+        //! \returns the number of reclaimed blocks
+        size_t ReclaimAll( MemoryManager& InManager ) noexcept
+        {
+            // cheap check first, avoid taking the cache line exclusive if empty
+            if( nullptr == Head.load( std::memory_order_relaxed ) )
+            {
+                return 0U;
+            }
+
+            SKL_ASSERT( false == IsClosed() );
+
+            Node*  Current{ Head.exchange( nullptr, std::memory_order_acquire ) };
+            size_t Count  { 0U };
+
+            while( nullptr != Current )
+            {
+                Node*        NextNode { Current->Next };
+                const size_t BlockSize{ Current->BlockSize };
+
+                InManager.Deallocate( Current, BlockSize );
+
+                Current = NextNode;
+                ++Count;
+            }
+
+            return Count;
+        }
+
+        //! Close the list, called by the owner thread on termination [after its pools were freed]
+        //! \remarks The blocks pushed but not reclaimed and all the blocks freed later by other threads are freed with FreeOrphanBlock()
+        //! \returns the number of blocks that were pending
+        size_t Close() noexcept
+        {
+            Node*  Current{ Head.exchange( GetClosedHead(), std::memory_order_acq_rel ) };
+            size_t Count  { 0U };
+
+            SKL_ASSERT( GetClosedHead() != Current );
+
+            while( nullptr != Current )
+            {
+                Node* NextNode{ Current->Next };
+
+                FreeOrphanBlock( Current, Current->BlockSize );
+
+                Current = NextNode;
+                ++Count;
+            }
+
+            return Count;
+        }
+
+        //! Reopen the closed list for a new owner thread
+        SKL_FORCEINLINE void Reopen() noexcept
+        {
+            SKL_ASSERT( true == IsClosed() );
+            Head.store( nullptr, std::memory_order_release );
+        }
+
+        //! Free a block whose owner thread terminated, the pools of the owner are freed [the slab blocks are counted back by the SlabRegistry]
+        SKL_FORCEINLINE static void FreeOrphanBlock( void* InBlock, size_t InBlockSize ) noexcept
+        {
+            SlabRegistry::FreeBlock( InBlock, InBlockSize, MemoryManager::MemoryBlockAlignment );
+        }
+
+        //! Is the list empty
+        SKL_FORCEINLINE SKL_NODISCARD bool IsEmpty() const noexcept 
+        { 
+            Node* Current{ Head.load( std::memory_order_relaxed ) };
+            return nullptr == Current || GetClosedHead() == Current; 
+        }
+
+        //! Is the list closed [the owner thread terminated]
+        SKL_FORCEINLINE SKL_NODISCARD bool IsClosed() const noexcept { return GetClosedHead() == Head.load( std::memory_order_relaxed ); }
+
+    private:
+        //! Head value of a closed list
+        SKL_FORCEINLINE SKL_NODISCARD static Node* GetClosedHead() noexcept { return reinterpret_cast<Node*>( static_cast<uintptr_t>( 1U ) ); }
+
+        std::atomic<Node*> Head{ nullptr }; //!< Head of the list
+    };
+
     struct ThreadLocalMemoryManager final : public ITLSSingleton<ThreadLocalMemoryManager>
     {
         using MemoryManager = LocalMemoryManager<ThreadLocalMemoryManagerConfig>;
         using AllocResult   = typename MemoryManager::AllocResult;        
+        using TOwnerTag     = ThreadLocalRemoteFreeList*;
 
         RStatus Initialize() noexcept override
         { 
+            if( nullptr == RemoteFreeList )
+            {
+                RemoteFreeList = AcquireRemoteFreeList();
+            }
+
             return RSuccess; 
         }
 
@@ -38,10 +179,13 @@ namespace SKL
             Instance->Manager.ZeroAllMemory();
         }
         
-        //! Zero memory all pools, this will force the OS to have the all pages ready in memory (hot)
+        //! Free all pools of the calling thread
+        //! \remarks The blocks freed by other threads, not yet reclaimed, are returned to the pools first
+        //! \remarks The slabs with blocks still in use are freed after the last of them is deallocated [see SlabRegistry]
         SKL_FORCEINLINE static void FreeAllPools() noexcept
         {
             auto* Instance{ ThreadLocalMemoryManager::GetInstance() }; SKL_ASSERT( nullptr != Instance );
+            ( void )ReclaimRemoteFreed();
             Instance->Manager.FreeAllPools();
         }
         
@@ -89,6 +233,41 @@ namespace SKL
             Instance->Manager.Deallocate( InAllocResult );
         }
 
+        //! Get the ownership tag of the calling thread [store it along the block to be able to deallocate the block from any thread, see DeallocateFromAnyThread()]
+        SKL_FORCEINLINE SKL_NODISCARD static TOwnerTag GetOwnerTag() noexcept
+        {
+            auto* Instance{ ThreadLocalMemoryManager::GetInstance() }; SKL_ASSERT( nullptr != Instance );
+            return Instance->RemoteFreeList;
+        }
+
+        //! Deallocate memory block, allocated by the thread owning InOwner, from any thread
+        //! \remarks If the calling thread is not the owner, the block is pushed to the owner's remote free list and returned to the owner's pools on its next tick [see ReclaimRemoteFreed()]
+        //! \remarks If the owner thread terminated, the block is freed to the OS or counted back to its released slab [see ThreadLocalRemoteFreeList::FreeOrphanBlock()]
+        SKL_FORCEINLINE static void DeallocateFromAnyThread( TOwnerTag InOwner, void* InPtr, size_t AllocSize ) noexcept
+        {
+            SKL_ASSERT( nullptr != InOwner );
+            SKL_ASSERT( nullptr != InPtr );
+
+            auto* Instance{ ThreadLocalMemoryManager::GetInstance() };
+            if( nullptr != Instance && InOwner == Instance->RemoteFreeList ) SKL_LIKELY
+            {
+                Instance->Manager.Deallocate( InPtr, AllocSize );
+            }
+            else if( false == InOwner->Push( InPtr, AllocSize ) ) SKL_UNLIKELY
+            {
+                ThreadLocalRemoteFreeList::FreeOrphanBlock( InPtr, AllocSize );
+            }
+        }
+
+        //! Return all the blocks, allocated by the calling thread and freed by other threads, to the pools of the calling thread
+        //! \returns the number of reclaimed blocks
+        SKL_FORCEINLINE static size_t ReclaimRemoteFreed() noexcept
+        {
+            auto* Instance{ ThreadLocalMemoryManager::GetInstance() }; SKL_ASSERT( nullptr != Instance );
+            SKL_ASSERT( nullptr != Instance->RemoteFreeList );
+            return Instance->RemoteFreeList->ReclaimAll( Instance->Manager );
+        }
+
         //! Get profiling data
         SKL_NODISCARD static auto GetProfilingData() noexcept -> MemoryManager::TProfilingData
         {
@@ -96,14 +275,49 @@ namespace SKL
             return Instance->Manager.ProfilingData;
         }
 
+        //! Log the fragmentation report of each size class
+        SKL_FORCEINLINE static void LogSizeClassesReport() noexcept
+        {
+            auto* Instance{ ThreadLocalMemoryManager::GetInstance() }; SKL_ASSERT( nullptr != Instance );
+            Instance->Manager.LogSizeClassesReport();
+        }
+
+        //! Return the memory of the idle blocks of the calling thread's pools to the OS [see LocalMemoryManager::TickTrimming()]
+        SKL_FORCEINLINE static size_t TickTrimming( TEpochTimePoint InNow ) noexcept
+        {
+            auto* Instance{ ThreadLocalMemoryManager::GetInstance() }; SKL_ASSERT( nullptr != Instance );
+            return Instance->Manager.TickTrimming( InNow );
+        }
+
         SKL_FORCEINLINE SKL_NODISCARD MemoryManager& GetManager() noexcept{ return Manager; }
         SKL_FORCEINLINE SKL_NODISCARD const MemoryManager& GetManager() const noexcept{ return Manager; }
 
         ThreadLocalMemoryManager() noexcept = default;
-        ~ThreadLocalMemoryManager() noexcept = default;
+        ~ThreadLocalMemoryManager() noexcept
+        {
+            if( nullptr != RemoteFreeList )
+            {
+                // the pools must be freed before the list is closed, the blocks freed late by other threads can only be counted back to released slabs
+                ( void )RemoteFreeList->ReclaimAll( Manager );
+                Manager.FreeAllPools();
+                ( void )RemoteFreeList->Close();
+
+                ReleaseRemoteFreeList( RemoteFreeList );
+                RemoteFreeList = nullptr;
+            }
+        }
 
     private:
-        MemoryManager Manager {};
+        //! Acquire a remote free list from the global registry, a closed list is recycled if no block of a terminated thread is pending in a released slab [see SlabRegistry::GetPendingSlabsCount()]
+        //! \remarks The blocks of a terminated thread freed late into a recycled list are reclaimed by the new owner, its pools free them back to their released slab or to the OS [see SlabRegistry::FreeBlock()]
+        static ThreadLocalRemoteFreeList* AcquireRemoteFreeList() noexcept;
+
+        //! Return the closed remote free list to the global registry
+        //! \remarks The lists are never deallocated, blocks freed late (after the owner thread terminated) can still reference them through their owner tag
+        static void ReleaseRemoteFreeList( ThreadLocalRemoteFreeList* InList ) noexcept;
+
+        MemoryManager              Manager        {};
+        ThreadLocalRemoteFreeList* RemoteFreeList { nullptr }; //!< List of the blocks allocated by this thread and freed by other threads
 
         friend ITLSSingleton<ThreadLocalMemoryManager>;
     };  
@@ -155,25 +155,31 @@ namespace SKL
 
 namespace SKL
 {
-    template<size_t CompletionTaskSize>
+    template<size_t CompletionTaskSize, uint32_t TBufferSize = CPacketMaximumSize>
     struct IAsyncNetBufferBase;
     
-    template<size_t CompletionTaskSize>
+    template<size_t CompletionTaskSize, uint32_t TBufferSize = CPacketMaximumSize>
     struct IAsyncNetBuffer;
 
-    template<size_t CompletionTaskSize>
+    template<size_t CompletionTaskSize, uint32_t TBufferSize = CPacketMaximumSize>
     struct IRoutedAsyncNetBuffer;
 
-    template<typename TEntityIdType, size_t CompletionTaskSize>
+    template<typename TEntityIdType, size_t CompletionTaskSize, uint32_t TBufferSize = CPacketMaximumSize>
     struct IBroadcastAsyncNetBuffer;
 
-    template<size_t CompletionTaskSize = 16>
-    struct AsyncNetBuffer: public AsyncIOBuffer<CPacketMaximumSize, CompletionTaskSize>
+    //! Async IO buffer used to receive, send, route and broadcast packets
+    //! \remarks TBufferSize is the total size of the buffer, use the size classes in CPacketBufferSizeClasses [see TSizedAsyncNetBuffer]
+    //! \remarks The size classes leave room for the buffer header and the shared control block, each one fills the memory block it targets [see CPacketBufferBlockSizes]
+    template<size_t CompletionTaskSize = 16, uint32_t TBufferSize = CPacketMaximumSize>
+    struct AsyncNetBuffer: public AsyncIOBuffer<TBufferSize, CompletionTaskSize>
     {
-        using MyType = AsyncNetBuffer<CompletionTaskSize>;
-        using Base   = AsyncIOBuffer<CPacketMaximumSize, CompletionTaskSize>;
+        using MyType = AsyncNetBuffer<CompletionTaskSize, TBufferSize>;
+        using Base   = AsyncIOBuffer<TBufferSize, CompletionTaskSize>;
 
-        static constexpr size_t CPacketHeaderOffset = 12U;
+        static_assert( TBufferSize > CPacketBufferPaddingSize + CPacketHeaderSize );
+        static_assert( TBufferSize <= CPacketMaximumSize );
+
+        static constexpr size_t CPacketHeaderOffset = CPacketBufferPaddingSize;
         static constexpr size_t CPacketBodyOffset   = CPacketHeaderOffset + CPacketHeaderSize;
         
         static constexpr uint32_t CPacketReceiveHeaderState = 0;
@@ -199,6 +205,7 @@ namespace SKL
         // --------------------------------------------------------------------------------------------
         // |<------------------------------------- 65536 bytes -------------------------------------->|
         // --------------------------------------------------------------------------------------------
+        // Sizes are given for the max size class, the smaller classes only have a smaller [Packet Body]
         // Usage 1: Receive/Send buffer
         //        [Padding]     - Place holder
         //        [Header]      - Packet header
@@ -218,13 +225,13 @@ namespace SKL
         //        [Packet Body] - Packet body (must be 8 bytes aligned)
         
         //! Get the size of the entire buffer of any instance of this type
-        SKL_FORCEINLINE SKL_NODISCARD consteval static uint32_t GetTotalBufferSize() noexcept { return CPacketMaximumSize; }
+        SKL_FORCEINLINE SKL_NODISCARD consteval static uint32_t GetTotalBufferSize() noexcept { return TBufferSize; }
 
         //! Get the size of the buffer portion that we can receive the packet into
-        SKL_FORCEINLINE SKL_NODISCARD consteval static uint32_t GetPacketBufferSize() noexcept { return CPacketMaximumUsableBodySize + CPacketHeaderSize; }
+        SKL_FORCEINLINE SKL_NODISCARD consteval static uint32_t GetPacketBufferSize() noexcept { return TBufferSize - static_cast<uint32_t>( CPacketHeaderOffset ); }
 
         //! Get the size of the buffer portion that we can receive the packet body into
-        SKL_FORCEINLINE SKL_NODISCARD consteval static uint32_t GetPacketBodyBufferSize() noexcept { return CPacketMaximumUsableBodySize; }
+        SKL_FORCEINLINE SKL_NODISCARD consteval static uint32_t GetPacketBodyBufferSize() noexcept { return TBufferSize - static_cast<uint32_t>( CPacketBodyOffset ); }
 
         //! Get the packet header
         SKL_FORCEINLINE SKL_NODISCARD PacketHeader& GetPacketHeader() noexcept { return *reinterpret_cast<PacketHeader*>( this->Buffer + CPacketHeaderOffset ); }
@@ -247,22 +254,38 @@ namespace SKL
         void Reset() noexcept;
 
     private:
-        friend IRoutedAsyncNetBuffer<CompletionTaskSize>;
-        friend IAsyncNetBufferBase<CompletionTaskSize>;
-        friend IAsyncNetBuffer<CompletionTaskSize>;
+        friend IRoutedAsyncNetBuffer<CompletionTaskSize, TBufferSize>;
+        friend IAsyncNetBufferBase<CompletionTaskSize, TBufferSize>;
+        friend IAsyncNetBuffer<CompletionTaskSize, TBufferSize>;
 
-        template<typename, size_t> 
+        template<typename, size_t, uint32_t> 
         friend struct IBroadcastAsyncNetBuffer;
     };
 
-    template<size_t CompletionTaskSize>
+    //! AsyncNetBuffer of the size class InSizeClass [index into CPacketBufferSizeClasses]
+    template<uint32_t InSizeClass, size_t CompletionTaskSize = 16>
+    using TSizedAsyncNetBuffer = AsyncNetBuffer<CompletionTaskSize, CPacketBufferSizeClasses[InSizeClass]>;
+
+    //! Get the size of the memory block that serves a new shared AsyncNetBuffer of the size class InSizeClass [buffer header and shared control block included]
+    template<uint32_t InSizeClass>
+    consteval size_t GetSizedAsyncNetBufferBlockSize() noexcept
+    {
+        using MyMemoryPolicy = MemoryPolicy::SharedMemoryPolicy<false>;
+        return SkylakeGlobalMemoryManager::GetMemoryBlockSizeFor( MyMemoryPolicy::template CalculateNeededSizeForObject<TSizedAsyncNetBuffer<InSizeClass>>() );
+    }
+
+    static_assert( CPacketBufferBlockSizes[0] == GetSizedAsyncNetBufferBlockSize<0U>(), "The size class 0 doesn't map to its target memory block, update CPacketBufferBlockSizes/CPacketBufferOverheadSize" );
+    static_assert( false == CMemoryManager_UseSizeClasses || CPacketBufferBlockSizes[1] == GetSizedAsyncNetBufferBlockSize<1U>(), "The size class 1 doesn't map to its target memory block, update CPacketBufferBlockSizes/CPacketBufferOverheadSize" );
+    static_assert( false == CMemoryManager_UseSizeClasses || CPacketBufferBlockSizes[2] == GetSizedAsyncNetBufferBlockSize<2U>(), "The size class 2 doesn't map to its target memory block, update CPacketBufferBlockSizes/CPacketBufferOverheadSize" );
+
+    template<size_t CompletionTaskSize, uint32_t TBufferSize>
     struct IAsyncNetBufferBase
     {
-        using Super = AsyncNetBuffer<CompletionTaskSize>;
+        using Super = AsyncNetBuffer<CompletionTaskSize, TBufferSize>;
 
         static constexpr TPacketSize CBufferHeaderOffset              = 0U; 
-        static constexpr TPacketSize CPacketBodySize                  = CPacketMaximumUsableBodySize; 
-        static constexpr TPacketSize CSizeOfBufferPaddingBeforePacket = 12U; 
+        static constexpr TPacketSize CPacketBodySize                  = static_cast<TPacketSize>( TBufferSize - CPacketBufferPaddingSize - CPacketHeaderSize ); 
+        static constexpr TPacketSize CSizeOfBufferPaddingBeforePacket = CPacketBufferPaddingSize; 
         static constexpr TPacketSize CPacketHeaderOffset              = CSizeOfBufferPaddingBeforePacket;
         static constexpr TPacketSize CPacketBodyOffset                = CPacketHeaderOffset + CPacketHeaderSize;
         
@@ -332,14 +355,15 @@ namespace SKL
         //! Get the stream reader
         SKL_FORCEINLINE SKL_NODISCARD IByteStreamObjectReader& GetReader() noexcept { return IByteStreamObjectReader::FromStreamBaseRef( GetStream() ); }
 
-        static_assert( CPacketMaximumSize == GetTotalBufferSize() );
+        static_assert( TBufferSize == GetTotalBufferSize() );
+        static_assert( CPacketMaximumSize != TBufferSize || CPacketMaximumUsableBodySize == CPacketBodySize );
     };
 
-    template<size_t CompletionTaskSize>
-    struct IAsyncNetBuffer: public IAsyncNetBufferBase<CompletionTaskSize>
+    template<size_t CompletionTaskSize, uint32_t TBufferSize>
+    struct IAsyncNetBuffer: public IAsyncNetBufferBase<CompletionTaskSize, TBufferSize>
     {
-        using Base  = IAsyncNetBufferBase<CompletionTaskSize>;
-        using Super = AsyncNetBuffer<CompletionTaskSize>;
+        using Base  = IAsyncNetBufferBase<CompletionTaskSize, TBufferSize>;
+        using Super = AsyncNetBuffer<CompletionTaskSize, TBufferSize>;
 
         // This type cannot be used to create an object, its meant to be used for pointer/ref type
         IAsyncNetBuffer() noexcept = delete;
@@ -387,7 +411,7 @@ namespace SKL
         //! \returns <bool hasReceivedWholePacket, bool bProcessedSuccessfully>
         /*SKL_FORCEINLINE*/ SKL_NODISCARD std::pair<bool, bool> ConfirmReceivedExactAmmount( uint32_t NoOfBytesTransferred ) noexcept
         {
-            SKL_ASSERT( NoOfBytesTransferred <= CPacketMaximumSize );
+            SKL_ASSERT( NoOfBytesTransferred <= TBufferSize );
 
             // acknowledge received bytes count
             StreamBase& Stream{ this->GetStream() };
@@ -399,7 +423,7 @@ namespace SKL
             const uint32_t CurrentlyReceived{ Stream.Position };
 
             // we must receive at least the header
-            if( CurrentlyReceived < CPacketHeaderSize || CurrentlyReceived >= static_cast<uint32_t>( CPacketMaximumUsableUserPacketSize ) ) SKL_UNLIKELY
+            if( CurrentlyReceived < CPacketHeaderSize || CurrentlyReceived >= Base::GetPacketBufferSize() ) SKL_UNLIKELY
             {
                 return { false, true };
             }
@@ -425,7 +449,7 @@ namespace SKL
         //! \returns <bool hasReceivedWholePacket, bool bProcessedSuccessfully>
         SKL_FORCEINLINE SKL_NODISCARD std::pair<bool, bool> ConfirmReceivedAmmount( uint32_t NoOfBytesTransferred, StreamBase& OutExtraData ) noexcept
         {
-            SKL_ASSERT( NoOfBytesTransferred <= CPacketMaximumSize );
+            SKL_ASSERT( NoOfBytesTransferred <= TBufferSize );
 
             // acknowledge received bytes count
             this->Stream.Position      += NoOfBytesTransferred;
@@ -436,7 +460,7 @@ namespace SKL
             const uint32_t CurrentlyReceived{ this->Stream.Position };
 
             // we must receive at least the header
-            if( CurrentlyReceived < CPacketHeaderSize || CurrentlyReceived >= static_cast<uint32_t>( CPacketMaximumUsableUserPacketSize ) ) SKL_UNLIKELY
+            if( CurrentlyReceived < CPacketHeaderSize || CurrentlyReceived >= Base::GetPacketBufferSize() ) SKL_UNLIKELY
             {
                 return { false, true };
             }
@@ -560,11 +584,11 @@ namespace SKL
         }
     };
 
-    template<size_t CompletionTaskSize>
-    struct IRoutedAsyncNetBuffer: public IAsyncNetBufferBase<CompletionTaskSize>
+    template<size_t CompletionTaskSize, uint32_t TBufferSize>
+    struct IRoutedAsyncNetBuffer: public IAsyncNetBufferBase<CompletionTaskSize, TBufferSize>
     {
-        using Base  = IAsyncNetBufferBase<CompletionTaskSize>;
-        using Super = AsyncNetBuffer<CompletionTaskSize>;
+        using Base  = IAsyncNetBufferBase<CompletionTaskSize, TBufferSize>;
+        using Super = AsyncNetBuffer<CompletionTaskSize, TBufferSize>;
 
         static constexpr size_t CRHeaderOffset      = 0U; 
         static constexpr size_t CEntityIdOffset     = CPacketHeaderSize; 
@@ -644,7 +668,7 @@ namespace SKL
         {
 #if !SKL_BUILD_SHIPPING
             const size_t Result      { static_cast<size_t>( Base::CSizeOfBufferPaddingBeforePacket ) + static_cast<size_t>( this->GetPacketHeader().Size ) };
-            const bool   bHasOverflow{ static_cast<size_t>( CPacketMaximumSize ) < Result };
+            const bool   bHasOverflow{ static_cast<size_t>( TBufferSize ) < Result };
 
             if( bHasOverflow ) SKL_UNLIKELY
             {
@@ -669,11 +693,11 @@ namespace SKL
         SKL_FORCEINLINE SKL_NODISCARD static const IRoutedAsyncNetBuffer* FromBufferPtr( const Super* InBuffer ) noexcept { return reinterpret_cast<const IRoutedAsyncNetBuffer*>( InBuffer ); }
     };
     
-    template<typename TEntityIdType, size_t CompletionTaskSize>
-    struct IBroadcastAsyncNetBuffer: public IAsyncNetBufferBase<CompletionTaskSize>
+    template<typename TEntityIdType, size_t CompletionTaskSize, uint32_t TBufferSize>
+    struct IBroadcastAsyncNetBuffer: public IAsyncNetBufferBase<CompletionTaskSize, TBufferSize>
     {
-        using Base  = IAsyncNetBufferBase<CompletionTaskSize>;
-        using Super = AsyncNetBuffer<CompletionTaskSize>;
+        using Base  = IAsyncNetBufferBase<CompletionTaskSize, TBufferSize>;
+        using Super = AsyncNetBuffer<CompletionTaskSize, TBufferSize>;
 
         static constexpr uint32_t CEntityIdSize = sizeof( TEntityIdType );
         static_assert( CEntityIdSize <= 8U );
@@ -797,7 +821,7 @@ namespace SKL
             const TPacketSize OffsetToTargets{ CalculateBroadcastTargetsBufferOffset() };
             return BinaryObjectStream<TEntityIdType>( 
                   this->GetBuffer() + OffsetToTargets
-                , CPacketMaximumSize - OffsetToTargets
+                , TBufferSize - OffsetToTargets
                 , 0U
                 , false
             );
@@ -858,7 +882,7 @@ namespace SKL
                                + static_cast<size_t>( this->GetPacketHeader().Size ) 
                                + ( static_cast<size_t>( TargetsCount ) * CEntityIdSize ) };
 
-            const bool bHasOverflow{ static_cast<size_t>( CPacketMaximumSize ) < Result };
+            const bool bHasOverflow{ static_cast<size_t>( TBufferSize ) < Result };
 
             if( bHasOverflow ) SKL_UNLIKELY
             {
@@ -877,7 +901,7 @@ namespace SKL
         {
             const TPacketSize ToCopy{ CalculateBroadcastTargetsBufferOffset() };
             SKL_ASSERT( ( Base::CSizeOfBufferPaddingBeforePacket + CPacketHeaderSize ) <= ToCopy );
-            ( void )SKL_MEMCPY( Other.Buffer, CPacketMaximumSize, this->GetBuffer(), ToCopy );
+            ( void )SKL_MEMCPY( Other.Buffer, TBufferSize, this->GetBuffer(), ToCopy );
         }
 
         //! Build a new ref into the InBuffer interfaces as IAsyncNetBuffer
@@ -898,20 +922,20 @@ namespace SKL
         }
     };
     
-    template<size_t CompletionTaskSize>
-    AsyncNetBuffer<CompletionTaskSize>::AsyncNetBuffer() noexcept: Base()
+    template<size_t CompletionTaskSize, uint32_t TBufferSize>
+    AsyncNetBuffer<CompletionTaskSize, TBufferSize>::AsyncNetBuffer() noexcept: Base()
     {
-        auto&         Interface    = IAsyncNetBuffer<CompletionTaskSize>::FromBuffer( *this );
+        auto&         Interface    = IAsyncNetBuffer<CompletionTaskSize, TBufferSize>::FromBuffer( *this );
         PacketHeader& BufferHeader = Interface.GetBufferHeader();
 
         BufferHeader.Opcode = CInvalidOpcode;
         BufferHeader.Size   = 0U;
     }
 
-    template<size_t CompletionTaskSize>
-    void AsyncNetBuffer<CompletionTaskSize>::Reset() noexcept
+    template<size_t CompletionTaskSize, uint32_t TBufferSize>
+    void AsyncNetBuffer<CompletionTaskSize, TBufferSize>::Reset() noexcept
     {
-        auto&         Interface    = IAsyncNetBuffer<CompletionTaskSize>::FromBuffer( *this );
+        auto&         Interface    = IAsyncNetBuffer<CompletionTaskSize, TBufferSize>::FromBuffer( *this );
         PacketHeader& BufferHeader = Interface.GetBufferHeader();
 
         BufferHeader.Opcode = CInvalidOpcode;
@@ -920,12 +944,33 @@ namespace SKL
         this->ToOSOpaqueObject()->Reset();
     }
 
-    template<size_t CompletionTaskSize>
-    SKL_FORCEINLINE SKL_NODISCARD IAsyncNetBuffer<CompletionTaskSize>& EditAsyncNetBuffer( AsyncNetBuffer<CompletionTaskSize>& InBuffer ) noexcept { return reinterpret_cast<IAsyncNetBuffer<CompletionTaskSize>&>( InBuffer ); }
+    template<size_t CompletionTaskSize, uint32_t TBufferSize>
+    SKL_FORCEINLINE SKL_NODISCARD IAsyncNetBuffer<CompletionTaskSize, TBufferSize>& EditAsyncNetBuffer( AsyncNetBuffer<CompletionTaskSize, TBufferSize>& InBuffer ) noexcept { return reinterpret_cast<IAsyncNetBuffer<CompletionTaskSize, TBufferSize>&>( InBuffer ); }
     
-    template<size_t CompletionTaskSize>
-    SKL_FORCEINLINE SKL_NODISCARD IRoutedAsyncNetBuffer<CompletionTaskSize>& EditRoutingAsyncNetBuffer( AsyncNetBuffer<CompletionTaskSize>& InBuffer ) noexcept { return reinterpret_cast<IRoutedAsyncNetBuffer<CompletionTaskSize>&>( InBuffer ); }
+    template<size_t CompletionTaskSize, uint32_t TBufferSize>
+    SKL_FORCEINLINE SKL_NODISCARD IRoutedAsyncNetBuffer<CompletionTaskSize, TBufferSize>& EditRoutingAsyncNetBuffer( AsyncNetBuffer<CompletionTaskSize, TBufferSize>& InBuffer ) noexcept { return reinterpret_cast<IRoutedAsyncNetBuffer<CompletionTaskSize, TBufferSize>&>( InBuffer ); }
     
-    template<typename TEntityIdType, size_t CompletionTaskSize>
-    SKL_FORCEINLINE SKL_NODISCARD IBroadcastAsyncNetBuffer<TEntityIdType, CompletionTaskSize>& EditBroadcastAsyncNetBuffer( AsyncNetBuffer<CompletionTaskSize>& InBuffer ) noexcept { return reinterpret_cast<IBroadcastAsyncNetBuffer<TEntityIdType, CompletionTaskSize>&>( InBuffer ); }
-}
\ No newline at end of file
+    template<typename TEntityIdType, size_t CompletionTaskSize, uint32_t TBufferSize>
+    SKL_FORCEINLINE SKL_NODISCARD IBroadcastAsyncNetBuffer<TEntityIdType, CompletionTaskSize, TBufferSize>& EditBroadcastAsyncNetBuffer( AsyncNetBuffer<CompletionTaskSize, TBufferSize>& InBuffer ) noexcept { return reinterpret_cast<IBroadcastAsyncNetBuffer<TEntityIdType, CompletionTaskSize, TBufferSize>&>( InBuffer ); }
+
+    //! Allocate a new AsyncNetBuffer of the size class InSizeClass and pass it to InFunctor as TSharedPtr<TSizedAsyncNetBuffer<...>>
+    //! \remarks Use PacketBuildContext::GetBufferSizeClass() to get the smallest size class that can hold a packet
+    //! \remarks Each size class is allocated from the memory pool that matches its size
+    template<size_t CompletionTaskSize = 16, typename TFunctor>
+    SKL_FORCEINLINE decltype( auto ) VisitNewAsyncNetBuffer( uint32_t InSizeClass, TFunctor&& InFunctor ) noexcept
+    {
+        static_assert( 4U == CPacketBufferSizeClassesCount, "Update VisitNewAsyncNetBuffer() for the new size classes" );
+
+        switch( InSizeClass )
+        {
+            case 0U:  return InFunctor( MakeShared<TSizedAsyncNetBuffer<0U, CompletionTaskSize>>() );
+            case 1U:  return InFunctor( MakeShared<TSizedAsyncNetBuffer<1U, CompletionTaskSize>>() );
+            case 2U:  return InFunctor( MakeShared<TSizedAsyncNetBuffer<2U, CompletionTaskSize>>() );
+            default:
+            {
+                SKL_ASSERT( CPacketBufferMaxSizeClass == InSizeClass );
+                return InFunctor( MakeShared<TSizedAsyncNetBuffer<CPacketBufferMaxSizeClass, CompletionTaskSize>>() );
+            }
+        }
+    }
+}
@@ -0,0 +1,66 @@
+//!
+//! \file AsyncNetBroadcast.h
+//!
+//! \brief Zero-copy fan-out of one serialized packet to many connections, grouped by the worker owning each connection
+//!
+//! \author Balan Narcis (balannarcis96@gmail.com)
+//!
+#pragma once
+
+namespace SKL
+{
+    //! One connection targeted by a broadcast
+    struct AsyncNetBroadcastTarget
+    {
+        AsyncNetSendQueue* Queue      { nullptr }; //!< Send queue of the connection
+        Worker*            OwnerWorker{ nullptr }; //!< Worker owning the connection [nullptr = queue from the broadcasting thread]
+    };
+
+    //! Sends one packet, serialized once, to many connections
+    //! \remarks Every target gets a reference to the same buffer, all the references are added with one atomic operation per worker
+    //! \remarks The targets are grouped by their owner worker, each group is queued by its owner [one deferred task per CAsyncNetBroadcast_MaxQueuesPerTask targets] so the packets are coalesced and sent at the end of the owner's tick
+    //! \remarks The targets owned by the broadcasting worker [or by no worker] are queued directly, they are sent at the end of the broadcasting thread's tick
+    //! \remarks If a group can't be handed to its owner, its targets are sent right away from the broadcasting thread [see AsyncNetSendQueue::EnqueueAndFlush()]
+    struct AsyncNetBroadcast
+    {
+        //! Send InPacket to InTargets
+        //! \param InPacket        The serialized packet, InPacket->GetInterface() must describe the bytes to send [must not be modified after the call]
+        //! \param InTargets       The targets, reordered in place [grouped by OwnerWorker]
+        //! \param InTargetsCount  Number of targets
+        //! \param InCallingWorker The worker calling this function [nullptr if not called on a worker]
+        //! \returns the number of targets the packet was queued for or handed to the owner worker of [the failed connections are not counted]
+        static uint32_t Broadcast( TSharedPtr<IAsyncIOTask> InPacket, AsyncNetBroadcastTarget* InTargets, uint32_t InTargetsCount, Worker* InCallingWorker ) noexcept;
+
+        //! Send InPacket to InTargets [eg. any AsyncNetBuffer]
+        template<typename TBuffer>
+        SKL_FORCEINLINE static uint32_t Broadcast( TSharedPtr<TBuffer> InPacket, AsyncNetBroadcastTarget* InTargets, uint32_t InTargetsCount, Worker* InCallingWorker ) noexcept
+        {
+            static_assert( std::is_base_of_v<IAsyncIOTask, TBuffer> );
+            return Broadcast( InPacket.template CastMoveTo<IAsyncIOTask>(), InTargets, InTargetsCount, InCallingWorker );
+        }
+
+    private:
+        //! Are the targets owned by InOwnerWorker queued by the calling thread
+        SKL_FORCEINLINE SKL_NODISCARD static bool IsLocalGroup( const Worker* InOwnerWorker, const Worker* InCallingWorker ) noexcept
+        {
+            return nullptr == InOwnerWorker || InCallingWorker == InOwnerWorker;
+        }
+
+        //! Get the number of targets starting at InBegin owned by the same worker
+        SKL_NODISCARD static uint32_t GetGroupSize( const AsyncNetBroadcastTarget* InBegin, const AsyncNetBroadcastTarget* InEnd ) noexcept
+        {
+            const AsyncNetBroadcastTarget* It{ InBegin + 1 };
+            while( InEnd != It && InBegin->OwnerWorker == It->OwnerWorker )
+            {
+                ++It;
+            }
+
+            return static_cast<uint32_t>( It - InBegin );
+        }
+
+        //! Hand the queues of InTargets to their owner worker [InTargetsCount <= CAsyncNetBroadcast_MaxQueuesPerTask]
+        //! \remarks The task goes to the owner's general task queue [bEnableTaskQueue] or to the async IO queue of the owner's group [bEnableAsyncIO]
+        //! \returns false if the owner has neither queue or if allocating or queueing the task failed
+        static bool DeferToOwner( TSharedPtr<IAsyncIOTask> InPacket, const AsyncNetBroadcastTarget* InTargets, uint32_t InTargetsCount ) noexcept;
+    };
+}
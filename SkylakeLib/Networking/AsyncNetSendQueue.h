@@ -0,0 +1,223 @@
+//!
+//! \file AsyncNetSendQueue.h
+//!
+//! \brief Per connection coalescing of the outbound packets into scatter/gather sends
+//!
+//! \author Balan Narcis (balannarcis96@gmail.com)
+//!
+#pragma once
+
+namespace SKL
+{
+    struct AsyncNetSendFlusher;
+
+    //! Scatter/gather send of the packets coalesced by an AsyncNetSendQueue
+    //! \important OnDispatch must be the first member [see IAsyncIOTask::CastSelfToProto()]
+    struct AsyncNetSendBatch : public IAsyncIOTask
+    {
+        using TDispatch = ASD::UniqueFunctorWrapper<16, IAsyncIOTask::TDispatchFunctionPtr>;
+
+        AsyncNetSendBatch() noexcept: IAsyncIOTask( IBuffer{} ), OnDispatch{} {}
+        ~AsyncNetSendBatch() noexcept
+        {
+            ReleasePackets();
+        }
+
+        //! Release the references to the sent packets
+        //! \remarks The broadcast packets are released at the end of the tick, once per tick on worker threads [see DeferredReleaseBatch], the other packets are released now
+        void ReleasePackets() noexcept
+        {
+            for( uint32_t i = 0; i < Count; ++i )
+            {
+                if( true == bIsBroadcast[i] )
+                {
+                    DeferredReleaseBatch::Release( Packets[i] );
+                }
+                else
+                {
+                    Packets[i].reset();
+                }
+            }
+
+            Count     = 0U;
+            TotalSize = 0U;
+        }
+
+        TDispatch                OnDispatch;                                       //!< Dispatched when the send is completed
+        uint32_t                 Count    { 0U };                                  //!< Number of packets in this send
+        uint32_t                 TotalSize{ 0U };                                  //!< Number of bytes in this send
+        IBuffer                  Buffers[CAsyncNetSendQueue_MaxBatchPackets];      //!< Scatter/gather list, one entry per packet
+        TSharedPtr<IAsyncIOTask> Packets[CAsyncNetSendQueue_MaxBatchPackets];      //!< The sent packets, kept alive until the send is completed
+        bool                     bIsBroadcast[CAsyncNetSendQueue_MaxBatchPackets]; //!< Was the packet fanned out to many queues [see AsyncNetBroadcast]
+    };
+
+    //! Per connection queue of outbound packets, the packets queued during a tick are sent together as one scatter/gather send
+    //! \remarks Flushed at the end of the tick of the worker that queued the packets [see AsyncNetSendFlusher] or earlier, when CAsyncNetSendQueue_FlushThreshold bytes are queued
+    //! \remarks At most one send is in flight, the packets queued meanwhile are sent (in order) when it completes
+    //! \remarks Thread safe, the queue must outlive its in flight send
+    //! \remarks Destroy the queue on the worker it is scheduled on, or Close() it and destroy it once that worker dropped it at the end of its tick [see IsScheduled()]
+    struct AsyncNetSendQueue
+    {
+        AsyncNetSendQueue() noexcept = default;
+        ~AsyncNetSendQueue() noexcept;
+
+        // Can't copy or move, the flusher and the in flight send refer to the queue
+        AsyncNetSendQueue( const AsyncNetSendQueue& ) = delete;
+        AsyncNetSendQueue& operator=( const AsyncNetSendQueue& ) = delete;
+        AsyncNetSendQueue( AsyncNetSendQueue&& ) = delete;
+        AsyncNetSendQueue& operator=( AsyncNetSendQueue&& ) = delete;
+
+        //! Set the socket to send the packets on
+        SKL_FORCEINLINE void SetSocket( TSocket InSocket ) noexcept { Socket = InSocket; }
+
+        //! Get the socket the packets are sent on
+        SKL_FORCEINLINE SKL_NODISCARD TSocket GetSocket() const noexcept { return Socket; }
+
+        //! Queue InBuffer for sending, InBuffer->GetInterface() must describe the bytes to send
+        //! \param bIsBroadcast true if InBuffer is fanned out to many queues, its reference is released at the end of the tick once sent [see DeferredReleaseBatch]
+        //! \returns RSuccess if the packet was queued
+        //! \returns RFail if a send failed [the connection is considered closed, the packet is released]
+        RStatus Enqueue( TSharedPtr<IAsyncIOTask> InBuffer, bool bIsBroadcast = false ) noexcept;
+
+        //! Queue InBuffer for sending [eg. any AsyncNetBuffer]
+        template<typename TBuffer>
+        SKL_FORCEINLINE RStatus Enqueue( TSharedPtr<TBuffer> InBuffer, bool bIsBroadcast = false ) noexcept
+        {
+            static_assert( std::is_base_of_v<IAsyncIOTask, TBuffer> );
+            return Enqueue( InBuffer.template CastMoveTo<IAsyncIOTask>(), bIsBroadcast );
+        }
+
+        //! Queue InBuffer and start sending now, if no send is in flight [the queue is not scheduled on the calling thread's AsyncNetSendFlusher]
+        //! \remarks Use for the queues owned by other workers, when the packet can't be handed to the owner
+        //! \param bIsBroadcast true if InBuffer is fanned out to many queues, its reference is released at the end of the tick once sent [see DeferredReleaseBatch]
+        //! \returns RSuccess if the packet was queued
+        //! \returns RFail if a send failed [the connection is considered closed, the packet is released]
+        RStatus EnqueueAndFlush( TSharedPtr<IAsyncIOTask> InBuffer, bool bIsBroadcast = false ) noexcept;
+
+        //! Start sending the queued packets now, if no send is in flight
+        //! \returns RSuccess if the send was started, there was nothing to send or a send is already in flight
+        //! \returns RFail if a send failed [the connection is considered closed]
+        RStatus Flush() noexcept;
+
+        //! Get the number of queued packets not sent yet [the in flight send is not included]
+        SKL_NODISCARD size_t GetQueuedCount() const noexcept
+        {
+            SpinLockScopeGuard Guard{ Lock };
+            return Queued.size();
+        }
+
+        //! Get the number of queued bytes not sent yet [the in flight send is not included]
+        SKL_NODISCARD uint32_t GetQueuedBytes() const noexcept
+        {
+            SpinLockScopeGuard Guard{ Lock };
+            return QueuedBytes;
+        }
+
+        //! Is a send in flight
+        SKL_NODISCARD bool IsSending() const noexcept
+        {
+            SpinLockScopeGuard Guard{ Lock };
+            return bIsSending;
+        }
+
+        //! Did a send fail [the queued packets were released and no more packets are accepted]
+        SKL_NODISCARD bool HasFailed() const noexcept
+        {
+            SpinLockScopeGuard Guard{ Lock };
+            return bHasFailed;
+        }
+
+        //! Is the queue scheduled on the AsyncNetSendFlusher of a worker [dropped by that flusher at the end of the tick]
+        SKL_NODISCARD bool IsScheduled() const noexcept
+        {
+            SpinLockScopeGuard Guard{ Lock };
+            return nullptr != ScheduledFlusher;
+        }
+
+        //! Release the queued packets and reject any new ones [the in flight send completes normally]
+        //! \remarks Thread safe, the flusher the queue is scheduled on drops it at the end of its tick, the queue can be destroyed on any thread after that [see IsScheduled()]
+        void Close() noexcept;
+
+    private:
+        //! Called by the AsyncNetSendFlusher at the end of the tick
+        void OnTickEnd() noexcept;
+
+        //! Take the next batch of queued packets to send [Lock must be held]
+        //! \remarks If a batch was taken bIsSending is set and OutOpaqueObject holds the reference for the OS, pass it to SendBatch() after releasing the lock
+        //! \returns RSuccess if a batch was taken or there was nothing to send [OutOpaqueObject is null]
+        //! \returns RAllocationFailed if the send batch could not be allocated [the connection is considered closed]
+        RStatus TakeNextBatch_Locked( TSharedPtr<AsyncIOOpaqueType>& OutOpaqueObject ) noexcept;
+
+        //! Start the send of the batch taken by TakeNextBatch_Locked() [Lock must not be held, bIsSending keeps the other senders away from Batch]
+        RStatus SendBatch( TSharedPtr<AsyncIOOpaqueType> InOpaqueObject ) noexcept;
+
+        //! Called when the in flight send is completed
+        void OnSendCompleted( uint32_t InNumberOfBytesTransferred ) noexcept;
+
+        //! Release all the queued packets and reject any new ones [Lock must be held]
+        void Fail_Locked() noexcept;
+
+        struct QueuedPacket
+        {
+            TSharedPtr<IAsyncIOTask> Packet;       //!< The packet to send
+            bool                     bIsBroadcast; //!< Was the packet fanned out to many queues
+        };
+
+        mutable SpinLock              Lock             {};          //!< Guards the state below [the send completes on any worker]
+        std::vector<QueuedPacket>     Queued           {};          //!< Packets queued and not sent yet, in order
+        TSharedPtr<AsyncNetSendBatch> Batch            {};          //!< The scatter/gather send [reused, one in flight at most]
+        AsyncNetSendFlusher*          ScheduledFlusher { nullptr }; //!< The flusher of the worker the queue is scheduled on [nullptr if not scheduled]
+        TSocket                       Socket           { 0U };      //!< Socket to send the packets on
+        uint32_t                      QueuedBytes      { 0U };      //!< Number of bytes in Queued
+        bool                          bIsSending       { false };   //!< Is Batch in flight
+        bool                          bHasFailed       { false };   //!< Did a send fail
+
+        friend struct AsyncNetSendFlusher;
+    };
+
+    //! Per worker thread list of the send queues with packets queued during the current tick
+    //! \remarks Flushed by the active workers at the end of each tick and by the reactive workers after each handled batch of tasks
+    //! \remarks On threads without an instance the queues are sent when the threshold is hit or when AsyncNetSendQueue::Flush() is called
+    struct AsyncNetSendFlusher final : public ITLSSingleton<AsyncNetSendFlusher>
+    {
+        ~AsyncNetSendFlusher() noexcept
+        {
+            Flush();
+        }
+
+        const char *GetName() const noexcept override
+        {
+            return "[AsyncNetSendFlusher]";
+        }
+
+        //! Start the sends of all the queues with packets queued during this tick
+        //! \remarks The closed and failed queues are dropped
+        void Flush() noexcept
+        {
+            for( AsyncNetSendQueue* Queue : Queues )
+            {
+                Queue->OnTickEnd();
+            }
+
+            Queues.clear();
+        }
+
+        //! Get the number of queues waiting for the end of the tick
+        SKL_FORCEINLINE SKL_NODISCARD size_t GetPendingQueuesCount() const noexcept { return Queues.size(); }
+
+    private:
+        //! Remove InQueue [destroyed on this thread before the end of the tick]
+        void Remove( AsyncNetSendQueue* InQueue ) noexcept
+        {
+            const auto It{ std::find( Queues.begin(), Queues.end(), InQueue ) };
+            if( Queues.end() != It )
+            {
+                Queues.erase( It );
+            }
+        }
+
+        std::vector<AsyncNetSendQueue*> Queues{}; //!< Queues to flush at the end of the tick
+
+        friend AsyncNetSendQueue;
+    };
+}
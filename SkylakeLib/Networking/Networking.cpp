@@ -0,0 +1,419 @@
+//!
+//! \file Networking.cpp
+//!
+//! \brief Basic networking abstractions
+//!
+//! \author Balan Narcis (balannarcis96@gmail.com)
+//!
+#include "../SkylakeLib.h"
+
+namespace SKL
+{
+    AsyncNetSendQueue::~AsyncNetSendQueue() noexcept
+    {
+        AsyncNetSendFlusher* Flusher;
+
+        {
+            SpinLockScopeGuard Guard{ Lock };
+            SKL_ASSERT( false == bIsSending );
+
+            Flusher          = ScheduledFlusher;
+            ScheduledFlusher = nullptr;
+        }
+
+        if( nullptr != Flusher )
+        {
+            // only the owner thread unschedules the queue, the flushers of the other workers are never touched [see Close()]
+            SKL_ASSERT_MSG( AsyncNetSendFlusher::GetInstance() == Flusher, "AsyncNetSendQueue destroyed while scheduled on another worker, Close() it and wait for IsScheduled() to be false" );
+            if( AsyncNetSendFlusher::GetInstance() == Flusher ) SKL_LIKELY
+            {
+                Flusher->Remove( this );
+            }
+        }
+    }
+
+    void AsyncNetSendQueue::Close() noexcept
+    {
+        SpinLockScopeGuard Guard{ Lock };
+
+        // the in flight send keeps its packets until it completes [see OnSendCompleted()]
+        Queued.clear();
+        QueuedBytes = 0U;
+        bHasFailed  = true;
+    }
+
+    RStatus AsyncNetSendQueue::Enqueue( TSharedPtr<IAsyncIOTask> InBuffer, bool bIsBroadcast ) noexcept
+    {
+        SKL_ASSERT( nullptr != InBuffer.get() );
+
+        const uint32_t                Size   { InBuffer->GetInterface().Length };
+        auto*                         Flusher{ AsyncNetSendFlusher::GetInstance() };
+        TSharedPtr<AsyncIOOpaqueType> OpaqueObject{};
+
+        {
+            SpinLockScopeGuard Guard{ Lock };
+
+            if( true == bHasFailed ) SKL_UNLIKELY
+            {
+                return RFail;
+            }
+
+            Queued.push_back( QueuedPacket{ std::move( InBuffer ), bIsBroadcast } );
+            QueuedBytes += Size;
+
+            if( CAsyncNetSendQueue_FlushThreshold > QueuedBytes ) SKL_LIKELY
+            {
+                if( nullptr == ScheduledFlusher && nullptr != Flusher )
+                {
+                    ScheduledFlusher = Flusher;
+                    Flusher->Queues.push_back( this );
+                }
+
+                return RSuccess;
+            }
+
+            // don't wait for the end of the tick, if a send is in flight the queued packets are sent when it completes
+            if( true == bIsSending )
+            {
+                return RSuccess;
+            }
+
+            const RStatus Result{ TakeNextBatch_Locked( OpaqueObject ) };
+            if( RSuccess != Result || nullptr == OpaqueObject.get() ) SKL_UNLIKELY
+            {
+                return Result;
+            }
+        }
+
+        return SendBatch( std::move( OpaqueObject ) );
+    }
+
+    RStatus AsyncNetSendQueue::EnqueueAndFlush( TSharedPtr<IAsyncIOTask> InBuffer, bool bIsBroadcast ) noexcept
+    {
+        SKL_ASSERT( nullptr != InBuffer.get() );
+
+        const uint32_t                Size{ InBuffer->GetInterface().Length };
+        TSharedPtr<AsyncIOOpaqueType> OpaqueObject{};
+
+        {
+            SpinLockScopeGuard Guard{ Lock };
+
+            if( true == bHasFailed ) SKL_UNLIKELY
+            {
+                return RFail;
+            }
+
+            Queued.push_back( QueuedPacket{ std::move( InBuffer ), bIsBroadcast } );
+            QueuedBytes += Size;
+
+            // if a send is in flight the packet is sent when it completes
+            if( true == bIsSending )
+            {
+                return RSuccess;
+            }
+
+            const RStatus Result{ TakeNextBatch_Locked( OpaqueObject ) };
+            if( RSuccess != Result || nullptr == OpaqueObject.get() ) SKL_UNLIKELY
+            {
+                return Result;
+            }
+        }
+
+        return SendBatch( std::move( OpaqueObject ) );
+    }
+
+    RStatus AsyncNetSendQueue::Flush() noexcept
+    {
+        TSharedPtr<AsyncIOOpaqueType> OpaqueObject{};
+
+        {
+            SpinLockScopeGuard Guard{ Lock };
+
+            if( true == bHasFailed ) SKL_UNLIKELY
+            {
+                return RFail;
+            }
+
+            if( true == bIsSending )
+            {
+                return RSuccess;
+            }
+
+            const RStatus Result{ TakeNextBatch_Locked( OpaqueObject ) };
+            if( RSuccess != Result || nullptr == OpaqueObject.get() )
+            {
+                return Result;
+            }
+        }
+
+        return SendBatch( std::move( OpaqueObject ) );
+    }
+
+    void AsyncNetSendQueue::OnTickEnd() noexcept
+    {
+        TSharedPtr<AsyncIOOpaqueType> OpaqueObject{};
+
+        {
+            SpinLockScopeGuard Guard{ Lock };
+
+            ScheduledFlusher = nullptr;
+
+            if( true == bHasFailed || true == bIsSending )
+            {
+                return;
+            }
+
+            if( RSuccess != TakeNextBatch_Locked( OpaqueObject ) || nullptr == OpaqueObject.get() )
+            {
+                return;
+            }
+        }
+
+        ( void )SendBatch( std::move( OpaqueObject ) );
+    }
+
+    RStatus AsyncNetSendQueue::TakeNextBatch_Locked( TSharedPtr<AsyncIOOpaqueType>& OutOpaqueObject ) noexcept
+    {
+        SKL_ASSERT( false == bIsSending );
+        SKL_ASSERT( nullptr == OutOpaqueObject.get() );
+
+        if( true == Queued.empty() )
+        {
+            return RSuccess;
+        }
+
+        if( nullptr == Batch.get() ) SKL_UNLIKELY
+        {
+            Batch = MakeShared<AsyncNetSendBatch>();
+            if( nullptr == Batch.get() ) SKL_UNLIKELY
+            {
+                GLOG_ERROR( "AsyncNetSendQueue::TakeNextBatch_Locked() Failed to allocate the send batch!" );
+                Fail_Locked();
+                return RAllocationFailed;
+            }
+
+            Batch->OnDispatch += [this]( IAsyncIOTask&, uint32_t InNumberOfBytesTransferred ) noexcept -> void
+            {
+                OnSendCompleted( InNumberOfBytesTransferred );
+            };
+        }
+
+        AsyncNetSendBatch& Send{ *Batch };
+        SKL_ASSERT( 0U == Send.Count );
+
+        Send.ToOSOpaqueObject()->Reset();
+
+        // take the oldest packets, in order
+        const uint32_t Count{ static_cast<uint32_t>( std::min<size_t>( Queued.size(), CAsyncNetSendQueue_MaxBatchPackets ) ) };
+        for( uint32_t i = 0; i < Count; ++i )
+        {
+            Send.Buffers[i]       = Queued[i].Packet->GetInterface();
+            Send.TotalSize       += Send.Buffers[i].Length;
+            Send.Packets[i]       = std::move( Queued[i].Packet );
+            Send.bIsBroadcast[i]  = Queued[i].bIsBroadcast;
+        }
+        Send.Count = Count;
+
+        Queued.erase( Queued.begin(), Queued.begin() + static_cast<ptrdiff_t>( Count ) );
+        QueuedBytes -= Send.TotalSize;
+        bIsSending   = true;
+
+        // the reference passed to the OS is released by the worker that handles the completion
+        OutOpaqueObject = Batch.ReinterpretCastTo<AsyncIOOpaqueType>();
+
+        return RSuccess;
+    }
+
+    RStatus AsyncNetSendQueue::SendBatch( TSharedPtr<AsyncIOOpaqueType> InOpaqueObject ) noexcept
+    {
+        SKL_ASSERT( nullptr != InOpaqueObject.get() );
+
+        // Batch is not touched by the other threads until the send completes [bIsSending], the OS copies the scatter/gather list before the send can complete
+        AsyncNetSendBatch& Send{ *Batch };
+        if( RSuccess != AsyncIO::SendAsync( Socket, Send.Buffers, Send.Count, std::move( InOpaqueObject ) ) ) SKL_UNLIKELY
+        {
+            SpinLockScopeGuard Guard{ Lock };
+            Fail_Locked();
+            return RFail;
+        }
+
+        return RSuccess;
+    }
+
+    void AsyncNetSendQueue::OnSendCompleted( uint32_t InNumberOfBytesTransferred ) noexcept
+    {
+        TSharedPtr<AsyncIOOpaqueType> OpaqueObject{};
+
+        {
+            SpinLockScopeGuard Guard{ Lock };
+            SKL_ASSERT( true == bIsSending );
+
+            const bool bHasSentAll{ InNumberOfBytesTransferred == Batch->TotalSize };
+
+            Batch->ReleasePackets();
+            bIsSending = false;
+
+            if( false == bHasSentAll ) SKL_UNLIKELY
+            {
+                // canceled [socket closed] or partially sent, the stream can't be continued
+                Fail_Locked();
+                return;
+            }
+
+            // the packets queued while the send was in flight
+            if( RSuccess != TakeNextBatch_Locked( OpaqueObject ) || nullptr == OpaqueObject.get() )
+            {
+                return;
+            }
+        }
+
+        ( void )SendBatch( std::move( OpaqueObject ) );
+    }
+
+    void AsyncNetSendQueue::Fail_Locked() noexcept
+    {
+        if( nullptr != Batch.get() )
+        {
+            Batch->ReleasePackets();
+        }
+
+        Queued.clear();
+        QueuedBytes = 0U;
+        bIsSending  = false;
+        bHasFailed  = true;
+    }
+
+    uint32_t AsyncNetBroadcast::Broadcast( TSharedPtr<IAsyncIOTask> InPacket, AsyncNetBroadcastTarget* InTargets, uint32_t InTargetsCount, Worker* InCallingWorker ) noexcept
+    {
+        SKL_ASSERT( nullptr != InPacket.get() );
+        SKL_ASSERT( nullptr != InTargets || 0U == InTargetsCount );
+
+        if( 0U == InTargetsCount ) SKL_UNLIKELY
+        {
+            return 0U;
+        }
+
+        AsyncNetBroadcastTarget* const End{ InTargets + InTargetsCount };
+
+        // group the targets by their owner worker
+        std::sort( InTargets, End, []( const AsyncNetBroadcastTarget& Left, const AsyncNetBroadcastTarget& Right ) noexcept -> bool
+        {
+            return std::less<Worker*>{}( Left.OwnerWorker, Right.OwnerWorker );
+        } );
+
+        // one reference per local target and one per deferred task
+        uint32_t ReferencesCount{ 0U };
+        for( const AsyncNetBroadcastTarget* It{ InTargets }; End != It; )
+        {
+            const uint32_t GroupSize{ GetGroupSize( It, End ) };
+            ReferencesCount += IsLocalGroup( It->OwnerWorker, InCallingWorker ) 
+                ? GroupSize 
+                : ( GroupSize + CAsyncNetBroadcast_MaxQueuesPerTask - 1U ) / CAsyncNetBroadcast_MaxQueuesPerTask;
+            It += GroupSize;
+        }
+
+        TSharedPtrFanOut<TSharedPtr<IAsyncIOTask>> FanOut{ InPacket, ReferencesCount };
+
+        uint32_t QueuedCount{ 0U };
+        for( const AsyncNetBroadcastTarget* It{ InTargets }; End != It; )
+        {
+            const uint32_t GroupSize{ GetGroupSize( It, End ) };
+
+            if( true == IsLocalGroup( It->OwnerWorker, InCallingWorker ) )
+            {
+                for( uint32_t i = 0; i < GroupSize; ++i )
+                {
+                    SKL_ASSERT( nullptr != It[i].Queue );
+                    if( RSuccess == It[i].Queue->Enqueue( FanOut.Next(), true ) ) SKL_LIKELY
+                    {
+                        ++QueuedCount;
+                    }
+                }
+            }
+            else
+            {
+                for( uint32_t i = 0; i < GroupSize; i += CAsyncNetBroadcast_MaxQueuesPerTask )
+                {
+                    const uint32_t Count{ std::min( GroupSize - i, CAsyncNetBroadcast_MaxQueuesPerTask ) };
+                    if( true == DeferToOwner( FanOut.Next(), It + i, Count ) ) SKL_LIKELY
+                    {
+                        QueuedCount += Count;
+                        continue;
+                    }
+
+                    // send from this thread, the send queues are thread safe [not scheduled on this thread's flusher, the queues belong to another worker]
+                    TSharedPtrFanOut<TSharedPtr<IAsyncIOTask>> FallbackFanOut{ InPacket, Count };
+                    for( uint32_t j = 0; j < Count; ++j )
+                    {
+                        if( RSuccess == It[i + j].Queue->EnqueueAndFlush( FallbackFanOut.Next(), true ) ) SKL_LIKELY
+                        {
+                            ++QueuedCount;
+                        }
+                    }
+                }
+            }
+
+            It += GroupSize;
+        }
+
+        SKL_ASSERT( 0U == FanOut.GetRemaining() );
+
+        return QueuedCount;
+    }
+
+    bool AsyncNetBroadcast::DeferToOwner( TSharedPtr<IAsyncIOTask> InPacket, const AsyncNetBroadcastTarget* InTargets, uint32_t InTargetsCount ) noexcept
+    {
+        SKL_ASSERT( 0U != InTargetsCount && CAsyncNetBroadcast_MaxQueuesPerTask >= InTargetsCount );
+
+        Worker* OwnerWorker{ InTargets[0].OwnerWorker };
+        SKL_ASSERT( nullptr != OwnerWorker );
+
+        WorkerGroup* OwnerGroup{ OwnerWorker->GetGroup() };
+        SKL_ASSERT( nullptr != OwnerGroup );
+
+        const WorkerGroupTag& OwnerTag{ OwnerGroup->GetTag() };
+        if( false == OwnerTag.bEnableTaskQueue && false == OwnerTag.bEnableAsyncIO ) SKL_UNLIKELY
+        {
+            // the owner has no queue to hand the task to
+            return false;
+        }
+
+        std::array<AsyncNetSendQueue*, CAsyncNetBroadcast_MaxQueuesPerTask> Queues;
+        for( uint32_t i = 0; i < InTargetsCount; ++i )
+        {
+            SKL_ASSERT( OwnerWorker == InTargets[i].OwnerWorker );
+            SKL_ASSERT( nullptr != InTargets[i].Queue );
+            Queues[i] = InTargets[i].Queue;
+        }
+
+        auto* NewTask{ MakeTaskRaw( [ Packet = std::move( InPacket ), Queues, InTargetsCount ]( ITask* /*Self*/ ) noexcept -> void
+        {
+            // the owner's references are added at once, the packets are sent at the end of its tick
+            TSharedPtrFanOut<TSharedPtr<IAsyncIOTask>> OwnerFanOut{ Packet, InTargetsCount };
+            for( uint32_t i = 0; i < InTargetsCount; ++i )
+            {
+                ( void )Queues[i]->Enqueue( OwnerFanOut.Next(), true );
+            }
+        } ) };
+        if( nullptr == NewTask ) SKL_UNLIKELY
+        {
+            return false;
+        }
+
+        if( true == OwnerTag.bEnableTaskQueue )
+        {
+            // handled by the owner in its next tick [see WorkerGroup::HandleGeneralTasks()]
+            OwnerWorker->DeferGeneral( NewTask );
+            return true;
+        }
+
+        // handled by the first free worker of the owner's group, the reactive workers of a group share their connections
+        if( RSuccess != OwnerGroup->GetAsyncIOAPI().QueueAsyncWork( reinterpret_cast<TCompletionKey>( NewTask ) ) ) SKL_UNLIKELY
+        {
+            TSharedPtr<ITask>::Static_Reset( NewTask );
+            return false;
+        }
+
+        return true;
+    }
+}
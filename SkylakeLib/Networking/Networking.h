@@ -8,3 +8,5 @@
 #pragma once
 
 #include "AsyncIOBuffer.h"
+#include "AsyncNetSendQueue.h"
+#include "AsyncNetBroadcast.h"
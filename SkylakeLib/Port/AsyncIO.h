@@ -108,6 +108,15 @@ namespace SKL
         //! \return RFail on failure
         static RStatus SendAsync( TSocket InSocket, IBuffer* InBuffer, TSharedPtr<AsyncIOOpaqueType> InOpaqueObject ) noexcept;
 
+        //! \brief Start an async scatter/gather send request on InSocket, the buffers are sent in order as one stream
+        //! \param InSocket target stream socket to send to
+        //! \param InBuffers array of buffers to send
+        //! \param InBuffersCount no of buffers in InBuffers
+        //! \param InOpaqueObject opaque object instance
+        //! \return RSuccess on success
+        //! \return RFail on failure
+        static RStatus SendAsync( TSocket InSocket, IBuffer* InBuffers, uint32_t InBuffersCount, TSharedPtr<AsyncIOOpaqueType> InOpaqueObject ) noexcept;
+
         //! \brief Start an async send request on InSocket
         //! \param InSocket target stream socket to receive from
         //! \param InAsyncIOTask the send async IO task
@@ -83,6 +83,43 @@ namespace SKL
     //! Get the system l1 cache line size
     SKL_NODISCARD size_t GetL1CacheLineSize() noexcept;
 
+    //! Value used for "no preferred NUMA node"
+    constexpr uint32_t CNoNumaNode = 0xFFFFFFFFU;
+
+    //! Get the number of NUMA nodes of the system [1 on non NUMA systems]
+    SKL_NODISCARD uint32_t GetNumaNodesCount() noexcept;
+
+    //! Get the NUMA node of the processor the calling thread is running on [0 on non NUMA systems]
+    //! \remarks The thread can be moved to another node at any time, unless its affinity is restricted to the processors of one node
+    SKL_NODISCARD uint32_t GetCurrentNumaNode() noexcept;
+
+    //! Get the size of a large (huge) memory page [0 if large pages are not supported]
+    SKL_NODISCARD size_t GetLargePageSize() noexcept;
+
+    //! Allocate a zeroed memory region backed by large (huge) pages, falls back to regular pages if large pages can't be used
+    //! \remarks Regions smaller than one large page are always allocated with regular pages
+    //! \remarks The region must be freed with GFreeLargePages()
+    //! \remarks If InNumaNode is not CNoNumaNode the physical memory is preferably taken from that NUMA node
+    //! \returns nullptr on failure, bOutIsLargePages is set to true only if the region is backed by large pages
+    SKL_NODISCARD void* GAllocLargePages( size_t InSize, bool& bOutIsLargePages, uint32_t InNumaNode = CNoNumaNode ) noexcept;
+
+    //! Free a memory region allocated with GAllocLargePages()
+    void GFreeLargePages( void* InPointer, size_t InSize ) noexcept;
+
+    //! Allocate a zeroed memory region (regular pages) with the physical memory preferably taken from InNumaNode
+    //! \remarks The region must be freed with GFreeOnNumaNode()
+    //! \returns nullptr on failure
+    SKL_NODISCARD void* GAllocOnNumaNode( size_t InSize, uint32_t InNumaNode ) noexcept;
+
+    //! Free a memory region allocated with GAllocOnNumaNode()
+    void GFreeOnNumaNode( void* InPointer, size_t InSize ) noexcept;
+
+    //! Tell the OS that the content of the whole pages inside [InPointer, InPointer + InSize) is no longer needed, their physical memory can be reclaimed
+    //! \remarks The region stays valid (reserved and committed), the content of the discarded pages is undefined until written again
+    //! \remarks Must not be used on regions backed by large pages
+    //! \returns the number of bytes discarded [0 if the region doesn't contain a whole page]
+    size_t GDiscardPages( void* InPointer, size_t InSize ) noexcept;
+
     struct PlatformTLS final
     {
         static constexpr TLSSlot INVALID_SLOT_ID = 0xFFFFFFFF;
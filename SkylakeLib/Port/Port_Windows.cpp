@@ -725,13 +725,20 @@ namespace SKL
     
     RStatus AsyncIO::SendAsync( TSocket InSocket, IBuffer* InBuffer, TSharedPtr<AsyncIOOpaqueType> InOpaqueObject ) noexcept
     {
+        return SendAsync( InSocket, InBuffer, 1U, std::move( InOpaqueObject ) );
+    }
+
+    RStatus AsyncIO::SendAsync( TSocket InSocket, IBuffer* InBuffers, uint32_t InBuffersCount, TSharedPtr<AsyncIOOpaqueType> InOpaqueObject ) noexcept
+    {
+        SKL_ASSERT( 0U != InBuffersCount );
+
         DWORD NumberOfBytesReceived { 0 };
 
-        // sys call to start the receive async IO request
+        // sys call to start the send async IO request [IBuffer has the layout of WSABUF]
         const auto Result = ::WSASend(
             static_cast<SOCKET>( InSocket )
-          , reinterpret_cast<LPWSABUF>( InBuffer )
-          , 1
+          , reinterpret_cast<LPWSABUF>( InBuffers )
+          , static_cast<DWORD>( InBuffersCount )
           , &NumberOfBytesReceived
           , 0
           , reinterpret_cast<OVERLAPPED*>( InOpaqueObject.get() )
@@ -992,6 +999,147 @@ namespace SKL
         return lineSize;
     }
 
+    //! Enable the SeLockMemoryPrivilege for the process, required for large page allocations
+    static bool GEnableLockMemoryPrivilege() noexcept
+    {
+        HANDLE Token{ nullptr };
+        if( FALSE == ::OpenProcessToken( ::GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &Token ) )
+        {
+            return false;
+        }
+
+        TOKEN_PRIVILEGES Privileges{};
+        Privileges.PrivilegeCount           = 1;
+        Privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+        if( FALSE == ::LookupPrivilegeValueW( nullptr, SE_LOCK_MEMORY_NAME, &Privileges.Privileges[0].Luid ) )
+        {
+            ::CloseHandle( Token );
+            return false;
+        }
+
+        // AdjustTokenPrivileges succeeds with ERROR_NOT_ALL_ASSIGNED if the account does not hold the privilege
+        const BOOL  bResult{ ::AdjustTokenPrivileges( Token, FALSE, &Privileges, 0, nullptr, nullptr ) };
+        const DWORD Error  { ::GetLastError() };
+
+        ::CloseHandle( Token );
+
+        return FALSE != bResult && ERROR_SUCCESS == Error;
+    }
+
+    uint32_t GetNumaNodesCount() noexcept
+    {
+        static const uint32_t NodesCount{ []() noexcept -> uint32_t
+        {
+            ULONG HighestNodeNumber{ 0 };
+            if( FALSE == ::GetNumaHighestNodeNumber( &HighestNodeNumber ) )
+            {
+                return 1U;
+            }
+
+            return static_cast<uint32_t>( HighestNodeNumber ) + 1U;
+        }() };
+
+        return NodesCount;
+    }
+
+    uint32_t GetCurrentNumaNode() noexcept
+    {
+        PROCESSOR_NUMBER ProcessorNumber;
+        ::GetCurrentProcessorNumberEx( &ProcessorNumber );
+
+        USHORT NodeNumber{ 0 };
+        if( FALSE == ::GetNumaProcessorNodeEx( &ProcessorNumber, &NodeNumber ) || MAXUSHORT == NodeNumber )
+        {
+            return 0U;
+        }
+
+        return static_cast<uint32_t>( NodeNumber );
+    }
+
+    size_t GetLargePageSize() noexcept
+    {
+        return static_cast<size_t>( ::GetLargePageMinimum() );
+    }
+
+    //! VirtualAlloc() with an optional preferred NUMA node
+    static void* GVirtualAllocOnNode( size_t InSize, DWORD InAllocationType, uint32_t InNumaNode ) noexcept
+    {
+        if( CNoNumaNode == InNumaNode )
+        {
+            return ::VirtualAlloc( nullptr, InSize, InAllocationType, PAGE_READWRITE );
+        }
+
+        return ::VirtualAllocExNuma( ::GetCurrentProcess(), nullptr, InSize, InAllocationType, PAGE_READWRITE, static_cast<DWORD>( InNumaNode ) );
+    }
+
+    void* GAllocLargePages( size_t InSize, bool& bOutIsLargePages, uint32_t InNumaNode ) noexcept
+    {
+        static const bool bCanUseLargePages{ 0U != GetLargePageSize() && true == GEnableLockMemoryPrivilege() };
+
+        bOutIsLargePages = false;
+
+        const size_t LargePageSize{ GetLargePageSize() };
+        if( true == bCanUseLargePages && InSize >= LargePageSize )
+        {
+            // large page allocations must be a multiple of the large page size
+            const size_t AllocSize{ ( ( InSize + LargePageSize - 1 ) / LargePageSize ) * LargePageSize };
+
+            void* Result{ GVirtualAllocOnNode( AllocSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, InNumaNode ) };
+            if( nullptr != Result )
+            {
+                bOutIsLargePages = true;
+                return Result;
+            }
+        }
+
+        // fallback to regular pages
+        return GVirtualAllocOnNode( InSize, MEM_RESERVE | MEM_COMMIT, InNumaNode );
+    }
+
+    void GFreeLargePages( void* InPointer, size_t InSize ) noexcept
+    {
+        ( void )InSize;
+        ( void )::VirtualFree( InPointer, 0, MEM_RELEASE );
+    }
+
+    void* GAllocOnNumaNode( size_t InSize, uint32_t InNumaNode ) noexcept
+    {
+        return GVirtualAllocOnNode( InSize, MEM_RESERVE | MEM_COMMIT, InNumaNode );
+    }
+
+    void GFreeOnNumaNode( void* InPointer, size_t InSize ) noexcept
+    {
+        ( void )InSize;
+        ( void )::VirtualFree( InPointer, 0, MEM_RELEASE );
+    }
+
+    size_t GDiscardPages( void* InPointer, size_t InSize ) noexcept
+    {
+        static const size_t PageSize{ []() noexcept -> size_t
+        {
+            SYSTEM_INFO SystemInfo;
+            ::GetSystemInfo( &SystemInfo );
+            return static_cast<size_t>( SystemInfo.dwPageSize );
+        }() };
+
+        // only the whole pages inside the region can be discarded
+        const uintptr_t Begin{ ( reinterpret_cast<uintptr_t>( InPointer ) + PageSize - 1U ) & ~( PageSize - 1U ) };
+        const uintptr_t End  { ( reinterpret_cast<uintptr_t>( InPointer ) + InSize ) & ~( PageSize - 1U ) };
+        if( Begin >= End )
+        {
+            return 0U;
+        }
+
+        // MEM_RESET keeps the pages committed but lets the OS drop their content instead of paging it out
+        if( nullptr == ::VirtualAlloc( reinterpret_cast<void*>( Begin ), End - Begin, MEM_RESET, PAGE_READWRITE ) ) SKL_UNLIKELY
+        {
+            return 0U;
+        }
+
+        return static_cast<size_t>( End - Begin );
+    }
+
     std::vector<std::string> ScanForFilesInDirectory( const char* RootDirectory, size_t& OutMaxFileSize, const std::vector<std::string>& extensions ) noexcept
     {
         std::vector<std::string> result;
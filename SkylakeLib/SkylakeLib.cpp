@@ -87,6 +87,9 @@ namespace SKL
             return Result;
         }
 
+        // No thread can hold references to the retired objects anymore
+        ( void )EpochReclamation::FreeAllRetiredObjects();
+
         GlobalMemoryManager::FreeAllPools();
 
         GIsInit.exchange( false );
@@ -121,6 +124,18 @@ namespace SKL
             }
         }
 
+        if constexpr( CMemoryManager_UseThreadCache )
+        {
+            if( nullptr == GlobalMemoryThreadCache::GetInstance() )
+            {
+                if( RSuccess != GlobalMemoryThreadCache::Create() )
+                {
+                    GTRACE_ERROR( "[Skylake_InitializeLibrary_Thread()] Failed to create GlobalMemoryThreadCache" );
+                    return RFail;
+                }
+            }
+        }
+
         SkylakeLibInitPerThread::SetValue( true );
 
         return RSuccess;
@@ -140,6 +155,9 @@ namespace SKL
             SKL::ThreadLocalMemoryManager::Destroy();
         }
 
+        // return all the cached blocks to the global pools
+        GlobalMemoryThreadCache::Destroy();
+
         StringUtils::Destroy();
     
         TRand::ShutdownThread();
@@ -169,6 +187,315 @@ namespace SKL
     SKL_IFMEMORYSTATS( SKL_CACHE_ALIGNED std::atomic<size_t> SkylakeGlobalMemoryManager::CustomSizeDeallocations{ 0 } );
     SKL_IFMEMORYSTATS( SKL_CACHE_ALIGNED std::atomic<size_t> SkylakeGlobalMemoryManager::TotalAllocations       { 0 } );
     SKL_IFMEMORYSTATS( SKL_CACHE_ALIGNED std::atomic<size_t> SkylakeGlobalMemoryManager::TotalDeallocations     { 0 } );
+    SKL_IFMEMORYSTATS( SKL_CACHE_ALIGNED std::atomic<size_t> SkylakeGlobalMemoryManager::NumaRemoteDeallocations[CMemoryManager_MaxNumaNodes]{} );
+
+    //! Registry of all thread local remote free lists
+    static SpinLock                                GRemoteFreeListsLock  {};
+    static std::vector<ThreadLocalRemoteFreeList*> GRemoteFreeLists      {};
+    static std::vector<ThreadLocalRemoteFreeList*> GClosedRemoteFreeLists{}; //!< Closed lists waiting to be recycled
+
+    ThreadLocalRemoteFreeList* ThreadLocalMemoryManager::AcquireRemoteFreeList() noexcept
+    {
+        // a closed list can still be the owner tag of blocks freed late, recycle it only once the slabs of the terminated threads were freed
+        if( 0U == SlabRegistry::GetPendingSlabsCount() )
+        {
+            SpinLockScopeGuard Guard{ GRemoteFreeListsLock };
+
+            if( false == GClosedRemoteFreeLists.empty() )
+            {
+                auto* RecycledList{ GClosedRemoteFreeLists.back() };
+                GClosedRemoteFreeLists.pop_back();
+
+                RecycledList->Reopen();
+                return RecycledList;
+            }
+        }
+
+        auto* NewList{ new ThreadLocalRemoteFreeList() };
+
+        SpinLockScopeGuard Guard{ GRemoteFreeListsLock };
+        GRemoteFreeLists.push_back( NewList );
+
+        return NewList;
+    }
+
+    void ThreadLocalMemoryManager::ReleaseRemoteFreeList( ThreadLocalRemoteFreeList* InList ) noexcept
+    {
+        SKL_ASSERT( true == InList->IsClosed() );
+
+        SpinLockScopeGuard Guard{ GRemoteFreeListsLock };
+        GClosedRemoteFreeLists.push_back( InList );
+    }
+
+    //! Registry of all pools slabs [sorted by address]
+    struct SlabRecord
+    {
+        uint8_t*    Slab             { nullptr };
+        size_t      SlabSize         { 0U };
+        size_t      Alignment        { 0U };
+        size_t      OutstandingBlocks{ 0U };               //!< Blocks still in use [only valid after the slab was released]
+        ESlabSource Source           { ESlabSource::Heap };
+        bool        bIsReleased      { false };            //!< Was the slab released by its pool
+    };
+    static SpinLock                GSlabsLock{};
+    static std::vector<SlabRecord> GSlabs    {};
+
+    SKL_CACHE_ALIGNED std::synced_value<size_t> SlabRegistry::SlabsCount{ 0U };
+
+    static void GFreeSlabMemory( const SlabRecord& InRecord ) noexcept
+    {
+        switch( InRecord.Source )
+        {
+            case ESlabSource::LargePages:
+                GFreeLargePages( InRecord.Slab, InRecord.SlabSize );
+                break;
+            case ESlabSource::NumaNode:
+                GFreeOnNumaNode( InRecord.Slab, InRecord.SlabSize );
+                break;
+            default:
+                SKL_FREE_SIZE_ALIGNED( InRecord.Slab, InRecord.SlabSize, InRecord.Alignment );
+                break;
+        }
+    }
+
+    //! Find the slab containing InPointer [GSlabsLock must be held]
+    static std::vector<SlabRecord>::iterator GFindSlab( const void* InPointer ) noexcept
+    {
+        auto It{ std::upper_bound( GSlabs.begin(), GSlabs.end(), reinterpret_cast<uintptr_t>( InPointer ), []( uintptr_t InValue, const SlabRecord& InRecord ) noexcept
+        {
+            return InValue < reinterpret_cast<uintptr_t>( InRecord.Slab );
+        } ) };
+
+        if( GSlabs.begin() == It )
+        {
+            return GSlabs.end();
+        }
+
+        --It;
+        return ( reinterpret_cast<uintptr_t>( InPointer ) - reinterpret_cast<uintptr_t>( It->Slab ) ) < It->SlabSize ? It : GSlabs.end();
+    }
+
+    void SlabRegistry::Register( void* InSlab, size_t InSlabSize ) noexcept
+    {
+        SKL_ASSERT( nullptr != InSlab );
+
+        SlabRecord NewRecord{};
+        NewRecord.Slab     = reinterpret_cast<uint8_t*>( InSlab );
+        NewRecord.SlabSize = InSlabSize;
+
+        SpinLockScopeGuard Guard{ GSlabsLock };
+
+        auto It{ std::upper_bound( GSlabs.begin(), GSlabs.end(), NewRecord.Slab, []( const uint8_t* InValue, const SlabRecord& InRecord ) noexcept
+        {
+            return InValue < InRecord.Slab;
+        } ) };
+        ( void )GSlabs.insert( It, NewRecord );
+
+        ( void )SlabsCount.increment();
+    }
+
+    void SlabRegistry::Release( void* InSlab, size_t InSlabSize, size_t InAlignment, ESlabSource InSource, size_t InOutstandingBlocks ) noexcept
+    {
+        SlabRecord Record{};
+
+        {
+            SpinLockScopeGuard Guard{ GSlabsLock };
+
+            auto It{ GFindSlab( InSlab ) };
+            SKL_ASSERT( GSlabs.end() != It && InSlab == It->Slab && InSlabSize == It->SlabSize && false == It->bIsReleased );
+
+            It->Alignment = InAlignment;
+            It->Source    = InSource;
+
+            if( 0U != InOutstandingBlocks )
+            {
+                // keep the slab alive, it is freed with its last block
+                It->OutstandingBlocks = InOutstandingBlocks;
+                It->bIsReleased       = true;
+                return;
+            }
+
+            Record = *It;
+            ( void )GSlabs.erase( It );
+            ( void )SlabsCount.decrement();
+        }
+
+        GFreeSlabMemory( Record );
+    }
+
+    size_t SlabRegistry::GetPendingSlabsCount() noexcept
+    {
+        SpinLockScopeGuard Guard{ GSlabsLock };
+        return static_cast<size_t>( std::count_if( GSlabs.begin(), GSlabs.end(), []( const SlabRecord& InRecord ) noexcept { return InRecord.bIsReleased; } ) );
+    }
+
+    void SlabRegistry::FreeBlockSlow( void* InBlock, size_t InBlockSize, size_t InAlignment ) noexcept
+    {
+        SlabRecord Record{};
+
+        {
+            SpinLockScopeGuard Guard{ GSlabsLock };
+
+            auto It{ GFindSlab( InBlock ) };
+            if( GSlabs.end() == It )
+            {
+                // OS allocated block
+                SKL_FREE_SIZE_ALIGNED( InBlock, InBlockSize, InAlignment );
+                return;
+            }
+
+            if( false == It->bIsReleased ) SKL_UNLIKELY
+            {
+                // the block belongs to a slab still owned by another pool, freeing it would corrupt that pool, leak it instead
+                SKL_ASSERT_MSG( false, "[SlabRegistry] Block returned to the wrong pool!" );
+                return;
+            }
+
+            SKL_ASSERT( 0U != It->OutstandingBlocks );
+            if( 0U != --It->OutstandingBlocks )
+            {
+                return;
+            }
+
+            // last block returned
+            Record = *It;
+            ( void )GSlabs.erase( It );
+            ( void )SlabsCount.decrement();
+        }
+
+        GFreeSlabMemory( Record );
+    }
+}
+
+//Epoch Reclamation
+namespace SKL
+{
+    SKL_CACHE_ALIGNED std::atomic<uint64_t> EpochReclamation::GlobalEpoch      { 1U };
+    SKL_CACHE_ALIGNED std::atomic<uint32_t> EpochReclamation::ParticipantsCount{ 0U };
+    SKL_CACHE_ALIGNED std::atomic<size_t>   EpochReclamation::OrphansCount     { 0U };
+    EpochParticipant                        EpochReclamation::Participants[CEpochReclamation_MaxParticipants]{};
+
+    //! Registry lock of the participant slots and the objects retired on threads without an instance
+    static SpinLock                   GEpochReclamationLock{};
+    static std::vector<RetiredObject> GOrphanRetiredObjects{};
+
+    RStatus EpochReclamation::Initialize() noexcept
+    {
+        {
+            SpinLockScopeGuard Guard{ GEpochReclamationLock };
+
+            const uint32_t Count{ ParticipantsCount.load( std::memory_order_relaxed ) };
+            for( uint32_t i = 0; i < Count; ++i )
+            {
+                if( FALSE == Participants[i].bIsInUse )
+                {
+                    Participant = &Participants[i];
+                    break;
+                }
+            }
+
+            if( nullptr == Participant )
+            {
+                if( CEpochReclamation_MaxParticipants == Count ) SKL_UNLIKELY
+                {
+                    GLOG_ERROR( "EpochReclamation::Initialize() Too many participants! Max:%u", CEpochReclamation_MaxParticipants );
+                    return RFail;
+                }
+
+                Participant = &Participants[Count];
+                ParticipantsCount.store( Count + 1U, std::memory_order_release );
+            }
+
+            Participant->bIsInUse = TRUE;
+        }
+
+        Retired.reserve( CEpochReclamation_RetiredReserve );
+        GoOnline();
+
+        return RSuccess;
+    }
+
+    EpochReclamation::~EpochReclamation() noexcept
+    {
+        if( nullptr == Participant ) SKL_UNLIKELY
+        {
+            return;
+        }
+
+        GoOffline();
+
+        SpinLockScopeGuard Guard{ GEpochReclamationLock };
+
+        // the objects not freed yet are handed to the remaining participants
+        GOrphanRetiredObjects.insert( GOrphanRetiredObjects.end(), Retired.begin(), Retired.end() );
+        OrphansCount.store( GOrphanRetiredObjects.size(), std::memory_order_relaxed );
+        Retired.clear();
+
+        Participant->bIsInUse = FALSE;
+        Participant           = nullptr;
+    }
+
+    void EpochReclamation::RetireOrphan( const RetiredObject& InObject ) noexcept
+    {
+        SpinLockScopeGuard Guard{ GEpochReclamationLock };
+        GOrphanRetiredObjects.push_back( InObject );
+        OrphansCount.store( GOrphanRetiredObjects.size(), std::memory_order_relaxed );
+    }
+
+    size_t EpochReclamation::ReclaimOrphans( uint64_t InGlobalEpoch ) noexcept
+    {
+        std::vector<RetiredObject> ToFree{};
+
+        if( false == GEpochReclamationLock.TryLock() )
+        {
+            // another participant is reclaiming them
+            return 0U;
+        }
+
+        // not ordered by epoch [handed over by multiple threads]
+        for( size_t i = 0; i < GOrphanRetiredObjects.size(); )
+        {
+            if( GOrphanRetiredObjects[i].Epoch + 2U <= InGlobalEpoch )
+            {
+                ToFree.push_back( GOrphanRetiredObjects[i] );
+                GOrphanRetiredObjects[i] = GOrphanRetiredObjects.back();
+                GOrphanRetiredObjects.pop_back();
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        OrphansCount.store( GOrphanRetiredObjects.size(), std::memory_order_relaxed );
+        GEpochReclamationLock.Unlock();
+
+        // free outside the lock, the deleters can retire more objects
+        for( const RetiredObject& Item : ToFree )
+        {
+            Item.Deleter( Item.Object );
+        }
+
+        return ToFree.size();
+    }
+
+    size_t EpochReclamation::FreeAllRetiredObjects() noexcept
+    {
+        size_t Result{ 0U };
+
+        if( auto* Instance{ GetInstance() }; nullptr != Instance )
+        {
+            Result += Instance->ReclaimRetired( std::numeric_limits<uint64_t>::max() );
+        }
+
+        // the deleters can retire more objects
+        while( 0U != OrphansCount.load( std::memory_order_relaxed ) )
+        {
+            Result += ReclaimOrphans( std::numeric_limits<uint64_t>::max() );
+        }
+
+        return Result;
+    }
 }
 
 //IService
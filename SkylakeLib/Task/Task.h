@@ -68,6 +68,12 @@ namespace SKL
             return Due > Other.Due;
         }
 
+        //! Set the remote free list of the thread that allocated this task
+        SKL_FORCEINLINE void SetOwner( ThreadLocalRemoteFreeList* InOwner ) noexcept { Owner = InOwner; }
+
+        //! Get the remote free list of the thread that allocated this task
+        SKL_FORCEINLINE SKL_NODISCARD ThreadLocalRemoteFreeList* GetOwner() const noexcept { return Owner; }
+
     protected:
         const TDispatchProto& CastSelfToProto() const noexcept
         {
@@ -83,7 +89,8 @@ namespace SKL
             );
         }
 
-        TEpochTimePoint Due { 0 }; //!< Used for when this task is delayed
+        TEpochTimePoint            Due   { 0 };       //!< Used for when this task is delayed
+        ThreadLocalRemoteFreeList* Owner { nullptr }; //!< Remote free list of the allocating thread [only for thread local allocated tasks]
 
         friend struct TaskQueue;
     };
@@ -138,6 +145,28 @@ namespace SKL
         return { MakeTaskRaw( std::forward<TFunctor>( InFunctor ) ) };
     }
 
+    //! Release one reference to the deferred task, if last reference, the task is destroyed and the memory returned to the pool it was allocated from
+    //! \remarks Tasks allocated from the thread local memory manager (ITask::GetOwner() != nullptr) can be released on any thread
+    SKL_FORCEINLINE void ReleaseDeferredTask( ITask* InTask ) noexcept
+    {
+        SKL_ASSERT( nullptr != InTask );
+
+        ThreadLocalRemoteFreeList* Owner{ InTask->GetOwner() };
+        if( nullptr != Owner ) SKL_LIKELY
+        {
+            void* Block{ MemoryPolicy::SharedMemoryPolicy<false>::DestroyForObject<ITask, true, false>( InTask ) };
+            if( nullptr != Block )
+            {
+                const auto* CBlock{ reinterpret_cast<const MemoryPolicy::ControlBlock*>( Block ) };
+                ThreadLocalMemoryManager::DeallocateFromAnyThread( Owner, Block, static_cast<size_t>( CBlock->BlockSize ) );
+            }
+        }
+        else
+        {
+            TSharedPtr<ITask>::Static_Reset( InTask );
+        }
+    }
+
     //! Defer an newly allocated task [void(__cdecl*)( ITask* )]
     void DeferTask( ITask* InTask ) noexcept;
 
@@ -155,23 +184,27 @@ namespace SKL
 
         TaskType* NewTask;
 
-        if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHandleTimerTasks 
-                   && CTaskScheduling_AssumeAllWorkerGroupsHaveTLSMemoryManagement )
+        if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHaveTLSMemoryManagement )
         {
             SKL_ASSERT( nullptr != ThreadLocalMemoryManager::GetInstance() );
 
-            // allocate from the thread local memory manager (fast)
+            // allocate from the thread local memory manager (fast) [the task can be released on any worker, see ReleaseDeferredTask()]
             NewTask = TLSMakeSharedRaw<TaskType>();
+            if( nullptr == NewTask ) SKL_UNLIKELY
+            {
+                return false;
+            }
+
+            NewTask->SetOwner( ThreadLocalMemoryManager::GetOwnerTag() );
         }
         else
         {
             // allocate from the global memory manager
             NewTask = MakeSharedRaw<TaskType>();
-        }
-        
-        if( nullptr == NewTask ) SKL_UNLIKELY
-        {
-            return false;
+            if( nullptr == NewTask ) SKL_UNLIKELY
+            {
+                return false;
+            }
         }
 
         // set functor
@@ -194,23 +227,27 @@ namespace SKL
 
         TaskType* NewTask;
 
-        if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHandleTimerTasks 
-                   && CTaskScheduling_AssumeAllWorkerGroupsHaveTLSMemoryManagement )
+        if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHaveTLSMemoryManagement )
         {
             SKL_ASSERT( nullptr != ThreadLocalMemoryManager::GetInstance() );
 
-            // allocate from the thread local memory manager (fast)
+            // allocate from the thread local memory manager (fast) [the task can be released on any worker, see ReleaseDeferredTask()]
             NewTask = TLSMakeSharedRaw<TaskType>();
+            if( nullptr == NewTask ) SKL_UNLIKELY
+            {
+                return false;
+            }
+
+            NewTask->SetOwner( ThreadLocalMemoryManager::GetOwnerTag() );
         }
         else
         {
             // allocate from the global memory manager
             NewTask = MakeSharedRaw<TaskType>();
-        }
-        
-        if( nullptr == NewTask ) SKL_UNLIKELY
-        {
-            return false;
+            if( nullptr == NewTask ) SKL_UNLIKELY
+            {
+                return false;
+            }
         }
 
         // set functor
@@ -102,25 +102,41 @@ namespace SKL
         // Clear global delayed tasks
         while( auto* Task{ DelayedTasks.Pop() })
         {
-            TSharedPtr<ITask>::Static_Reset( Task );
+            ReleaseDeferredTask( Task );
         }
 
         // Clear AOD shared object delayed tasks
         while( auto* Task{ AODSharedObjectDelayedTasks.Pop() })
         {
-            TSharedPtr<IAODSharedObjectTask>::Static_Reset( reinterpret_cast<IAODSharedObjectTask*>( Task ) );
+            ReleaseAODTask( reinterpret_cast<IAODSharedObjectTask*>( Task ) );
         }
         
         // Clear AOD custom object delayed tasks
         while( auto* Task{ AODCustomObjectDelayedTasks.Pop() })
         {
-            TSharedPtr<IAODCustomObjectTask>::Static_Reset( reinterpret_cast<IAODCustomObjectTask*>( Task ) );
+            ReleaseAODTask( reinterpret_cast<IAODCustomObjectTask*>( Task ) );
         }
 
         // Clear AOD static object delayed tasks
         while( auto* Task{ AODStaticObjectDelayedTasks.Pop() })
         {
-            TSharedPtr<IAODStaticObjectTask>::Static_Reset( reinterpret_cast<IAODStaticObjectTask*>( Task ) );
+            ReleaseAODTask( reinterpret_cast<IAODStaticObjectTask*>( Task ) );
+        }
+
+        // Finish the AOD flushes handed off to this worker inline, each task carries the consumer role of its object
+        while( auto* Task{ reinterpret_cast<IAODSharedObjectTask*>( AODSharedObjectFlushContinuations.Pop() ) })
+        {
+            Task->GetParent()->ResumeFlush( Task );
+        }
+
+        while( auto* Task{ reinterpret_cast<IAODCustomObjectTask*>( AODCustomObjectFlushContinuations.Pop() ) })
+        {
+            Task->GetParent()->ResumeFlush( Task );
+        }
+
+        while( auto* Task{ reinterpret_cast<IAODStaticObjectTask*>( AODStaticObjectFlushContinuations.Pop() ) })
+        {
+            Task->GetParent()->ResumeFlush( Task );
         }
 
         #if defined(SKL_KPI_QUEUE_SIZES)
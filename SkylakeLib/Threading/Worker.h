@@ -78,6 +78,11 @@ namespace SKL
         //! Defer AOD task execution on this worker
         SKL_FORCEINLINE void Defer( IAODSharedObjectTask* InTask ) noexcept
         {
+            if constexpr( CAOD_EnableWorkerAffinity )
+            {
+                ( void )PendingAODDeferredTasks.increment();
+            }
+
             AODSharedObjectDelayedTasks.Push( InTask );
             
             #if defined(SKL_KPI_QUEUE_SIZES)
@@ -88,6 +93,11 @@ namespace SKL
         //! Defer AOD task execution on this worker
         SKL_FORCEINLINE void Defer( IAODStaticObjectTask* InTask ) noexcept
         {
+            if constexpr( CAOD_EnableWorkerAffinity )
+            {
+                ( void )PendingAODDeferredTasks.increment();
+            }
+
             AODStaticObjectDelayedTasks.Push( InTask );
             
             #if defined(SKL_KPI_QUEUE_SIZES)
@@ -98,6 +108,11 @@ namespace SKL
         //! Defer AOD task execution on this worker
         SKL_FORCEINLINE void Defer( IAODCustomObjectTask* InTask ) noexcept
         {
+            if constexpr( CAOD_EnableWorkerAffinity )
+            {
+                ( void )PendingAODDeferredTasks.increment();
+            }
+
             AODCustomObjectDelayedTasks.Push( InTask );
             
             #if defined(SKL_KPI_QUEUE_SIZES)
@@ -105,11 +120,45 @@ namespace SKL
             #endif
         }
 
+        //! Defer the rest of an AOD object flush (that exhausted its budget) on this worker
+        SKL_FORCEINLINE void DeferAODFlushContinuation( IAODSharedObjectTask* InNextTask ) noexcept
+        {
+            AODSharedObjectFlushContinuations.Push( InNextTask );
+        }
+
+        //! Defer the rest of an AOD object flush (that exhausted its budget) on this worker
+        SKL_FORCEINLINE void DeferAODFlushContinuation( IAODStaticObjectTask* InNextTask ) noexcept
+        {
+            AODStaticObjectFlushContinuations.Push( InNextTask );
+        }
+
+        //! Defer the rest of an AOD object flush (that exhausted its budget) on this worker
+        SKL_FORCEINLINE void DeferAODFlushContinuation( IAODCustomObjectTask* InNextTask ) noexcept
+        {
+            AODCustomObjectFlushContinuations.Push( InNextTask );
+        }
+
         //! Get the group owning this worker
         SKL_FORCEINLINE SKL_NODISCARD WorkerGroup* GetGroup() const noexcept { return Group; }
     
         //! Get the global unique index of this worker
         SKL_FORCEINLINE SKL_NODISCARD int32_t GetIndex() const noexcept { return WorkerIndex; }
+
+        //! Get the id of this worker used as AOD object affinity hint [ GroupId << 16 | IndexInGroup ]
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t GetAffinityId() const noexcept { return AffinityId; }
+
+        //! Get the per tick bump arena of this worker [nullptr until the worker runs]
+        //! \remarks The arena is reset at the end of each tick, see FrameArena
+        SKL_FORCEINLINE SKL_NODISCARD struct FrameArena* GetFrameArena() const noexcept { return TickFrameArena.load_relaxed(); }
+
+        //! Get the number of deferred AOD tasks not yet handled by this worker
+        SKL_FORCEINLINE SKL_NODISCARD uint32_t GetPendingAODDeferredTasksCount() const noexcept { return PendingAODDeferredTasks.load_relaxed(); }
+
+        //! Build the affinity id of the worker at [InIndexInGroup] in the group with id [InGroupId] (0 = no worker)
+        SKL_FORCEINLINE SKL_NODISCARD static constexpr uint32_t MakeAffinityId( uint16_t InGroupId, uint16_t InIndexInGroup ) noexcept 
+        {
+            return ( static_cast<uint32_t>( InGroupId ) << 16U ) | static_cast<uint32_t>( InIndexInGroup );
+        }
         
     #if defined(SKL_KPI_WORKER_TICK)
         //! Get the average tick time in seconds of this worker
@@ -124,11 +173,16 @@ namespace SKL
         void Clear() noexcept;
                 
         const int32_t                                         WorkerIndex                {};          //!< Globally unique worker index
+        uint32_t                                              AffinityId                 { 0U };      //!< Id of this worker used as AOD object affinity hint [ GroupId << 16 | IndexInGroup ]
         SKL_CACHE_ALIGNED TaskQueue                           Tasks                      {};          //!< Single consumer multiple producers queue for general tasks 
         SKL_CACHE_ALIGNED TaskQueue                           DelayedTasks               {};          //!< Single consumer multiple producers queue for delayed tasks 
         SKL_CACHE_ALIGNED AODTaskQueue                        AODSharedObjectDelayedTasks{};          //!< Single consumer multiple producers queue for AOD delayed tasks 
         SKL_CACHE_ALIGNED AODTaskQueue                        AODStaticObjectDelayedTasks{};          //!< Single consumer multiple producers queue for AOD delayed tasks 
         SKL_CACHE_ALIGNED AODTaskQueue                        AODCustomObjectDelayedTasks{};          //!< Single consumer multiple producers queue for AOD delayed tasks 
+        SKL_CACHE_ALIGNED AODTaskQueue                        AODSharedObjectFlushContinuations{};    //!< Single consumer multiple producers queue for AOD flushes handed off to this worker
+        SKL_CACHE_ALIGNED AODTaskQueue                        AODStaticObjectFlushContinuations{};    //!< Single consumer multiple producers queue for AOD flushes handed off to this worker
+        SKL_CACHE_ALIGNED AODTaskQueue                        AODCustomObjectFlushContinuations{};    //!< Single consumer multiple producers queue for AOD flushes handed off to this worker
+        SKL_CACHE_ALIGNED std::relaxed_value<uint32_t>        PendingAODDeferredTasks    { 0U };      //!< Number of deferred AOD tasks not yet handled by this worker [load measure for the AOD worker affinity]
         SKL_CACHE_ALIGNED std::synced_value<uint32_t>         bIsRunning                 { FALSE };   //!< Is this worker signaled to run
         std::synced_value<uint32_t>                           bIsMasterThread            { FALSE };   //!< Is this a master worker
         std::relaxed_value<TEpochTimePoint>                   StartedAt                  { 0U };      //!< Time point when the worker started
@@ -137,6 +191,7 @@ namespace SKL
         std::jthread                                          Thread                     {};          //!< Thread of this worker
         std::relaxed_value<struct AODTLSContext*>             AODTLSContext              {};          //!< Cached AODTLSContext instance for this worker
         std::relaxed_value<struct ServerInstanceTLSContext*>  ServerInstanceTLSContext   {};          //!< Cached ServerInstanceTLSContext instance for this worker
+        std::relaxed_value<struct FrameArena*>                TickFrameArena             {};          //!< Cached FrameArena instance for this worker
 
         #if defined(SKL_KPI_WORKER_TICK)
         SKL_CACHE_ALIGNED double TickAverageTime{ 0.0 }; // Average tick time KPI
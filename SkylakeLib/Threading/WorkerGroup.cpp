@@ -137,6 +137,9 @@ namespace SKL
                 return RAllocationFailed;
             }
 
+            // index zero is the invalid worker slot
+            NewWorker->AffinityId = Worker::MakeAffinityId( Tag.Id, static_cast<uint16_t>( i + 1U ) );
+
             // check if this worker must be the master worker
             const bool bIsSelectedAsMasterWorker{ true == bIncludeMaster && i == Tag.WorkersCount - 1 };
             if( true == bIsSelectedAsMasterWorker )
@@ -827,6 +830,10 @@ namespace SKL
             uint32_t           NumberOfBytesTransferred{ 0U };
 
             const auto Result = AsyncIOAPI.GetCompletedAsyncRequest( &OpaqueType, &NumberOfBytesTransferred, &CompletionKey );
+
+            // the tasks can read objects protected by the epochs
+            EpochReclamation::Static_GoOnline();
+
             if( RSuccess != Result ) SKL_UNLIKELY
             {
                 if( RSystemFailure == Result )
@@ -857,6 +864,10 @@ namespace SKL
             ( void )::memset( OpaqueBuffer, 0, sizeof( AsyncIOOpaqueEntryType ) * CMaxAsyncRequestsToDequeuePerTick );
 
             const auto Result = AsyncIOAPI.GetMultipleCompletedAsyncRequest( OpaqueBuffer, CMaxAsyncRequestsToDequeuePerTick, DequeuedCount );
+
+            // the tasks can read objects protected by the epochs
+            EpochReclamation::Static_GoOnline();
+
             if( RSuccess != Result ) SKL_ALLWAYS_UNLIKELY
             {
                 if( RSystemFailure == Result )
@@ -943,9 +954,80 @@ namespace SKL
         #endif
     }
 
-    void WorkerGroup::HandleAODDelayedTasks_Local( Worker& /*Worker*/ ) noexcept
+    template<typename TTask>
+    SKL_FORCEINLINE static void ResumeAODFlushContinuations( AODTaskQueue& InQueue ) noexcept
+    {
+        // Throttled, the flush can be handed off to this worker again
+        for( uint32_t i = 0U; i < CAOD_MaxFlushContinuationsPerTick; ++i )
+        {
+            auto* NextTask{ reinterpret_cast<TTask*>( InQueue.Pop() ) };
+            if( nullptr == NextTask )
+            {
+                break;
+            }
+
+            auto* Parent{ NextTask->GetParent() };
+            SKL_ASSERT( nullptr != Parent );
+            Parent->ResumeFlush( NextTask );
+        }
+    }
+
+    //! Dispatch the due AOD tasks deferred to this worker, the rest are delayed on this worker
+    //! \returns the number of tasks taken from the queue
+    template<typename TTask, typename TDelayedTasks>
+    uint64_t WorkerGroup::HandleAODDeferredTasks( AODTaskQueue& InQueue, TDelayedTasks& InOutDelayedTasks ) noexcept
+    {
+        const auto Now  { GetSystemUpTickCount() };
+        uint64_t   Count{ 0U };
+
+        while( auto* NewTask{ reinterpret_cast<TTask*>( InQueue.Pop() ) } )
+        {
+            if( true == NewTask->IsDue( Now ) )
+            {
+                auto* Parent{ NewTask->GetParent() };
+                SKL_ASSERT( nullptr != Parent );
+                ( void )Parent->Dispatch( NewTask );
+            }
+            else
+            {
+                InOutDelayedTasks.push( NewTask );
+            }
+
+            ++Count;
+        }
+
+        return Count;
+    }
+
+    void WorkerGroup::HandleAODDelayedTasks_Local( Worker& Worker ) noexcept
     {
         auto& TLSContext{ *AODTLSContext::GetInstance() };
+
+        // Resume the AOD object flushes handed off to this worker
+        ResumeAODFlushContinuations<IAODSharedObjectTask>( Worker.AODSharedObjectFlushContinuations );
+        ResumeAODFlushContinuations<IAODCustomObjectTask>( Worker.AODCustomObjectFlushContinuations );
+        ResumeAODFlushContinuations<IAODStaticObjectTask>( Worker.AODStaticObjectFlushContinuations );
+
+        // Handle the AOD tasks deferred to this worker (scheduled by other workers or routed here by the AOD worker affinity)
+        const uint64_t DeferredCustomTasksCount{ HandleAODDeferredTasks<IAODCustomObjectTask>( Worker.AODCustomObjectDelayedTasks, TLSContext.DelayedCustomObjectTasks ) };
+        const uint64_t DeferredSharedTasksCount{ HandleAODDeferredTasks<IAODSharedObjectTask>( Worker.AODSharedObjectDelayedTasks, TLSContext.DelayedSharedObjectTasks ) };
+        const uint64_t DeferredStaticTasksCount{ HandleAODDeferredTasks<IAODStaticObjectTask>( Worker.AODStaticObjectDelayedTasks, TLSContext.DelayedStaticObjectTasks ) };
+
+        #if defined(SKL_KPI_QUEUE_SIZES)
+        KPIContext::Decrement_AODCustomObjectDelayedTasksQueueSize( DeferredCustomTasksCount );
+        KPIContext::Decrement_AODSharedObjectDelayedTasksQueueSize( DeferredSharedTasksCount );
+        KPIContext::Decrement_AODStaticObjectDelayedTasksQueueSize( DeferredStaticTasksCount );
+        #endif
+
+        if constexpr( CAOD_EnableWorkerAffinity )
+        {
+            const uint64_t DeferredTasksCount{ DeferredCustomTasksCount + DeferredSharedTasksCount + DeferredStaticTasksCount };
+            if( 0U != DeferredTasksCount )
+            {
+                ( void )Worker.PendingAODDeferredTasks.decrement( static_cast<uint32_t>( DeferredTasksCount ) );
+            }
+        }
+
         auto  Now{ GetSystemUpTickCount() };
         
         //Shared Object tasks
@@ -1019,91 +1101,8 @@ namespace SKL
     {
         SKL_ASSERT( false == CTaskScheduling_AssumeAllWorkerGroupsHandleAOD );
         //GTRACE();
-        
-        #if defined(SKL_KPI_QUEUE_SIZES)
-        uint64_t RemovedTasks{ 0U };
-        #endif
-
-        auto& TLSContext{ *AODTLSContext::GetInstance() };
-        auto  Now{ GetSystemUpTickCount() };
-        
-        //Custom Object tasks
-        while( auto* NewTask{ reinterpret_cast<IAODCustomObjectTask*>( Worker.AODCustomObjectDelayedTasks.Pop() ) } )
-        {
-            if( true == NewTask->IsDue( Now ) )
-            {
-                auto* Parent{ NewTask->GetParent() };
-                SKL_ASSERT( nullptr != Parent );
-                ( void )Parent->Dispatch( NewTask );
-            }
-            else
-            {
-                TLSContext.DelayedCustomObjectTasks.push( NewTask );
-            }
-
-            #if defined(SKL_KPI_QUEUE_SIZES)
-            ( void )++RemovedTasks;
-            #endif
-        }
-        
-        #if defined(SKL_KPI_QUEUE_SIZES)
-        KPIContext::Decrement_AODCustomObjectDelayedTasksQueueSize( RemovedTasks );
-        RemovedTasks = 0U;
-        #endif
-
-        //Update now
-        Now = GetSystemUpTickCount();
-        
-        //Shared Object tasks
-        while( auto* NewTask{ reinterpret_cast<IAODSharedObjectTask*>( Worker.AODSharedObjectDelayedTasks.Pop() ) } )
-        {
-            if( true == NewTask->IsDue( Now ) )
-            {
-                auto* Parent{ NewTask->GetParent() };
-                SKL_ASSERT( nullptr != Parent );
-                ( void )Parent->Dispatch( NewTask );
-            }
-            else
-            {
-                TLSContext.DelayedSharedObjectTasks.push( NewTask );
-            }
-
-            #if defined(SKL_KPI_QUEUE_SIZES)
-            ( void )++RemovedTasks;
-            #endif
-        }
-        
-        #if defined(SKL_KPI_QUEUE_SIZES)
-        KPIContext::Decrement_AODSharedObjectDelayedTasksQueueSize( RemovedTasks );
-        RemovedTasks = 0U;
-        #endif
-
-        //Update now
-        Now = GetSystemUpTickCount();
-
-        //Static Object tasks
-        while( auto* NewTask{ reinterpret_cast<IAODStaticObjectTask*>( Worker.AODStaticObjectDelayedTasks.Pop() ) } )
-        {
-            if( true == NewTask->IsDue( Now ) )
-            {
-                auto* Parent{ NewTask->GetParent() };
-                SKL_ASSERT( nullptr != Parent );
-                ( void )Parent->Dispatch( NewTask );
-            }
-            else
-            {
-                TLSContext.DelayedStaticObjectTasks.push( NewTask );
-            }
-            
-            #if defined(SKL_KPI_QUEUE_SIZES)
-            ( void )++RemovedTasks;
-            #endif
-        }
-        
-        #if defined(SKL_KPI_QUEUE_SIZES)
-        KPIContext::Decrement_AODStaticObjectDelayedTasksQueueSize( RemovedTasks );
-        #endif
 
+        // The AOD tasks deferred to this worker are handled by HandleAODDelayedTasks_Local()
         HandleAODDelayedTasks_Local( Worker );
     }
 
@@ -1136,17 +1135,7 @@ namespace SKL
 
                 Task->Dispatch();
 
-                if constexpr( CTaskScheduling_AssumeAllWorkerGroupsHandleTimerTasks 
-                           && CTaskScheduling_AssumeAllWorkerGroupsHaveTLSMemoryManagement )
-                {
-                    SKL_ASSERT( nullptr != ThreadLocalMemoryManager::GetInstance() );
-
-                    TLSSharedPtr<ITask>::Static_Reset( Task );
-                }
-                else
-                {
-                    TSharedPtr<ITask>::Static_Reset( Task );
-                }
+                ReleaseDeferredTask( Task );
             }
             else
             {
@@ -1171,7 +1160,7 @@ namespace SKL
             if( true == NewTask->IsDue( Now ) )
             {
                 NewTask->Dispatch();
-                TSharedPtr<ITask>::Static_Reset( NewTask );
+                ReleaseDeferredTask( NewTask );
             }
             else
             {
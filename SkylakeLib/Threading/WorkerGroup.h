@@ -266,6 +266,8 @@ namespace SKL
         static void HandleGeneralTasksWithThrottle( Worker& Worker ) noexcept;
         static void HandleAODDelayedTasks_Local( Worker& Worker ) noexcept;
         static void HandleAODDelayedTasks_Global( Worker& Worker ) noexcept;
+        template<typename TTask, typename TDelayedTasks>
+        static uint64_t HandleAODDeferredTasks( AODTaskQueue& InQueue, TDelayedTasks& InOutDelayedTasks ) noexcept;
         static void HandleTimerTasks_Local() noexcept;
         static void HandleTimerTasks_Global( Worker& Worker ) noexcept;
 
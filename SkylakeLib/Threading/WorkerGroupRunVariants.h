@@ -45,6 +45,19 @@ namespace SKL
             
             InWorker.AODTLSContext.exchange( SKL::AODTLSContext::GetInstance() );
             InWorker.ServerInstanceTLSContext.exchange( SKL::ServerInstanceTLSContext::GetInstance() );
+
+            auto* TickFrameArena{ SKL::FrameArena::GetInstance() };
+            SKL_ASSERT( nullptr != TickFrameArena );
+            InWorker.TickFrameArena.exchange( TickFrameArena );
+
+            auto* TickDeferredRelease{ SKL::DeferredReleaseBatch::GetInstance() };
+            SKL_ASSERT( nullptr != TickDeferredRelease );
+
+            auto* TickEpochReclamation{ SKL::EpochReclamation::GetInstance() };
+            SKL_ASSERT( nullptr != TickEpochReclamation );
+
+            auto* TickSendFlusher{ SKL::AsyncNetSendFlusher::GetInstance() };
+            SKL_ASSERT( nullptr != TickSendFlusher );
             
             #if defined(SKL_KPI_WORKER_TICK)
             KPITimeValue TickTiming;
@@ -56,6 +69,9 @@ namespace SKL
                 TickTiming.Begin();
                 #endif
 
+                // Return the thread local memory blocks freed by other threads to this worker's pools
+                ( void )ThreadLocalMemoryManager::ReclaimRemoteFreed();
+
                 if constexpr( Flags.bEnableAsyncIO )
                 {
                     const bool bShouldTermiante{ InGroup.HandleTasks_Proactive( MillisecondsToSleep ) };
@@ -124,6 +140,26 @@ namespace SKL
                     OnWorkerTick.Dispatch( InWorker, InGroup );
                 }
 
+                // Send the packets queued during this tick, one scatter/gather send per connection
+                TickSendFlusher->Flush();
+
+                // Release all the shared references deferred during this tick [one atomic operation per object]
+                TickDeferredRelease->Flush();
+
+                // Release all the transient allocations made during this tick
+                TickFrameArena->Reset();
+
+                // No references to the objects protected by the epochs are held between ticks, free the objects retired two epochs ago
+                TickEpochReclamation->Quiescent();
+
+                if constexpr( CMemoryManager_UsePoolTrimming )
+                {
+                    // Return the memory of the pool blocks idle after a usage spike to the OS
+                    const auto Now{ GetSystemUpTickCount() };
+                    ( void )ThreadLocalMemoryManager::TickTrimming( Now );
+                    ( void )SkylakeGlobalMemoryManager::TickTrimming( Now );
+                }
+
                 if constexpr( false == Flags.bEnableAsyncIO )
                 {
 #if defined(SKL_USE_PRECISE_SLEEP)
@@ -186,6 +222,19 @@ namespace SKL
             InWorker.AODTLSContext.exchange( SKL::AODTLSContext::GetInstance() );
             InWorker.ServerInstanceTLSContext.exchange( SKL::ServerInstanceTLSContext::GetInstance() );
 
+            auto* TickFrameArena{ SKL::FrameArena::GetInstance() };
+            SKL_ASSERT( nullptr != TickFrameArena );
+            InWorker.TickFrameArena.exchange( TickFrameArena );
+
+            auto* TickDeferredRelease{ SKL::DeferredReleaseBatch::GetInstance() };
+            SKL_ASSERT( nullptr != TickDeferredRelease );
+
+            auto* TickEpochReclamation{ SKL::EpochReclamation::GetInstance() };
+            SKL_ASSERT( nullptr != TickEpochReclamation );
+
+            auto* TickSendFlusher{ SKL::AsyncNetSendFlusher::GetInstance() };
+            SKL_ASSERT( nullptr != TickSendFlusher );
+
             while( InGroup.IsRunning() ) SKL_LIKELY
             {
                 if constexpr( Flags.bSupportsTLSSync )
@@ -198,6 +247,9 @@ namespace SKL
                 }
                 else
                 {
+                    // The wait for work is not bounded, don't hold back the reclamation while blocked [back online in HandleTasks_Reactive()]
+                    TickEpochReclamation->GoOffline();
+
                     const bool bShouldTermiante{ InGroup.HandleTasks_Reactive() };
                     if ( true == bShouldTermiante ) SKL_UNLIKELY
                     {
@@ -205,6 +257,9 @@ namespace SKL
                     }
                 }
 
+                // Return the thread local memory blocks freed by other threads to this worker's pools
+                ( void )ThreadLocalMemoryManager::ReclaimRemoteFreed();
+
                 if constexpr( Flags.bSupportsTLSSync )
                 {
                     ServerTLSSyncSystem->TLSTick( InWorker, InGroup );
@@ -214,6 +269,26 @@ namespace SKL
                 {
                     MyTLSSyncSystem->TLSTick( InWorker, InGroup );
                 }
+
+                // Send the packets queued while handling this batch of tasks, one scatter/gather send per connection
+                TickSendFlusher->Flush();
+
+                // Release all the shared references deferred while handling this batch of tasks [one atomic operation per object]
+                TickDeferredRelease->Flush();
+
+                // Release all the transient allocations made while handling this batch of tasks
+                TickFrameArena->Reset();
+
+                // No references to the objects protected by the epochs are held between batches of tasks, free the objects retired two epochs ago
+                TickEpochReclamation->Quiescent();
+
+                if constexpr( CMemoryManager_UsePoolTrimming )
+                {
+                    // Return the memory of the pool blocks idle after a usage spike to the OS
+                    const auto Now{ GetSystemUpTickCount() };
+                    ( void )ThreadLocalMemoryManager::TickTrimming( Now );
+                    ( void )SkylakeGlobalMemoryManager::TickTrimming( Now );
+                }
             }
             
             if constexpr( Flags.bSupportsTLSSync )
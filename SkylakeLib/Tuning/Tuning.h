@@ -13,6 +13,14 @@ namespace SKL
         MemoryManager
       ------------------------------------------------------------*/
     constexpr bool   CMemoryManager_UseSpinLock_Or_Atomics                      = true;                        //!< Should the MemoryManager use SpinLock or atomic operation for internal thread sync
+    constexpr bool   CMemoryManager_UseSlabPreallocation                        = true;                        //!< Should the MemoryManager pools carve all their blocks out of one contiguous allocation (slab)
+    constexpr bool   CMemoryManager_UseLargePages                               = false;                       //!< Should the MemoryManager pools slabs be backed by large (2 MiB) pages, falls back to regular pages [requires CMemoryManager_UseSlabPreallocation and SeLockMemoryPrivilege]
+    constexpr bool   CMemoryManager_UseThreadCache                              = true;                        //!< Should the MemoryManager put per thread magazines (stacks of cached blocks) in front of the small blocks pools [see GlobalMemoryThreadCache]
+    constexpr bool   CMemoryManager_UseNumaPartitions                           = false;                       //!< Should the MemoryManager keep one set of pools per NUMA node, threads allocate from their node pools and the blocks are freed back to their home node [requires CMemoryManager_UseSlabPreallocation]
+    constexpr uint32_t CMemoryManager_MaxNumaNodes                              = 4U;                          //!< [4      nodes] Max number of NUMA nodes with their own pools [the nodes above share the pools of the lower nodes]
+    constexpr size_t CMemoryManager_ThreadCacheMaxBlockSize                     = 1024U;                       //!< [1024   bytes] Only the pools with blocks up to this size are cached per thread
+    constexpr uint32_t CMemoryManager_ThreadCacheSize                           = 64U;                         //!< [64    blocks] Per thread magazine capacity, for each cached pool
+    constexpr uint32_t CMemoryManager_ThreadCacheBatchSize                      = 32U;                         //!< [32    blocks] Number of blocks moved between a magazine and its pool at once (the pool lock is taken once per batch)
     constexpr size_t CMemoryManager_Pool1_BlockSize                             = 64U;                         //!< [64     bytes] MemoryManager.Pool1 block size in bytes
     constexpr size_t CMemoryManager_Pool1_BlockCount                            = 32768U;                      //!< [32768 blocks] MemoryManager.Pool1 number of cached blocks
     constexpr size_t CMemoryManager_Pool2_BlockSize                             = 128U;                        //!< [128    bytes] MemoryManager.Pool2 block size in bytes
@@ -21,14 +29,36 @@ namespace SKL
     constexpr size_t CMemoryManager_Pool3_BlockCount                            = 32768U;                      //!< [32768 blocks] MemoryManager.Pool3 number of cached blocks
     constexpr size_t CMemoryManager_Pool4_BlockSize                             = 1024U;                       //!< [1024   bytes] MemoryManager.Pool4 block size in bytes
     constexpr size_t CMemoryManager_Pool4_BlockCount                            = 16384U;                      //!< [16384 blocks] MemoryManager.Pool4 number of cached blocks
+    constexpr bool   CMemoryManager_UseSizeClasses                              = true;                        //!< Should the MemoryManager serve the sizes between Pool4 and Pool5 from geometrically spaced size classes [see SizeClassesTable]
+    constexpr size_t CMemoryManager_SizeClassesCount                            = 16U;                         //!< [16   classes] Number of size classes above Pool4
+    constexpr size_t CMemoryManager_SizeClassesSpacingPercent                   = 25U;                         //!< [25         %] Each size class is this much larger than the previous one
+    constexpr size_t CMemoryManager_SizeClassPoolBytes                          = (1024U * 256U);              //!< [256   kbytes] Number of bytes cached by each size class pool (at most 4 MiB for all the classes)
+    constexpr size_t CMemoryManager_ThreadLocalSizeClassPoolBytes               = (1024U * 64U);               //!< [64    kbytes] Number of bytes cached by each size class pool of each ThreadLocalMemoryManager (at most 1 MiB per thread)
     constexpr size_t CMemoryManager_Pool5_BlockSize                             = (1024U * 512U);              //!< [512   kbytes] MemoryManager.Pool5 block size in bytes
     constexpr size_t CMemoryManager_Pool5_BlockCount                            = 8192U;                       //!< [8192  blocks] MemoryManager.Pool5 number of cached blocks
     constexpr size_t CMemoryManager_Pool6_BlockSize                             = ((1024U * 1024U) * 2U);      //!< [2     mbytes] MemoryManager.Pool6 block size in bytes
     constexpr size_t CMemoryManager_Pool6_BlockCount                            = 8U;                          //!< [8     blocks] MemoryManager.Pool6 number of cached blocks
+    constexpr bool   CMemoryManager_UsePoolTrimming                             = true;                        //!< Should the MemoryManager return the memory of the blocks idle after a usage spike to the OS [see PoolTrimPolicy, requires CMemoryManager_UseSlabPreallocation]
+    constexpr uint64_t CMemoryManager_TrimWindowMs                              = 10000U;                      //!< [10000     ms] Window over which the low-water mark of the cached blocks of each pool is tracked
+    constexpr uint64_t CMemoryManager_TrimSampleIntervalMs                      = 50U;                         //!< [50        ms] Min interval between two samples of the pools
+    constexpr size_t CMemoryManager_TrimReservePercent                          = 25U;                         //!< [25         %] Percent of the peak number of blocks in use that is never trimmed
+    constexpr size_t CMemoryManager_TrimMinCachedBlocks                         = 2U;                          //!< [2     blocks] Min number of blocks never trimmed from each pool
+    constexpr size_t CMemoryManager_TrimMaxBlocksPerPass                        = 256U;                        //!< [256   blocks] Max number of blocks trimmed from one pool at the end of a window
+    constexpr size_t CMemoryManager_TrimMinBlockSize                            = 4096U;                       //!< [4096   bytes] Only the pools with blocks of at least this size are trimmed [only whole pages can be returned to the OS]
+    constexpr uint32_t CMemoryManager_SiteProfilerSampleRate                    = 1024U;                       //!< [1 in  1024 ] Each thread samples one in this many allocations [requires SKL_MEMORY_SITE_PROFILER, see AllocationSiteProfiler]
+    constexpr size_t CMemoryManager_SiteProfilerMaxSites                        = 2048U;                       //!< [2048   sites] Max number of distinct (call site, block size) pairs tracked
+    constexpr size_t CMemoryManager_SiteProfilerMaxLiveSamples                  = 16384U;                      //!< [16384 blocks] Max number of sampled blocks tracked while alive [power of two]
+    constexpr size_t CMemoryManager_SiteProfilerReportTopSites                  = 32U;                         //!< [32     sites] Number of sites logged by the report, by live bytes
     SKL_IF_ALLOC_SIZE_GUARDED( constexpr size_t CMemoryManager_MaxAllocSize     = ((1024U * 1024U) * 1024U) ); //!< [1        GiB] The maximum size the MemoryManager is allowed to alloc at once
     SKL_IF_CACHE_LINE_MEM_MANAGER( constexpr size_t CMemoryManager_Alignment    = SKL_CACHE_LINE_SIZE );       //!< Align all the MemoryManager memory blocks to the cache line
     SKL_IFNOT_CACHE_LINE_MEM_MANAGER( constexpr size_t CMemoryManager_Alignment = sizeof( void * ) );          //!< Align all the MemoryManager memory blocks to 8 bytes
 
+    static_assert( 0U < CMemoryManager_ThreadCacheBatchSize && CMemoryManager_ThreadCacheBatchSize <= CMemoryManager_ThreadCacheSize );
+    static_assert( 0U < CMemoryManager_SizeClassesSpacingPercent );
+    static_assert( 0U < CMemoryManager_MaxNumaNodes && ( false == CMemoryManager_UseNumaPartitions || true == CMemoryManager_UseSlabPreallocation ), "The NUMA partitions require the slab preallocation" );
+    static_assert( 0U < CMemoryManager_TrimWindowMs && CMemoryManager_TrimReservePercent <= 100U );
+    static_assert( 0U < CMemoryManager_SiteProfilerSampleRate && 0U == ( CMemoryManager_SiteProfilerMaxLiveSamples & ( CMemoryManager_SiteProfilerMaxLiveSamples - 1U ) ) );
+
     // Sizes guard, don't change!
     static_assert( CMemoryManager_Pool1_BlockSize < std::numeric_limits<uint32_t>::max()
                 && CMemoryManager_Pool2_BlockSize < std::numeric_limits<uint32_t>::max() 
@@ -74,10 +104,18 @@ namespace SKL
         static constexpr size_t  Pool6_BlockSize  = ((1024U * 1024U) * 2U);
         static constexpr size_t  Pool6_BlockCount = 8U;         
 
+        static constexpr bool    bUseSizeClasses            = CMemoryManager_UseSizeClasses;
+        static constexpr size_t  SizeClassesCount           = CMemoryManager_SizeClassesCount;
+        static constexpr size_t  SizeClassesSpacingPercent  = CMemoryManager_SizeClassesSpacingPercent;
+        static constexpr size_t  SizeClassPoolBytes         = CMemoryManager_ThreadLocalSizeClassPoolBytes;
+        static constexpr bool    bUsePoolTrimming           = CMemoryManager_UsePoolTrimming;
+
         static constexpr wchar_t PoolName[]                          = L"MainThreadLocalMemoryManager";         
         static constexpr bool    bIsThreadSafe                       = false;
         static constexpr bool    bUseSpinLock_Or_Atomics             = false;
         static constexpr bool    bAlignAllMemoryBlocksToTheCacheLine = false;
+        static constexpr bool    bUseSlabPreallocation               = true;
+        static constexpr bool    bUseLargePages                      = false;
 #if defined(SKL_GUARD_ALLOC_SIZE)
         static constexpr size_t  MaxAllocationSize                   = CMemoryManager_MaxAllocSize;
 #else
@@ -100,6 +138,36 @@ namespace SKL
       ------------------------------------------------------------*/
     constexpr size_t CTLSSyncSystem_QueueSize = 524288U; //!< [ 1024 * 512 ] Max number of TLSSyncTasks in the TLSSync tasks queue at once
 
+    /*------------------------------------------------------------
+        Frame arena
+      ------------------------------------------------------------*/
+    constexpr size_t CFrameArena_ChunkSize = ( 1024U * 256U ); //!< [256 kbytes] Initial size of each worker's per tick bump arena [grows to the peak tick usage]
+
+    /*------------------------------------------------------------
+        Deferred release
+      ------------------------------------------------------------*/
+    constexpr size_t CDeferredRelease_MaxObjects = 256U; //!< Max number of distinct objects with deferred releases per worker per tick [power of two, the batch is flushed early when half full]
+
+    /*------------------------------------------------------------
+        Epoch reclamation
+      ------------------------------------------------------------*/
+    constexpr uint32_t CEpochReclamation_MaxParticipants = 256U;  //!< Max number of threads participating in the epoch based reclamation at the same time
+    constexpr size_t   CEpochReclamation_RetiredReserve  = 1024U; //!< Initial capacity of each participant's list of retired objects
+
+    /*------------------------------------------------------------
+        STL node pool
+      ------------------------------------------------------------*/
+    constexpr uint32_t CSTLNodePool_NodesPerChunk = 16U;  //!< Number of nodes allocated at once by a container's node pool
+    constexpr uint32_t CSTLNodePool_MaxNodeSizes  = 4U;   //!< Max number of distinct node sizes pooled per container
+    constexpr uint32_t CSTLNodePool_MaxNodeSize   = 256U; //!< Max size of a pooled node, larger allocations are forwarded to the ThreadLocalMemoryManager
+
+    /*------------------------------------------------------------
+        Net send queue
+      ------------------------------------------------------------*/
+    constexpr uint32_t CAsyncNetSendQueue_FlushThreshold   = ( 1024U * 16U ); //!< [16 kbytes] A connection's send queue is flushed before the end of the tick when this many bytes are queued
+    constexpr uint32_t CAsyncNetSendQueue_MaxBatchPackets  = 64U;             //!< Max number of packets sent at once by one scatter/gather send
+    constexpr uint32_t CAsyncNetBroadcast_MaxQueuesPerTask = 32U;             //!< Max number of send queues handed to their owner worker by one broadcast task
+
     /*------------------------------------------------------------
         String Utils
       ------------------------------------------------------------*/
@@ -111,6 +179,25 @@ namespace SKL
     constexpr uint32_t CMaxAsyncRequestsToDequeuePerTick = 32U;
     constexpr uint32_t CWorkerGroupNameMaxChars          = 64U;
 
+    /*------------------------------------------------------------
+        AOD
+      ------------------------------------------------------------*/
+    constexpr uint32_t CAOD_RemoteFreeReclaimInterval       = 64U;   //!< [TLS AOD tasks] Reclaim the tasks freed by other threads once every n task allocations (power of two)
+    constexpr uint32_t CAOD_FlushTaskBudget                 = 0U;    //!< [tasks] Max tasks dispatched by a consumer on one AOD object before the rest of the flush is handed to another worker (0 = unbounded, eg. 4096)
+    constexpr uint32_t CAOD_FlushTimeBudget                 = 0U;    //!< [ms]    Max time spent by a consumer flushing one AOD object before the rest of the flush is handed to another worker (0 = unbounded, eg. 2)
+    constexpr uint32_t CAOD_FlushTimeBudgetCheckInterval    = 32U;   //!< [tasks] Check the flush time budget once every n dispatched tasks (power of two)
+    constexpr uint32_t CAOD_MaxFlushContinuationsPerTick    = 32U;   //!< Max number of handed off AOD flushes resumed by a worker per tick
+    constexpr uint32_t CAOD_MaxFlushStatsTypes              = 256U;  //!< Max number of AOD object types with their own flush budget hits counter [see AOD::Object::TrackFlushStatsAs()]
+    constexpr bool     CAOD_EnableExtendedObjects           = false; //!< Add the preferred worker, the max pending tasks and the flush stats type to each AOD object (grows each object from 4 to 6 pointers) [see AOD::ObjectExtension]
+    constexpr bool     CAOD_EnableWorkerAffinity            = false; //!< Route the delayed tasks of an AOD object to its preferred worker [see AOD::Object::SetPreferredWorker(), requires CAOD_EnableExtendedObjects]
+    constexpr uint32_t CAOD_WorkerAffinityMaxPendingTasks   = 1024U; //!< [tasks] A preferred worker with more deferred AOD tasks pending is overloaded, the task is scheduled as if there was no preferred worker
+    constexpr bool     CAOD_EnableConcurrentReads           = true;  //!< Execute the reads issued on an idle AOD object concurrently [see AOD::SharedObject::DoAsyncRead()], when disabled the reads are dispatched as regular tasks
+
+    static_assert( ( CAOD_RemoteFreeReclaimInterval & ( CAOD_RemoteFreeReclaimInterval - 1U ) ) == 0U, "CAOD_RemoteFreeReclaimInterval must be a power of two" );
+    static_assert( ( CAOD_FlushTimeBudgetCheckInterval & ( CAOD_FlushTimeBudgetCheckInterval - 1U ) ) == 0U, "CAOD_FlushTimeBudgetCheckInterval must be a power of two" );
+    static_assert( 0U < CAOD_MaxFlushContinuationsPerTick );
+    static_assert( false == CAOD_EnableWorkerAffinity || true == CAOD_EnableExtendedObjects, "CAOD_EnableWorkerAffinity requires CAOD_EnableExtendedObjects" );
+
     /*------------------------------------------------------------
         Measurements
       ------------------------------------------------------------*/
@@ -1418,6 +1418,12 @@ namespace ASD
             return Pointer == nullptr;                                                                                                                                                              \
         }                                                                                                                                                                                           \
                                                                                                                                                                                                     \
+        /*Get the body of the stored functor, the caller must know the stored functor type*/                                                                                                        \
+        ASD_FORCEINLINE void* GetBody() const NOEXCEPT_VALUE                                                                                                                                        \
+        {                                                                                                                                                                                           \
+            return BodyBuffer;                                                                                                                                                                      \
+        }                                                                                                                                                                                           \
+                                                                                                                                                                                                    \
         ASD_FORCEINLINE constexpr bool IsTrivial() const NOEXCEPT_VALUE                                                                                                                             \
         {                                                                                                                                                                                           \
             if constexpr ( true == bStrict )                                                                                                                                                        \
@@ -23,6 +23,12 @@
     #define SKL_IFMEMORYSTATS( expr ) 
 #endif
 
+#if defined(SKL_MEMORY_SITE_PROFILER)
+    #define SKL_IFMEMORYSITEPROFILER( expr ) expr
+#else
+    #define SKL_IFMEMORYSITEPROFILER( expr ) 
+#endif
+
 #if defined(SKL_GUARD_ALLOC_SIZE)
     #define SKL_IF_ALLOC_SIZE_GUARDED( expr ) expr
     #define SKL_GUARD_ALLOC_SIZE_ON 1
@@ -135,3 +135,13 @@ namespace SKL
 #else   
     #define SKL_FUNCTION_SIG "#FuncSig Not Supported#"
 #endif
+
+//! Return address of the current (non inlined) function, used to identify call sites
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #define SKL_RETURN_ADDRESS() _ReturnAddress()
+#elif defined(__clang__) || defined(__GNUC__)
+    #define SKL_RETURN_ADDRESS() __builtin_return_address( 0 )
+#else
+    #define SKL_RETURN_ADDRESS() nullptr
+#endif
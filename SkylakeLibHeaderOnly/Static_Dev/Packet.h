@@ -55,6 +55,32 @@ namespace SKL
     static_assert( CPacketMaximumSize > CPacketHeaderSize );
     static_assert( CPacketMaximumSize > CPacketMaximumUsableUserPacketSize );
 
+    constexpr TPacketSize CPacketBufferPaddingSize      = 12U;                                             //!< Bytes before the packet header in the AsyncNetBuffer [routing/broadcast header]
+    constexpr TPacketSize CPacketBufferOverheadSize     = 128U;                                            //!< Bytes of the memory block reserved for the AsyncNetBuffer header and the shared control block
+    constexpr size_t      CPacketBufferBlockSizes[]     = { 512U, 2048U, 15552U };                         //!< Memory blocks targeted by the size classes [MemoryManager Pool3 and size classes, asserted in AsyncIOBuffer.h]
+    constexpr TPacketSize CPacketBufferSizeClasses[]    = { static_cast<TPacketSize>( CPacketBufferBlockSizes[0] - CPacketBufferOverheadSize )
+                                                          , static_cast<TPacketSize>( CPacketBufferBlockSizes[1] - CPacketBufferOverheadSize )
+                                                          , static_cast<TPacketSize>( CPacketBufferBlockSizes[2] - CPacketBufferOverheadSize )
+                                                          , CPacketMaximumSize };                          //!< Total sizes of the AsyncNetBuffer size classes [ascending]
+    constexpr uint32_t    CPacketBufferSizeClassesCount = static_cast<uint32_t>( sizeof( CPacketBufferSizeClasses ) / sizeof( TPacketSize ) );
+    constexpr uint32_t    CPacketBufferMaxSizeClass     = CPacketBufferSizeClassesCount - 1U;
+    static_assert( CPacketMaximumSize == CPacketBufferSizeClasses[CPacketBufferMaxSizeClass] );
+    static_assert( CPacketBufferMaxSizeClass == static_cast<uint32_t>( sizeof( CPacketBufferBlockSizes ) / sizeof( size_t ) ), "Each size class, except the max one, must target a memory block" );
+
+    //! Get the index of the smallest AsyncNetBuffer size class that can hold a packet of InPacketSize bytes [header included]
+    constexpr uint32_t GetPacketBufferSizeClass( uint32_t InPacketSize ) noexcept
+    {
+        for( uint32_t i = 0; i < CPacketBufferMaxSizeClass; ++i )
+        {
+            if( InPacketSize + CPacketBufferPaddingSize <= static_cast<uint32_t>( CPacketBufferSizeClasses[i] ) )
+            {
+                return i;
+            }
+        }
+
+        return CPacketBufferMaxSizeClass;
+    }
+
     struct PacketArrayHeader
     {
         TPacketSize   Count { 0 }; //!< Count of item in the array
@@ -154,6 +154,12 @@ namespace SKL
 
             //return RFail;
         }
+
+        //! Get the index of the smallest AsyncNetBuffer size class that can hold this packet [see CPacketBufferSizeClasses]
+        SKL_FORCEINLINE SKL_NODISCARD constexpr uint32_t GetBufferSizeClass() const noexcept
+        {
+            return GetPacketBufferSizeClass( CalculatedNeededSize() );
+        }
     
     protected:
         SKL_FORCEINLINE static constexpr void WritePacketHeader( StreamBase& InStream ) noexcept
@@ -359,6 +365,12 @@ namespace SKL
                                       , PacketBuildContext_BuildFlags<EPacketContextFlags::WriteHeader, EPacketContextFlags::HeaderOnly>()>;
 
         HeaderOnlyPacketBuildContext() = delete;
+
+        //! Get the index of the smallest AsyncNetBuffer size class that can hold this packet [see CPacketBufferSizeClasses]
+        SKL_FORCEINLINE SKL_NODISCARD static constexpr uint32_t GetBufferSizeClass() noexcept
+        {
+            return GetPacketBufferSizeClass( CPacketHeaderSize );
+        }
         
         //! Is this packet broadcastable
         SKL_FORCEINLINE SKL_NODISCARD constexpr bool IsBroadcastable() const noexcept 
@@ -15,8 +15,9 @@ namespace SKL
 
     enum ERStatus : RStatusNumericType 
     {
-          RStatus_MIN = -12
+          RStatus_MIN = -13
 
+        , RStatus_Overloaded
         , RStatus_OperationOverflows
         , RStatus_AllocationFailed                    
         , RStatus_SystemTerminated                 
@@ -71,4 +72,5 @@ namespace SKL
     constexpr RStatus RNotSupported                   { RStatus_NotSupported };
     constexpr RStatus RServerInstanceFinalized        { RStatus_ServerInstanceFinalized };
     constexpr RStatus RPending                        { RStatus_Pending };
+    constexpr RStatus ROverloaded                     { RStatus_Overloaded };
 }
@@ -3,6 +3,7 @@ static_assert( sizeof( void* ) == 8, "64bit build Only!" );
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <map>
 #include <vector>
 #include <array>
 #include <cctype>
@@ -40,6 +41,8 @@ static_assert( sizeof( void* ) == 8, "64bit build Only!" );
 #include <latch>
 #include <bit>
 #include <span>
+#include <tuple>
+#include <algorithm>
 #include <cassert>
 
 namespace SKL
@@ -510,6 +510,455 @@ namespace AODTests
 #endif        
     }
 
+    TEST_F( AODStandaloneFixture, AODObjectSingleThread_DoAsyncBatch )
+    {
+        struct MyObject : SKL::AOD::SharedObject
+        {
+            MyObject() noexcept : SKL::AOD::SharedObject{ this } {}
+
+            int Values[8]{ 0 };
+            int Count    { 0 };
+        };
+        
+        auto obj = SKL::MakeShared<MyObject>();
+        ASSERT_TRUE( nullptr != obj.get() );
+#if defined(SKL_MEMORY_STATISTICS)
+        const auto TotalAllocationsBefore{ SKL::GlobalMemoryManager::TotalAllocations.load() };
+        const auto TotalDeallocationsBefore{ SKL::GlobalMemoryManager::TotalDeallocations.load() };
+#endif        
+
+        // no consumer present, the whole batch is dispatched in this call, in order
+        ASSERT_TRUE( SKL::RExecutedSync == obj->DoAsyncBatch( 
+            []( SKL::AOD::SharedObject& Obj ) noexcept -> void { auto& Self = Obj.GetParentObject<MyObject>(); Self.Values[Self.Count++] = 1; },
+            []( SKL::AOD::SharedObject& Obj ) noexcept -> void { auto& Self = Obj.GetParentObject<MyObject>(); Self.Values[Self.Count++] = 2; },
+            []( SKL::AOD::SharedObject& Obj ) noexcept -> void 
+            {
+                auto& Self = Obj.GetParentObject<MyObject>();
+                Self.Values[Self.Count++] = 3;
+
+                // consumer present, the batch is queued after this task
+                ASSERT_TRUE( SKL::RSuccess == Obj.DoAsyncBatch( 
+                    []( SKL::AOD::SharedObject& InnerObj ) noexcept -> void { auto& InnerSelf = InnerObj.GetParentObject<MyObject>(); InnerSelf.Values[InnerSelf.Count++] = 5; },
+                    []( SKL::AOD::SharedObject& InnerObj ) noexcept -> void { auto& InnerSelf = InnerObj.GetParentObject<MyObject>(); InnerSelf.Values[InnerSelf.Count++] = 6; }
+                ) );
+
+                Self.Values[Self.Count++] = 4;
+            }
+        ) );
+
+        ASSERT_EQ( 6, obj->Count );
+        for( int i = 0; i < 6; ++i )
+        {
+            ASSERT_EQ( i + 1, obj->Values[i] );
+        }
+
+        SKL::AODTLSContext::Destroy();
+
+#if defined(SKL_MEMORY_STATISTICS)
+        const auto TotalAllocationsAfter{ SKL::GlobalMemoryManager::TotalAllocations.load() };
+        const auto TotalDeallocationsAfter{ SKL::GlobalMemoryManager::TotalDeallocations.load() };
+        ASSERT_TRUE( TotalAllocationsBefore + 5 == TotalAllocationsAfter );
+        ASSERT_TRUE( TotalDeallocationsBefore + 5 == TotalDeallocationsAfter );
+#endif        
+    }
+
+    TEST_F( AODStandaloneFixture, AODObjectSingleThread_DoAsyncOnAll )
+    {
+        struct MyObject : SKL::AOD::SharedObject
+        {
+            MyObject() noexcept : SKL::AOD::SharedObject{ this } {}
+
+            int Value{ 0 };
+        };
+        
+        auto objA = SKL::MakeShared<MyObject>();
+        auto objB = SKL::MakeShared<MyObject>();
+        auto objC = SKL::MakeShared<MyObject>();
+        ASSERT_TRUE( nullptr != objA.get() );
+        ASSERT_TRUE( nullptr != objB.get() );
+        ASSERT_TRUE( nullptr != objC.get() );
+
+        objA->Value = 10;
+
+        // no consumer present on any object, the functor is dispatched in this call, objects in the given order
+        ASSERT_TRUE( SKL::RExecutedSync == SKL::AOD::DoAsyncOnAll( *objA, *objB, *objC, []( SKL::AOD::SharedObject& A, SKL::AOD::SharedObject& B, SKL::AOD::SharedObject& C ) noexcept -> void 
+        {
+            A.GetParentObject<MyObject>().Value -= 3;
+            B.GetParentObject<MyObject>().Value += 2;
+            C.GetParentObject<MyObject>().Value += 1;
+        } ) );
+
+        ASSERT_EQ( 7, objA->Value );
+        ASSERT_EQ( 2, objB->Value );
+        ASSERT_EQ( 1, objC->Value );
+
+        // all objects were released
+        ASSERT_TRUE( SKL::RExecutedSync == objA->DoAsync( []( SKL::AOD::SharedObject& Obj ) noexcept -> void { ++Obj.GetParentObject<MyObject>().Value; } ) );
+        ASSERT_TRUE( SKL::RExecutedSync == objB->DoAsync( []( SKL::AOD::SharedObject& Obj ) noexcept -> void { ++Obj.GetParentObject<MyObject>().Value; } ) );
+        ASSERT_TRUE( SKL::RExecutedSync == objC->DoAsync( []( SKL::AOD::SharedObject& Obj ) noexcept -> void { ++Obj.GetParentObject<MyObject>().Value; } ) );
+        ASSERT_EQ( 8, objA->Value );
+        ASSERT_EQ( 3, objB->Value );
+        ASSERT_EQ( 2, objC->Value );
+
+        // the same object can't be acquired twice
+        ASSERT_TRUE( SKL::RInvalidParamters == SKL::AOD::DoAsyncOnAll( *objA, *objA, []( SKL::AOD::SharedObject&, SKL::AOD::SharedObject& ) noexcept -> void {} ) );
+
+        // object B is busy, the functor is dispatched only after the current task on B
+        bool bHasExecuted{ false };
+        ASSERT_TRUE( SKL::RExecutedSync == objB->DoAsync( [ PtrA = objA.get(), &bHasExecuted ]( SKL::AOD::SharedObject& Obj ) noexcept -> void 
+        {
+            ASSERT_TRUE( SKL::RSuccess == SKL::AOD::DoAsyncOnAll( *PtrA, Obj, [ &bHasExecuted ]( SKL::AOD::SharedObject& A, SKL::AOD::SharedObject& B ) noexcept -> void
+            {
+                ASSERT_EQ( 100, B.GetParentObject<MyObject>().Value );
+                A.GetParentObject<MyObject>().Value = 100;
+                bHasExecuted = true;
+            } ) );
+
+            ASSERT_FALSE( bHasExecuted );
+            Obj.GetParentObject<MyObject>().Value = 100;
+        } ) );
+
+        ASSERT_TRUE( bHasExecuted );
+        ASSERT_EQ( 100, objA->Value );
+        ASSERT_EQ( 100, objB->Value );
+
+        // object A is busy and at its max pending tasks count, nothing is queued on any object
+        if constexpr( true == SKL::CAOD_EnableExtendedObjects )
+        {
+            objA->SetMaxPendingTasks( 1U );
+            const uint64_t OverloadsBefore{ SKL::AOD::Object::GetOverloadsCount() };
+            ASSERT_TRUE( SKL::RExecutedSync == objA->DoAsync( [ PtrC = objC.get() ]( SKL::AOD::SharedObject& Obj ) noexcept -> void 
+            {
+                ASSERT_TRUE( SKL::ROverloaded == SKL::AOD::DoAsyncOnAll( Obj, *PtrC, []( SKL::AOD::SharedObject&, SKL::AOD::SharedObject& ) noexcept -> void {} ) );
+                ASSERT_EQ( 0U, PtrC->GetPendingTasksCount() );
+            } ) );
+            ASSERT_EQ( OverloadsBefore + 1U, SKL::AOD::Object::GetOverloadsCount() );
+            objA->SetMaxPendingTasks( 0U );
+        }
+    }
+
+    TEST_F( AODStandaloneFixture, AODObjectSingleThread_DoAsyncFuture )
+    {
+        struct MyObject : SKL::AOD::SharedObject
+        {
+            MyObject() noexcept : SKL::AOD::SharedObject{ this } {}
+
+            int Value{ 0 };
+        };
+        
+        auto objA = SKL::MakeShared<MyObject>();
+        auto objB = SKL::MakeShared<MyObject>();
+        ASSERT_TRUE( nullptr != objA.get() );
+        ASSERT_TRUE( nullptr != objB.get() );
+
+        objA->Value = 21;
+
+        // A -> B -> A, no consumer present on any object, the whole chain is dispatched in this call
+        int Result{ 0 };
+        ASSERT_TRUE( SKL::RExecutedSync == SKL::AOD::DoAsyncFuture( *objA, []( SKL::AOD::SharedObject& A ) noexcept -> int 
+        {
+            return A.GetParentObject<MyObject>().Value;
+        } ).Then( *objB, []( SKL::AOD::SharedObject& B, int InValue ) noexcept -> int
+        {
+            B.GetParentObject<MyObject>().Value = InValue * 2;
+            return InValue * 2;
+        } ).Then( *objA, [ &Result ]( SKL::AOD::SharedObject& A, int InValue ) noexcept -> void
+        {
+            A.GetParentObject<MyObject>().Value = InValue + 1;
+            Result = InValue;
+        } ) );
+
+        ASSERT_EQ( 42, Result );
+        ASSERT_EQ( 43, objA->Value );
+        ASSERT_EQ( 42, objB->Value );
+
+        // move only results are moved from task to task
+        bool bHasExecuted{ false };
+        ASSERT_TRUE( SKL::RExecutedSync == SKL::AOD::DoAsyncFuture( *objB, []( SKL::AOD::SharedObject& ) noexcept -> std::unique_ptr<int> 
+        {
+            return std::make_unique<int>( 5 );
+        } ).Then( *objA, [ &bHasExecuted ]( SKL::AOD::SharedObject&, std::unique_ptr<int>&& InValue ) noexcept -> void
+        {
+            ASSERT_TRUE( nullptr != InValue );
+            ASSERT_EQ( 5, *InValue );
+            bHasExecuted = true;
+        } ) );
+        ASSERT_TRUE( bHasExecuted );
+
+        // nothing is dispatched until the chain is completed, dispatched or destroyed
+        {
+            auto PendingFuture{ SKL::AOD::DoAsyncFuture( *objA, []( SKL::AOD::SharedObject& A ) noexcept -> int 
+            {
+                return ++A.GetParentObject<MyObject>().Value;
+            } ) };
+            ASSERT_TRUE( PendingFuture.IsValid() );
+            ASSERT_EQ( 43, objA->Value );
+        }
+        ASSERT_EQ( 44, objA->Value );
+
+        // the continuation runs after the current task of its (busy) target object
+        Result = 0;
+        ASSERT_TRUE( SKL::RExecutedSync == objB->DoAsync( [ PtrA = objA.get(), &Result ]( SKL::AOD::SharedObject& B ) noexcept -> void 
+        {
+            auto ChainResult{ SKL::AOD::DoAsyncFuture( *PtrA, []( SKL::AOD::SharedObject& A ) noexcept -> int 
+            {
+                return A.GetParentObject<MyObject>().Value;
+            } ).Then( B, [ &Result ]( SKL::AOD::SharedObject&, int InValue ) noexcept -> void
+            {
+                Result = InValue;
+            } ) };
+            ASSERT_TRUE( SKL::RExecutedSync == ChainResult );
+            ASSERT_EQ( 0, Result );
+        } ) );
+        ASSERT_EQ( 44, Result );
+
+        // a released chain is never dispatched
+        {
+            auto ReleasedFuture{ SKL::AOD::DoAsyncFuture( *objA, []( SKL::AOD::SharedObject& A ) noexcept -> int 
+            {
+                return ++A.GetParentObject<MyObject>().Value;
+            } ).Then( *objB, []( SKL::AOD::SharedObject& B, int InValue ) noexcept -> int
+            {
+                return B.GetParentObject<MyObject>().Value = InValue;
+            } ) };
+            ASSERT_TRUE( ReleasedFuture.IsValid() );
+
+            ReleasedFuture.Release();
+            ASSERT_FALSE( ReleasedFuture.IsValid() );
+            ASSERT_TRUE( SKL::RFail == ReleasedFuture.Dispatch() );
+        }
+        ASSERT_EQ( 44, objA->Value );
+        ASSERT_EQ( 42, objB->Value );
+    }
+
+    TEST_F( AODStandaloneFixture, AODObjectSingleThread_DoAsyncFuture_DroppedStepReleasesChain )
+    {
+        struct MyObject : SKL::AOD::SharedObject
+        {
+            MyObject() noexcept : SKL::AOD::SharedObject{ this } {}
+        };
+
+        struct DestroyTracker
+        {
+            DestroyTracker( int32_t* InDestroyedCount ) noexcept : DestroyedCount{ InDestroyedCount } {}
+            DestroyTracker( DestroyTracker&& Other ) noexcept : DestroyedCount{ std::exchange( Other.DestroyedCount, nullptr ) } {}
+            ~DestroyTracker() noexcept
+            {
+                if( nullptr != DestroyedCount )
+                {
+                    ++( *DestroyedCount );
+                }
+            }
+
+            int32_t* DestroyedCount;
+        };
+
+        using TObject = SKL::AOD::SharedObject;
+
+        auto obj = SKL::MakeShared<MyObject>();
+        ASSERT_TRUE( nullptr != obj.get() );
+
+        int32_t DestroyedCount{ 0 };
+        bool    bHasExecuted  { false };
+
+        auto FirstFunctor{ [ Tracker = DestroyTracker{ &DestroyedCount }, &bHasExecuted ]( TObject& ) noexcept -> int32_t { bHasExecuted = true; return 1; } };
+        auto LastFunctor { [ Tracker = DestroyTracker{ &DestroyedCount }, &bHasExecuted ]( TObject&, int32_t ) noexcept -> void { bHasExecuted = true; } };
+
+        using TFirstStep = SKL::AOD::FutureStep<TObject, decltype( FirstFunctor ), void, int32_t>;
+        using TLastStep  = SKL::AOD::FutureStep<TObject, decltype( LastFunctor ), int32_t, void>;
+
+        auto* LastTask{ SKL::AOD::FutureDispatch::AllocateStep( static_cast<TObject*>( obj.get() ), TLastStep{ std::move( LastFunctor ), {}, {} } ) };
+        ASSERT_TRUE( nullptr != LastTask );
+
+        auto* FirstTask{ SKL::AOD::FutureDispatch::AllocateStep( static_cast<TObject*>( obj.get() ), TFirstStep{ std::move( FirstFunctor ), {}, {} } ) };
+        ASSERT_TRUE( nullptr != FirstTask );
+
+        auto& Link{ FirstTask->GetFunctor<TFirstStep>().Link };
+        Link.NextTask    = static_cast<SKL::IAODSharedObjectTask*>( LastTask );
+        Link.ResumeNext  = &SKL::AOD::FutureDispatch::ResumeStep<TObject, TLastStep>;
+        Link.ReleaseNext = &SKL::AOD::FutureDispatch::ReleaseStep<TObject, TLastStep>;
+
+        // the first step is dropped without being dispatched [eg. by Worker::Clear()], the rest of the chain must be released with it
+        SKL::ReleaseAODTask( static_cast<SKL::IAODSharedObjectTask*>( FirstTask ) );
+
+        ASSERT_FALSE( bHasExecuted );
+        ASSERT_EQ( 2, DestroyedCount );
+        ASSERT_EQ( 1U, obj.use_count() );
+    }
+
+    TEST_F( AODStandaloneFixture, AODObjectSingleThread_DoAsyncRead )
+    {
+        struct MyObject : SKL::AOD::SharedObject
+        {
+            MyObject() noexcept : SKL::AOD::SharedObject{ this } {}
+
+            int Value{ 0 };
+        };
+        
+        auto objA = SKL::MakeShared<MyObject>();
+        ASSERT_TRUE( nullptr != objA.get() );
+
+        objA->Value = 5;
+
+        // idle object, the read is executed in this call
+        int ReadValue{ 0 };
+        ASSERT_TRUE( SKL::RExecutedSync == objA->DoAsyncRead( [ &ReadValue ]( const SKL::AOD::SharedObject& Obj ) noexcept -> void 
+        {
+            ReadValue = Obj.GetParentObject<MyObject>().Value;
+        } ) );
+        ASSERT_EQ( 5, ReadValue );
+
+        // a write issued during a read is parked until the read ends, then it is executed by the (last) reader thread
+        const uint64_t ParkedConsumersBefore{ SKL::AOD::Object::GetParkedConsumersCount() };
+        bool bHasWritten{ false };
+        ASSERT_TRUE( SKL::RExecutedSync == objA->DoAsyncRead( [ PtrA = objA.get(), &bHasWritten ]( const SKL::AOD::SharedObject& Obj ) noexcept -> void 
+        {
+            ASSERT_TRUE( SKL::RSuccess == PtrA->DoAsync( [ &bHasWritten ]( SKL::AOD::SharedObject& InObj ) noexcept -> void
+            {
+                InObj.GetParentObject<MyObject>().Value = 6;
+                bHasWritten = true;
+            } ) );
+
+            ASSERT_FALSE( bHasWritten );
+            ASSERT_EQ( 5, Obj.GetParentObject<MyObject>().Value );
+        } ) );
+        ASSERT_TRUE( bHasWritten );
+        ASSERT_EQ( 6, objA->Value );
+        ASSERT_EQ( ParkedConsumersBefore + 1U, SKL::AOD::Object::GetParkedConsumersCount() );
+
+        // a read issued while a task is pending on the object is queued after it
+        ReadValue = 0;
+        ASSERT_TRUE( SKL::RExecutedSync == objA->DoAsync( [ PtrA = objA.get(), &ReadValue ]( SKL::AOD::SharedObject& Obj ) noexcept -> void 
+        {
+            ASSERT_TRUE( SKL::RSuccess == PtrA->DoAsyncRead( [ &ReadValue ]( const SKL::AOD::SharedObject& InObj ) noexcept -> void
+            {
+                ReadValue = InObj.GetParentObject<MyObject>().Value;
+            } ) );
+
+            ASSERT_EQ( 0, ReadValue );
+            Obj.GetParentObject<MyObject>().Value = 7;
+        } ) );
+        ASSERT_EQ( 7, ReadValue );
+
+        // the object is idle again
+        ASSERT_TRUE( SKL::RExecutedSync == objA->DoAsync( []( SKL::AOD::SharedObject& Obj ) noexcept -> void { ++Obj.GetParentObject<MyObject>().Value; } ) );
+        ASSERT_EQ( 8, objA->Value );
+    }
+
+    TEST_F( AODStandaloneFixture, AODObjectSingleThread_MaxPendingTasks )
+    {
+        if constexpr( false == SKL::CAOD_EnableExtendedObjects )
+        {
+            GTEST_SKIP() << "CAOD_EnableExtendedObjects is false";
+        }
+
+        struct MyObject : SKL::AOD::SharedObject
+        {
+            MyObject() noexcept : SKL::AOD::SharedObject{ this } {}
+
+            int Value{ 0 };
+        };
+        
+        auto objA = SKL::MakeShared<MyObject>();
+        ASSERT_TRUE( nullptr != objA.get() );
+        ASSERT_EQ( 0U, objA->GetMaxPendingTasks() );
+
+        objA->SetMaxPendingTasks( 3U );
+        ASSERT_EQ( 3U, objA->GetMaxPendingTasks() );
+
+        const uint64_t OverloadsBefore{ SKL::AOD::Object::GetOverloadsCount() };
+
+        #if defined(SKL_KPI_QUEUE_SIZES)
+        SKL::KPIContext::Create();
+        ASSERT_EQ( 0U, SKL::KPIContext::Static_GetAODObjectOverloadsCount() );
+        #endif
+
+        // the current task counts as pending, 2 more tasks can be queued
+        ASSERT_TRUE( SKL::RExecutedSync == objA->DoAsync( [ PtrA = objA.get() ]( SKL::AOD::SharedObject& Obj ) noexcept -> void 
+        {
+            ASSERT_EQ( 1U, PtrA->GetPendingTasksCount() );
+
+            ASSERT_TRUE( SKL::ROverloaded == PtrA->DoAsyncBatch( []( SKL::AOD::SharedObject& InObj ) noexcept -> void { ++InObj.GetParentObject<MyObject>().Value; }, []( SKL::AOD::SharedObject& InObj ) noexcept -> void { ++InObj.GetParentObject<MyObject>().Value; }, []( SKL::AOD::SharedObject& InObj ) noexcept -> void { ++InObj.GetParentObject<MyObject>().Value; } ) );
+            ASSERT_TRUE( SKL::RSuccess == PtrA->DoAsync( []( SKL::AOD::SharedObject& InObj ) noexcept -> void { ++InObj.GetParentObject<MyObject>().Value; } ) );
+            ASSERT_TRUE( SKL::RSuccess == PtrA->DoAsync( []( SKL::AOD::SharedObject& InObj ) noexcept -> void { ++InObj.GetParentObject<MyObject>().Value; } ) );
+            ASSERT_EQ( 3U, PtrA->GetPendingTasksCount() );
+
+            const SKL::RStatus Result{ PtrA->DoAsync( []( SKL::AOD::SharedObject& InObj ) noexcept -> void { ++InObj.GetParentObject<MyObject>().Value; } ) };
+            ASSERT_TRUE( SKL::ROverloaded == Result );
+            ASSERT_TRUE( SKL::DoAsyncHasFailed( Result ) );
+            ASSERT_TRUE( SKL::ROverloaded == PtrA->DoAsyncRead( []( const SKL::AOD::SharedObject& ) noexcept -> void {} ) );
+
+            Obj.GetParentObject<MyObject>().Value = 10;
+        } ) );
+
+        ASSERT_EQ( 12, objA->Value );
+        ASSERT_EQ( 0U, objA->GetPendingTasksCount() );
+        ASSERT_EQ( OverloadsBefore + 3U, SKL::AOD::Object::GetOverloadsCount() );
+
+        // no limit
+        objA->SetMaxPendingTasks( 0U );
+        ASSERT_TRUE( SKL::RExecutedSync == objA->DoAsync( [ PtrA = objA.get() ]( SKL::AOD::SharedObject& ) noexcept -> void 
+        {
+            for( int i = 0; i < 8; ++i )
+            {
+                ASSERT_TRUE( SKL::RSuccess == PtrA->DoAsync( []( SKL::AOD::SharedObject& InObj ) noexcept -> void { ++InObj.GetParentObject<MyObject>().Value; } ) );
+            }
+        } ) );
+        ASSERT_EQ( 20, objA->Value );
+        ASSERT_EQ( OverloadsBefore + 3U, SKL::AOD::Object::GetOverloadsCount() );
+
+        #if defined(SKL_KPI_QUEUE_SIZES)
+        ASSERT_EQ( 3U, SKL::KPIContext::Static_GetAODObjectOverloadsCount() );
+        SKL::KPIContext::Destroy();
+        #endif
+    }
+
+    TEST_F( AODStandaloneFixture, AODTask_FreedOnOtherThreads_ReclaimedByOwner )
+    {
+        constexpr size_t BlocksCount{ 256 };
+
+        ( void )SKL::ThreadLocalMemoryManager::ReclaimRemoteFreed();
+
+        SKL::ThreadLocalRemoteFreeList* Owner{ SKL::ThreadLocalMemoryManager::GetOwnerTag() };
+        ASSERT_TRUE( nullptr != Owner );
+
+        std::vector<void*> Blocks{};
+        Blocks.reserve( BlocksCount );
+
+        for( size_t i = 0; i < BlocksCount; ++i )
+        {
+            auto* Task{ SKL::TLSMakeSharedRaw<SKL::AODStaticObjectTask<8>>() };
+            ASSERT_TRUE( nullptr != Task );
+
+            Task->SetOwner( Owner );
+            Task->SetDispatch( []() noexcept -> void {} );
+            ASSERT_TRUE( Owner == Task->GetOwner() );
+
+            Blocks.push_back( SKL::MemoryPolicy::SharedMemoryPolicy<false>::DestroyForObject<SKL::IAODStaticObjectTask>( Task ) );
+            ASSERT_TRUE( nullptr != Blocks.back() );
+        }
+
+        const auto FreeBlocks{ [&Blocks, Owner]( size_t InBegin, size_t InEnd ) noexcept -> void
+        {
+            for( size_t i = InBegin; i < InEnd; ++i )
+            {
+                const auto* CBlock{ reinterpret_cast<const SKL::MemoryPolicy::ControlBlock*>( Blocks[i] ) };
+                SKL::ThreadLocalMemoryManager::DeallocateFromAnyThread( Owner, Blocks[i], static_cast<size_t>( CBlock->BlockSize ) );
+            }
+        } };
+
+        // free half the blocks on each of two foreign threads
+        std::jthread FreeThreadA{ [&FreeBlocks]() noexcept -> void { FreeBlocks( 0U, BlocksCount / 2 ); } };
+        std::jthread FreeThreadB{ [&FreeBlocks]() noexcept -> void { FreeBlocks( BlocksCount / 2, BlocksCount ); } };
+        FreeThreadA.join();
+        FreeThreadB.join();
+
+        ASSERT_FALSE( Owner->IsEmpty() );
+        ASSERT_EQ( BlocksCount, SKL::ThreadLocalMemoryManager::ReclaimRemoteFreed() );
+        ASSERT_TRUE( Owner->IsEmpty() );
+        ASSERT_EQ( 0U, SKL::ThreadLocalMemoryManager::ReclaimRemoteFreed() );
+    }
+
     TEST_F( AODTestsFixture, AODObjectMultipleSymetricWorkers )
     {
         struct MyObject : SKL::AOD::SharedObject
@@ -707,6 +1156,418 @@ namespace AODTests
 #endif        
     }
 
+    TEST_F( AODTestsFixture, AODObjectFlushBudget_HandOffToOtherWorker )
+    {
+        if constexpr( 0U == SKL::CAOD_FlushTaskBudget )
+        {
+            GTEST_SKIP() << "CAOD_FlushTaskBudget is 0 (unbounded flush)";
+        }
+
+        struct MyObject : SKL::AOD::SharedObject
+        {
+            MyObject() noexcept : SKL::AOD::SharedObject{ this } {}
+            std::relaxed_value<uint64_t> Counter{ 0U };
+        };
+        
+        auto obj = SKL::MakeShared<MyObject>();
+        ASSERT_TRUE( nullptr != obj.get() );
+
+        // more tasks than the flush budget, all queued while the first one is being dispatched
+        constexpr uint64_t TasksCount{ static_cast<uint64_t>( SKL::CAOD_FlushTaskBudget ) * 4U };
+
+        const uint64_t BudgetHitsBefore    { SKL::AOD::SharedObject::GetFlushBudgetHitsCount() };
+        const uint64_t TypeBudgetHitsBefore{ SKL::AOD::Object::GetTypeFlushBudgetHitsCount<MyObject>() };
+        bool           bHasCreatedTask     { false };
+
+        auto OnTick = [ Ptr = obj.get(), &bHasCreatedTask ]( SKL::Worker& InWorker, SKL::WorkerGroup& InGroup ) mutable noexcept -> void
+        {
+            if( true == InWorker.IsMaster() && false == bHasCreatedTask )
+            {
+                bHasCreatedTask = true;
+
+                ASSERT_TRUE( SKL::RExecutedSync == Ptr->DoAsync( []( SKL::AOD::SharedObject& InObject ) noexcept -> void 
+                {
+                    for( uint64_t i = 0; i < TasksCount; ++i )
+                    {
+                        ( void )InObject.DoAsync( []( SKL::AOD::SharedObject& InSelf ) noexcept -> void 
+                        {
+                            ( void )++reinterpret_cast<MyObject&>( InSelf ).Counter;
+                        } );
+                    }
+                } ) );
+            }       
+
+            if( TasksCount == Ptr->Counter.load_relaxed() )
+            {
+                InGroup.GetServerInstance()->SignalToStop( true );
+            }
+        };
+        
+        SKL::WorkerGroupTag Tag{
+            .TickRate                        = 60, 
+            .SyncTLSTickRate                 = 0,
+            .Id                              = 1,
+            .WorkersCount                    = 4,
+            .bPreallocateAllThreadLocalPools = false,
+            .bSupportesTCPAsyncAcceptors     = false,
+            .Name                            = L"AODOBJECTFLUSHBUDGET_GROUP"
+        };
+        Tag.bIsActive          = true;
+        Tag.bEnableAsyncIO     = false;
+        Tag.bSupportsAOD       = true;
+        Tag.bHandlesTimerTasks = true;
+        Tag.bCallTickHandler   = true;
+
+        ASSERT_TRUE( true == AddNewWorkerGroup( Tag, std::move( OnTick ) ) );
+
+        ASSERT_TRUE( true == Start( true ) );
+
+        JoinAllGroups();
+        ASSERT_TRUE( TasksCount == obj->Counter.load_relaxed() );
+        ASSERT_TRUE( BudgetHitsBefore < SKL::AOD::SharedObject::GetFlushBudgetHitsCount() );
+        if constexpr( true == SKL::CAOD_EnableExtendedObjects )
+        {
+            ASSERT_TRUE( TypeBudgetHitsBefore < SKL::AOD::Object::GetTypeFlushBudgetHitsCount<MyObject>() );
+        }
+    }
+
+    TEST_F( AODTestsFixture, AODObjectWorkerAffinity_DelayedTasksRunOnPreferredWorker )
+    {
+        if constexpr( false == SKL::CAOD_EnableWorkerAffinity )
+        {
+            GTEST_SKIP() << "CAOD_EnableWorkerAffinity is false";
+        }
+
+        struct MyObject : SKL::AOD::SharedObject
+        {
+            MyObject() noexcept : SKL::AOD::SharedObject{ this } {}
+
+            uint64_t Payload[512]{ 0U };
+        };
+
+        constexpr uint16_t CWorkersCount       { 4U };
+        constexpr size_t   CObjectsCount       { 16U };
+        constexpr uint64_t CTasksPerObjectCount{ 64U };
+        constexpr uint64_t CTasksCount         { CObjectsCount * CTasksPerObjectCount };
+
+        std::vector<SKL::TSharedPtr<MyObject>> Objects{};
+        SKL::TSharedPtr<MyObject>              LearningObject{};
+        std::relaxed_value<uint64_t>           DispatchedCount{ 0U };
+        std::relaxed_value<uint64_t>           OnPreferredWorkerCount{ 0U };
+        bool                                   bHasCreatedTasks{ false };
+        const uint64_t                         OverloadsBefore{ SKL::AOD::Object::GetWorkerAffinityOverloadsCount() };
+
+        auto OnTick = [ & ]( SKL::Worker& InWorker, SKL::WorkerGroup& InGroup ) mutable noexcept -> void
+        {
+            if( true == InWorker.IsMaster() && false == bHasCreatedTasks )
+            {
+                bHasCreatedTasks = true;
+
+                // the preferred worker is learned from the consumer
+                LearningObject = SKL::MakeShared<MyObject>();
+                ASSERT_TRUE( SKL::RExecutedSync == LearningObject->DoAsync( []( SKL::AOD::SharedObject& /*InObject*/ ) noexcept -> void {} ) );
+                ASSERT_EQ( InWorker.GetAffinityId(), LearningObject->GetPreferredWorkerId() );
+
+                // spread the objects over all the workers
+                auto& Workers{ InGroup.GetWorkers() };
+                for( size_t i = 0; i < CObjectsCount; ++i )
+                {
+                    auto Object{ SKL::MakeShared<MyObject>() };
+                    ASSERT_TRUE( nullptr != Object.get() );
+                    Object->SetPreferredWorker( Workers[1U + ( i % CWorkersCount )].get() );
+
+                    for( uint64_t j = 0; j < CTasksPerObjectCount; ++j )
+                    {
+                        ASSERT_TRUE( SKL::RSuccess == Object->DoAsyncAfter( 0, [ &DispatchedCount, &OnPreferredWorkerCount ]( SKL::AOD::SharedObject& InObject ) noexcept -> void 
+                        {
+                            auto& Self{ InObject.GetParentObject<MyObject>() };
+                            for( auto& Value : Self.Payload )
+                            {
+                                ++Value;
+                            }
+
+                            if( SKL::AODTLSContext::GetInstance()->WorkerAffinityId == InObject.GetPreferredWorkerId() )
+                            {
+                                ( void )++OnPreferredWorkerCount;
+                            }
+
+                            ( void )++DispatchedCount;
+                        } ) );
+                    }
+
+                    Objects.push_back( std::move( Object ) );
+                }
+            }
+
+            if( CTasksCount == DispatchedCount.load_relaxed() )
+            {
+                InGroup.GetServerInstance()->SignalToStop( true );
+            }
+        };
+
+        SKL::WorkerGroupTag Tag{
+            .TickRate                        = 60, 
+            .SyncTLSTickRate                 = 0,
+            .Id                              = 1,
+            .WorkersCount                    = CWorkersCount,
+            .bPreallocateAllThreadLocalPools = false,
+            .bSupportesTCPAsyncAcceptors     = false,
+            .Name                            = L"AODWORKERAFFINITY_GROUP"
+        };
+        Tag.bIsActive          = true;
+        Tag.bEnableAsyncIO     = false;
+        Tag.bSupportsAOD       = true;
+        Tag.bHandlesTimerTasks = true;
+        Tag.bCallTickHandler   = true;
+
+        ASSERT_TRUE( true == AddNewWorkerGroup( Tag, std::move( OnTick ) ) );
+
+        ASSERT_TRUE( true == Start( true ) );
+        JoinAllGroups();
+
+        printf( "[AOD Worker affinity] %llu/%llu delayed tasks dispatched on the preferred worker of their object\n"
+              , static_cast<unsigned long long>( OnPreferredWorkerCount.load_relaxed() ), static_cast<unsigned long long>( CTasksCount ) );
+
+        ASSERT_EQ( CTasksCount, DispatchedCount.load_relaxed() );
+        ASSERT_EQ( CTasksCount, OnPreferredWorkerCount.load_relaxed() );
+        ASSERT_EQ( OverloadsBefore, SKL::AOD::Object::GetWorkerAffinityOverloadsCount() );
+
+        for( auto& Object : Objects )
+        {
+            for( auto Value : Object->Payload )
+            {
+                ASSERT_EQ( CTasksPerObjectCount, Value );
+            }
+        }
+    }
+
+    //! Transfers between accounts issued concurrently by all workers, either through AOD::DoAsyncOnAll or through nested DoAsync callbacks (debit then credit)
+    template<bool bUseDoAsyncOnAll>
+    void RunTransfersContention( TestApplication& InApplication, const char* InName ) noexcept
+    {
+        struct MyAccount : SKL::AOD::SharedObject
+        {
+            MyAccount() noexcept : SKL::AOD::SharedObject{ this } {}
+
+            int64_t Balance{ 1000 };
+        };
+
+        constexpr uint32_t CWorkersCount  { 4U };
+        constexpr uint32_t CAccountsCount { 3U };
+        constexpr uint64_t CTransfersCount{ 200000U };
+        constexpr uint64_t CChunkSize     { CTransfersCount / CWorkersCount };
+
+        SKL::TSharedPtr<MyAccount> Accounts[CAccountsCount];
+        for( auto& Account : Accounts )
+        {
+            Account = SKL::MakeShared<MyAccount>();
+            ASSERT_TRUE( nullptr != Account.get() );
+        }
+
+        std::relaxed_value<uint64_t> Claimed  { 0U };
+        std::relaxed_value<uint64_t> Completed{ 0U };
+
+        auto OnTick = [ &Accounts, &Claimed, &Completed ]( SKL::Worker& /*InWorker*/, SKL::WorkerGroup& InGroup ) mutable noexcept -> void
+        {
+            const uint64_t ChunkStart{ Claimed.increment( CChunkSize ) };
+            for( uint64_t i = ChunkStart; i < CTransfersCount && i < ChunkStart + CChunkSize; ++i )
+            {
+                MyAccount* From{ Accounts[i % CAccountsCount].get() };
+                MyAccount* To  { Accounts[( i + 1U ) % CAccountsCount].get() };
+
+                if constexpr( bUseDoAsyncOnAll )
+                {
+                    ( void )SKL::AOD::DoAsyncOnAll( *From, *To, [ &Completed ]( SKL::AOD::SharedObject& InFrom, SKL::AOD::SharedObject& InTo ) noexcept -> void
+                    {
+                        --InFrom.GetParentObject<MyAccount>().Balance;
+                        ++InTo.GetParentObject<MyAccount>().Balance;
+                        ( void )++Completed;
+                    } );
+                }
+                else
+                {
+                    ( void )From->DoAsync( [ To, &Completed ]( SKL::AOD::SharedObject& InFrom ) noexcept -> void
+                    {
+                        --InFrom.GetParentObject<MyAccount>().Balance;
+
+                        ( void )To->DoAsync( [ &Completed ]( SKL::AOD::SharedObject& InTo ) noexcept -> void
+                        {
+                            ++InTo.GetParentObject<MyAccount>().Balance;
+                            ( void )++Completed;
+                        } );
+                    } );
+                }
+            }
+
+            if( CTransfersCount == Completed.load_relaxed() )
+            {
+                InGroup.GetServerInstance()->SignalToStop( true );
+            }
+        };
+
+        SKL::WorkerGroupTag Tag{
+            .TickRate                        = 60, 
+            .SyncTLSTickRate                 = 0,
+            .Id                              = 1,
+            .WorkersCount                    = CWorkersCount,
+            .bPreallocateAllThreadLocalPools = false,
+            .bSupportesTCPAsyncAcceptors     = false,
+            .Name                            = L"AODTRANSFERSCONTENTION_GROUP"
+        };
+        Tag.bIsActive          = true;
+        Tag.bEnableAsyncIO     = false;
+        Tag.bSupportsAOD       = true;
+        Tag.bHandlesTimerTasks = true;
+        Tag.bCallTickHandler   = true;
+
+        ASSERT_TRUE( true == InApplication.AddNewWorkerGroup( Tag, std::move( OnTick ) ) );
+
+        const auto StartedAt{ std::chrono::steady_clock::now() };
+
+        ASSERT_TRUE( true == InApplication.Start( true ) );
+        InApplication.JoinAllGroups();
+
+        const auto ElapsedUs{ std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - StartedAt ).count() };
+        printf( "[%s] %llu transfers on %u accounts from %u workers in %lld us\n", InName, static_cast<unsigned long long>( CTransfersCount ), CAccountsCount, CWorkersCount, static_cast<long long>( ElapsedUs ) );
+
+        ASSERT_EQ( CTransfersCount, Completed.load_relaxed() );
+
+        int64_t TotalBalance{ 0 };
+        for( auto& Account : Accounts )
+        {
+            TotalBalance += Account->Balance;
+        }
+        ASSERT_EQ( static_cast<int64_t>( CAccountsCount ) * 1000, TotalBalance );
+    }
+
+    TEST_F( AODTestsFixture, AODObjectDoAsyncOnAll_TransfersContention )
+    {
+        RunTransfersContention<true>( *this, "DoAsyncOnAll" );
+    }
+
+    TEST_F( AODTestsFixture, AODObjectNestedDoAsync_TransfersContention )
+    {
+        RunTransfersContention<false>( *this, "Nested DoAsync" );
+    }
+
+    TEST_F( AODTestsFixture, AODObjectDoAsyncRead_ReadersAndWriters )
+    {
+        struct MyIndex : SKL::AOD::SharedObject
+        {
+            MyIndex() noexcept : SKL::AOD::SharedObject{ this } {}
+
+            uint64_t First { 0U };
+            uint64_t Second{ 0U };
+        };
+
+        constexpr uint32_t CWorkersCount{ 4U };
+        constexpr uint64_t COpsCount    { 200000U };
+        constexpr uint64_t CChunkSize   { COpsCount / CWorkersCount };
+        constexpr uint64_t CWriteEvery  { 16U };
+
+        auto Index = SKL::MakeShared<MyIndex>();
+        ASSERT_TRUE( nullptr != Index.get() );
+
+        std::relaxed_value<uint64_t> Claimed         { 0U };
+        std::relaxed_value<uint64_t> Completed       { 0U };
+        std::relaxed_value<uint64_t> Writes          { 0U };
+        std::relaxed_value<uint64_t> TornReads       { 0U };
+        std::relaxed_value<uint64_t> Overlaps        { 0U };
+        std::relaxed_value<uint64_t> ActiveReaders   { 0U };
+        std::relaxed_value<uint64_t> ActiveWriters   { 0U };
+        std::relaxed_value<uint64_t> MaxActiveReaders{ 0U };
+
+        auto OnTick = [ &, IndexPtr = Index.get() ]( SKL::Worker& /*InWorker*/, SKL::WorkerGroup& InGroup ) mutable noexcept -> void
+        {
+            const uint64_t ChunkStart{ Claimed.increment( CChunkSize ) };
+            for( uint64_t i = ChunkStart; i < COpsCount && i < ChunkStart + CChunkSize; ++i )
+            {
+                if( 0U == ( i % CWriteEvery ) )
+                {
+                    ( void )IndexPtr->DoAsync( [ & ]( SKL::AOD::SharedObject& Obj ) noexcept -> void
+                    {
+                        const uint64_t Writers{ ActiveWriters.increment() + 1U };
+                        if( 0U != ActiveReaders.load_relaxed() || 1U != Writers )
+                        {
+                            ( void )++Overlaps;
+                        }
+
+                        auto& Self{ Obj.GetParentObject<MyIndex>() };
+                        ++Self.First;
+                        ++Self.Second;
+
+                        ( void )ActiveWriters.decrement();
+                        ( void )++Writes;
+                        ( void )++Completed;
+                    } );
+                }
+                else
+                {
+                    ( void )IndexPtr->DoAsyncRead( [ & ]( const SKL::AOD::SharedObject& Obj ) noexcept -> void
+                    {
+                        const uint64_t Readers{ ActiveReaders.increment() + 1U };
+                        if( 0U != ActiveWriters.load_relaxed() )
+                        {
+                            ( void )++Overlaps;
+                        }
+
+                        uint64_t Max{ MaxActiveReaders.load_relaxed() };
+                        while( Max < Readers && false == MaxActiveReaders.cas( Readers, Max ) ) {}
+
+                        const auto& Self{ Obj.GetParentObject<MyIndex>() };
+                        if( Self.First != Self.Second )
+                        {
+                            ( void )++TornReads;
+                        }
+
+                        ( void )ActiveReaders.decrement();
+                        ( void )++Completed;
+                    } );
+                }
+            }
+
+            if( COpsCount == Completed.load_relaxed() )
+            {
+                InGroup.GetServerInstance()->SignalToStop( true );
+            }
+        };
+
+        SKL::WorkerGroupTag Tag{
+            .TickRate                        = 60, 
+            .SyncTLSTickRate                 = 0,
+            .Id                              = 1,
+            .WorkersCount                    = CWorkersCount,
+            .bPreallocateAllThreadLocalPools = false,
+            .bSupportesTCPAsyncAcceptors     = false,
+            .Name                            = L"AODREADERSWRITERS_GROUP"
+        };
+        Tag.bIsActive          = true;
+        Tag.bEnableAsyncIO     = false;
+        Tag.bSupportsAOD       = true;
+        Tag.bHandlesTimerTasks = true;
+        Tag.bCallTickHandler   = true;
+
+        ASSERT_TRUE( true == AddNewWorkerGroup( Tag, std::move( OnTick ) ) );
+
+        const uint64_t ParkedConsumersBefore{ SKL::AOD::Object::GetParkedConsumersCount() };
+
+        ASSERT_TRUE( true == Start( true ) );
+        JoinAllGroups();
+
+        printf( "[DoAsyncRead] %llu ops (1 write every %llu) max concurrent readers: %llu parked writers: %llu\n"
+              , static_cast<unsigned long long>( COpsCount )
+              , static_cast<unsigned long long>( CWriteEvery )
+              , static_cast<unsigned long long>( MaxActiveReaders.load_relaxed() )
+              , static_cast<unsigned long long>( SKL::AOD::Object::GetParkedConsumersCount() - ParkedConsumersBefore ) );
+
+        ASSERT_EQ( COpsCount, Completed.load_relaxed() );
+        ASSERT_EQ( COpsCount / CWriteEvery, Writes.load_relaxed() );
+        ASSERT_EQ( 0U, TornReads.load_relaxed() );
+        ASSERT_EQ( 0U, Overlaps.load_relaxed() );
+        ASSERT_EQ( COpsCount / CWriteEvery, Index->First );
+        ASSERT_EQ( Index->First, Index->Second );
+    }
+
     TEST_F( AODTestsFixture, AODObjectReactiveAndActiveWorkers_ShutdownNotice )
     {
 #if defined(SKL_MEMORY_STATISTICS)
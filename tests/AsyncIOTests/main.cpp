@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <SkylakeLib.h>
+#include <ApplicationSetup.h>
 
 namespace AsyncIOTestsSuite
 {
@@ -142,6 +143,334 @@ namespace AsyncIOTestsSuite
         Result = SKL::AsyncIO::ShutdownSystem();
         ASSERT_TRUE( SKL::RSuccess == Result );
     }
+
+    TEST( AsyncIOTestsSuite, AsyncNetSendQueue_Coalesce_And_Fail )
+    {
+        ASSERT_TRUE( SKL::RSuccess == SKL::Skylake_InitializeLibrary( 0, nullptr, nullptr ) );
+
+        {
+            const SKL::TSocket Socket{ SKL::AllocateNewIPv4TCPSocket() };
+            ASSERT_TRUE( true == SKL::IsValidSocket( Socket ) );
+
+            SKL::AsyncNetSendQueue Queue;
+            Queue.SetSocket( Socket );
+
+            auto Packet{ SKL::MakeShared<SKL::TSizedAsyncNetBuffer<0U>>() };
+            ASSERT_TRUE( nullptr != Packet.get() );
+
+            // no flusher on this thread and under the threshold, the packets stay queued until Flush()
+            for( uint32_t i = 0; i < 3U; ++i )
+            {
+                ASSERT_TRUE( SKL::RSuccess == Queue.Enqueue( Packet ) );
+            }
+            ASSERT_EQ( 3U, Queue.GetQueuedCount() );
+            ASSERT_EQ( 3U * Packet->GetInterface().Length, Queue.GetQueuedBytes() );
+            ASSERT_EQ( 4U, Packet.use_count() );
+            ASSERT_FALSE( Queue.IsSending() );
+
+            // the socket is not connected, the send fails and the queued packets are released
+            ASSERT_TRUE( SKL::RFail == Queue.Flush() );
+            ASSERT_TRUE( Queue.HasFailed() );
+            ASSERT_FALSE( Queue.IsSending() );
+            ASSERT_EQ( 0U, Queue.GetQueuedCount() );
+            ASSERT_EQ( 1U, Packet.use_count() );
+
+            ASSERT_TRUE( SKL::RFail == Queue.Enqueue( Packet ) );
+            ASSERT_EQ( 1U, Packet.use_count() );
+
+            ( void )SKL::CloseSocket( Socket );
+        }
+
+        ASSERT_TRUE( SKL::RSuccess == SKL::Skylake_TerminateLibrary() );
+    }
+
+    TEST( AsyncIOTestsSuite, AsyncNetSendQueue_Closed_On_Other_Thread )
+    {
+        ASSERT_TRUE( SKL::RSuccess == SKL::Skylake_InitializeLibrary( 0, nullptr, nullptr ) );
+
+        {
+            auto Queue { std::make_unique<SKL::AsyncNetSendQueue>() };
+            auto Packet{ SKL::MakeShared<SKL::TSizedAsyncNetBuffer<0U>>() };
+            ASSERT_TRUE( nullptr != Packet.get() );
+
+            std::atomic<int32_t> Step{ 0 };
+            size_t               PendingAfterEnqueue{ 0U };
+            size_t               PendingAfterFlush{ 0U };
+
+            // the queue is scheduled on the flusher of this thread
+            std::jthread OwnerThread{ [&]() noexcept -> void
+            {
+                ( void )SKL::AsyncNetSendFlusher::Create();
+
+                ( void )Queue->Enqueue( Packet );
+                PendingAfterEnqueue = SKL::AsyncNetSendFlusher::GetInstance()->GetPendingQueuesCount();
+                Step.store( 1 );
+
+                while( 2 != Step.load() ) { std::this_thread::yield(); }
+
+                // end of the tick, the closed queue is dropped without sending
+                SKL::AsyncNetSendFlusher::GetInstance()->Flush();
+                PendingAfterFlush = SKL::AsyncNetSendFlusher::GetInstance()->GetPendingQueuesCount();
+                SKL::AsyncNetSendFlusher::Destroy();
+            } };
+
+            while( 1 != Step.load() ) { std::this_thread::yield(); }
+
+            // closed on this thread [without a flusher], the owner thread's flusher is not touched
+            Queue->Close();
+            ASSERT_TRUE( Queue->HasFailed() );
+            ASSERT_TRUE( Queue->IsScheduled() );
+            ASSERT_EQ( 0U, Queue->GetQueuedCount() );
+            ASSERT_EQ( 1U, Packet.use_count() );
+            ASSERT_TRUE( SKL::RFail == Queue->Enqueue( Packet ) );
+
+            Step.store( 2 );
+            OwnerThread.join();
+
+            // dropped by the owner, safe to destroy on this thread
+            ASSERT_FALSE( Queue->IsScheduled() );
+            Queue.reset();
+
+            ASSERT_EQ( 1U, PendingAfterEnqueue );
+            ASSERT_EQ( 0U, PendingAfterFlush );
+            ASSERT_EQ( 1U, Packet.use_count() );
+        }
+
+        ASSERT_TRUE( SKL::RSuccess == SKL::Skylake_TerminateLibrary() );
+    }
+
+    TEST( AsyncIOTestsSuite, AsyncNetBroadcast_FanOut_Benchmark )
+    {
+        constexpr uint32_t SessionsCount{ 1000U };
+        constexpr int32_t  Iterations   { 100 };
+
+        ASSERT_TRUE( SKL::RSuccess == SKL::Skylake_InitializeLibrary( 0, nullptr, nullptr ) );
+
+        {
+            auto Packet{ SKL::MakeShared<SKL::TSizedAsyncNetBuffer<0U>>() };
+            ASSERT_TRUE( nullptr != Packet.get() );
+            const uint32_t PacketSize{ Packet->GetInterface().Length };
+
+            // no flusher on this thread and under the threshold, the packets stay queued [the queues are not connected]
+            auto Queues{ std::make_unique<SKL::AsyncNetSendQueue[]>( SessionsCount ) };
+            std::vector<SKL::AsyncNetBroadcastTarget> Targets( SessionsCount );
+            for( uint32_t i = 0; i < SessionsCount; ++i )
+            {
+                Targets[i].Queue = &Queues[i];
+            }
+
+            // 1 packet -> 1000 sessions, one buffer shared by all the sessions
+            ASSERT_EQ( SessionsCount, SKL::AsyncNetBroadcast::Broadcast( Packet, Targets.data(), SessionsCount, nullptr ) );
+            ASSERT_EQ( SessionsCount + 1U, Packet.use_count() );
+            for( uint32_t i = 0; i < SessionsCount; ++i )
+            {
+                ASSERT_EQ( 1U, Queues[i].GetQueuedCount() );
+                ASSERT_EQ( PacketSize, Queues[i].GetQueuedBytes() );
+            }
+
+            Queues.reset();
+            ASSERT_EQ( 1U, Packet.use_count() );
+
+            const auto RunBenchmark = [&]( bool bUseFanOut ) -> double
+            {
+                double TotalTime{ 0.0 };
+
+                for( int32_t i = 0; i < Iterations; ++i )
+                {
+                    auto IterationQueues{ std::make_unique<SKL::AsyncNetSendQueue[]>( SessionsCount ) };
+                    for( uint32_t j = 0; j < SessionsCount; ++j )
+                    {
+                        Targets[j].Queue = &IterationQueues[j];
+                    }
+
+                    const auto Start{ std::chrono::steady_clock::now() };
+
+                    if( true == bUseFanOut )
+                    {
+                        ( void )SKL::AsyncNetBroadcast::Broadcast( Packet, Targets.data(), SessionsCount, nullptr );
+                    }
+                    else
+                    {
+                        // one buffer per session, the payload is copied for each session
+                        for( uint32_t j = 0; j < SessionsCount; ++j )
+                        {
+                            auto Copy{ SKL::MakeShared<SKL::TSizedAsyncNetBuffer<0U>>() };
+                            SKL_ASSERT( nullptr != Copy.get() );
+                            memcpy( Copy->GetBuffer(), Packet->GetBuffer(), PacketSize );
+                            ( void )Targets[j].Queue->Enqueue( std::move( Copy ) );
+                        }
+                    }
+
+                    TotalTime += std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - Start ).count();
+                }
+
+                return TotalTime / static_cast<double>( Iterations );
+            };
+
+            const double PerSessionCopyTime{ RunBenchmark( false ) };
+            const double FanOutTime        { RunBenchmark( true ) };
+            ASSERT_EQ( 1U, Packet.use_count() );
+
+            printf( "AsyncNetBroadcast_FanOut_Benchmark 1 packet -> %u sessions -> per session copy: %8.4fms fan-out: %8.4fms\n", SessionsCount, PerSessionCopyTime, FanOutTime );
+        }
+
+        ASSERT_TRUE( SKL::RSuccess == SKL::Skylake_TerminateLibrary() );
+    }
+
+    class AsyncNetBroadcastWorkersFixture : public ::testing::Test, public TestApplication
+    {
+    public:
+        static constexpr uint32_t CWorkersCount    { 3U };   //!< 2 active workers [one is the broadcaster] + 1 reactive worker
+        static constexpr uint32_t CQueuesPerWorker { 4U };
+        static constexpr uint32_t CQueuesCount     { CWorkersCount * CQueuesPerWorker };
+        static constexpr uint32_t CMaxTicksToFinish{ 600U };
+
+        AsyncNetBroadcastWorkersFixture()
+            : ::testing::Test(),
+              TestApplication( L"ASYNCNET_BROADCAST_TESTS_APP" ) {}
+
+        void SetUp() override
+        {
+            ASSERT_TRUE( SKL::RSuccess == SKL::Skylake_InitializeLibrary( 0, nullptr, nullptr ) );
+        }
+
+        void TearDown() override
+        {
+            ASSERT_TRUE( SKL::RSuccess == SKL::Skylake_TerminateLibrary() );
+        }
+
+        bool OnWorkerStarted( SKL::Worker& InWorker, SKL::WorkerGroup& InGroup ) noexcept override
+        {
+            if( false == TestApplication::OnWorkerStarted( InWorker, InGroup ) )
+            {
+                return false;
+            }
+
+            SKL::SpinLockScopeGuard Guard{ WorkersLock };
+            Workers.push_back( &InWorker );
+
+            return true;
+        }
+
+        //! The first active worker to tick broadcasts to the queues owned by all the workers and waits for all the queues to try to send the packet
+        void OnActiveTick( SKL::Worker& InWorker ) noexcept
+        {
+            SKL::Worker* Expected{ nullptr };
+            if( false == Broadcaster.compare_exchange_strong( Expected, &InWorker ) && &InWorker != Expected )
+            {
+                return;
+            }
+
+            if( false == bHasBroadcast )
+            {
+                std::vector<SKL::AsyncNetBroadcastTarget> Targets;
+                {
+                    SKL::SpinLockScopeGuard Guard{ WorkersLock };
+                    if( CWorkersCount != Workers.size() )
+                    {
+                        return;
+                    }
+
+                    for( uint32_t i = 0; i < CQueuesCount; ++i )
+                    {
+                        Targets.push_back( SKL::AsyncNetBroadcastTarget{ .Queue = &Queues[i], .OwnerWorker = Workers[i / CQueuesPerWorker] } );
+                    }
+                }
+
+                BroadcastCount = SKL::AsyncNetBroadcast::Broadcast( Packet, Targets.data(), CQueuesCount, &InWorker );
+                bHasBroadcast  = true;
+                return;
+            }
+
+            // the sockets are not connected, each queue fails its first send and releases the packet
+            bool bHaveAllQueuesSent{ true };
+            for( uint32_t i = 0; i < CQueuesCount; ++i )
+            {
+                bHaveAllQueuesSent &= Queues[i].HasFailed();
+            }
+
+            if( ( true == bHaveAllQueuesSent && 1U == Packet.use_count() ) || CMaxTicksToFinish == ++TicksAfterBroadcast )
+            {
+                bHaveAllQueuesReceived = bHaveAllQueuesSent;
+                FinalUseCount          = Packet.use_count();
+                SignalToStop( true );
+            }
+        }
+
+        SKL::SpinLock                               WorkersLock;
+        std::vector<SKL::Worker*>                   Workers;
+        std::atomic<SKL::Worker*>                   Broadcaster{ nullptr };
+        std::unique_ptr<SKL::AsyncNetSendQueue[]>   Queues;
+        std::vector<SKL::TSocket>                   Sockets;
+        SKL::TSharedPtr<SKL::TSizedAsyncNetBuffer<0U>> Packet;
+        bool                                        bHasBroadcast         { false };
+        bool                                        bHaveAllQueuesReceived{ false };
+        uint32_t                                    BroadcastCount        { 0U };
+        uint32_t                                    TicksAfterBroadcast   { 0U };
+        size_t                                      FinalUseCount         { 0U };
+    };
+
+    TEST_F( AsyncNetBroadcastWorkersFixture, AsyncNetBroadcast_To_Active_And_Reactive_Owners )
+    {
+        Packet = SKL::MakeShared<SKL::TSizedAsyncNetBuffer<0U>>();
+        ASSERT_TRUE( nullptr != Packet.get() );
+
+        Queues = std::make_unique<SKL::AsyncNetSendQueue[]>( CQueuesCount );
+        for( uint32_t i = 0; i < CQueuesCount; ++i )
+        {
+            Sockets.push_back( SKL::AllocateNewIPv4TCPSocket() );
+            ASSERT_TRUE( true == SKL::IsValidSocket( Sockets.back() ) );
+            Queues[i].SetSocket( Sockets.back() );
+        }
+
+        // active owners, the broadcast is handed to the other worker through its general task queue
+        SKL::WorkerGroupTag ActiveTag{
+            .TickRate                        = 60, 
+            .SyncTLSTickRate                 = 0,
+            .Id                              = 1,
+            .WorkersCount                    = 2,
+            .bPreallocateAllThreadLocalPools = false,
+            .bSupportesTCPAsyncAcceptors     = false,
+            .Name                            = L"BROADCAST_ACTIVE_GROUP"
+        };
+        ActiveTag.bIsActive        = true;
+        ActiveTag.bEnableAsyncIO   = false;
+        ActiveTag.bEnableTaskQueue = true;
+        ActiveTag.bCallTickHandler = true;
+
+        // reactive owner, the broadcast is handed to the group through its async IO queue
+        SKL::WorkerGroupTag ReactiveTag{
+            .TickRate                        = 0, 
+            .SyncTLSTickRate                 = 0,
+            .Id                              = 2,
+            .WorkersCount                    = 1,
+            .bPreallocateAllThreadLocalPools = false,
+            .bSupportesTCPAsyncAcceptors     = false,
+            .Name                            = L"BROADCAST_REACTIVE_GROUP"
+        };
+        ReactiveTag.bIsActive      = false;
+        ReactiveTag.bEnableAsyncIO = true;
+
+        ASSERT_TRUE( true == AddNewWorkerGroup( ActiveTag, [ this ]( SKL::Worker& InWorker, SKL::WorkerGroup& /*InGroup*/ ) noexcept -> void
+        {
+            OnActiveTick( InWorker );
+        } ) );
+        ASSERT_TRUE( true == AddNewWorkerGroup( ReactiveTag, []( SKL::Worker& /*InWorker*/, SKL::WorkerGroup& /*InGroup*/ ) noexcept -> void {} ) );
+
+        ASSERT_TRUE( true == Start( true ) );
+
+        ASSERT_EQ( CQueuesCount, BroadcastCount );
+        ASSERT_TRUE( bHaveAllQueuesReceived );
+        ASSERT_EQ( 1U, FinalUseCount );
+        ASSERT_EQ( 1U, Packet.use_count() );
+
+        Queues.reset();
+        for( SKL::TSocket Socket : Sockets )
+        {
+            ( void )SKL::CloseSocket( Socket );
+        }
+        Packet.reset();
+    }
 }
 
 int main( int argc, char** argv )
@@ -515,6 +515,899 @@ namespace MManagementTestsSuite
 
         SKL::KPIContext::Destroy();
     }
+
+    TEST( MManagementTestsSuite, GlobalMemoryThreadCache_Magazine )
+    {
+        using TMagazine = SKL::GlobalMemoryMagazine<SKL::SkylakeGlobalMemoryManager::Pool1::TObjectPool>;
+
+        TMagazine Magazine{};
+        ASSERT_EQ( 0U, Magazine.GetCount() );
+
+        // first allocation refills one batch
+        void* Block{ Magazine.Allocate() };
+        ASSERT_TRUE( nullptr != Block );
+        ASSERT_EQ( TMagazine::BatchSize - 1U, Magazine.GetCount() );
+
+        Magazine.Deallocate( Block );
+        ASSERT_EQ( TMagazine::BatchSize, Magazine.GetCount() );
+
+        // overflowing the magazine flushes one batch to the pool
+        std::vector<void*> Blocks;
+        for( uint32_t i = 0; i < TMagazine::Capacity; ++i )
+        {
+            auto AllocResult{ SKL::SkylakeGlobalMemoryManager::Allocate<SKL::CMemoryManager_Pool1_BlockSize>() };
+            ASSERT_TRUE( true == AllocResult.IsValid() );
+            Blocks.push_back( AllocResult.MemoryBlock );
+        }
+        for( auto* Item : Blocks )
+        {
+            Magazine.Deallocate( Item );
+            ASSERT_TRUE( Magazine.GetCount() <= TMagazine::Capacity );
+        }
+        ASSERT_EQ( TMagazine::Capacity, Magazine.GetCount() );
+
+        Magazine.Flush();
+        ASSERT_EQ( 0U, Magazine.GetCount() );
+    }
+
+    TEST( MManagementTestsSuite, GlobalMemoryThreadCache_Benchmark )
+    {
+        constexpr int32_t IterationsPerThread = 100000;
+        constexpr int32_t LiveBlocksPerThread = 64;
+
+        // each thread keeps a window of live 64 and 128 bytes blocks and randomly frees or allocates one slot of it
+        const auto RunBenchmark = [&]( int32_t InThreadsCount, bool bUseThreadCache ) -> double
+        {
+            std::vector<std::jthread> Threads;
+            std::atomic<int32_t>      FailedAllocations{ 0 };
+
+            const auto Start{ std::chrono::steady_clock::now() };
+
+            for( int32_t i = 0; i < InThreadsCount; ++i )
+            {
+                Threads.emplace_back( [&, bUseThreadCache, i]() -> void
+                {
+                    SKL::KPIContext::Create();
+                    if( true == bUseThreadCache )
+                    {
+                        ( void )SKL::GlobalMemoryThreadCache::Create();
+                    }
+
+                    void*    LiveBlocks[LiveBlocksPerThread]{};
+                    size_t   LiveBlocksSizes[LiveBlocksPerThread]{};
+                    uint32_t Seed{ static_cast<uint32_t>( i ) * 7919U + 1U };
+
+                    for( int32_t j = 0; j < IterationsPerThread; ++j )
+                    {
+                        Seed = Seed * 1664525U + 1013904223U;
+                        const uint32_t Slot{ ( Seed >> 8 ) % LiveBlocksPerThread };
+
+                        if( nullptr != LiveBlocks[Slot] )
+                        {
+                            SKL::SkylakeGlobalMemoryManager::Deallocate( LiveBlocks[Slot], LiveBlocksSizes[Slot] );
+                            LiveBlocks[Slot] = nullptr;
+                        }
+                        else
+                        {
+                            const size_t Size{ 0U == ( ( Seed >> 16 ) & 1U ) ? SKL::CMemoryManager_Pool1_BlockSize : SKL::CMemoryManager_Pool2_BlockSize };
+                            auto AllocResult{ SKL::SkylakeGlobalMemoryManager::Allocate( Size ) };
+                            if( false == AllocResult.IsValid() )
+                            {
+                                ( void )++FailedAllocations;
+                                continue;
+                            }
+
+                            LiveBlocks[Slot]      = AllocResult.MemoryBlock;
+                            LiveBlocksSizes[Slot] = Size;
+                        }
+                    }
+
+                    for( int32_t j = 0; j < LiveBlocksPerThread; ++j )
+                    {
+                        if( nullptr != LiveBlocks[j] )
+                        {
+                            SKL::SkylakeGlobalMemoryManager::Deallocate( LiveBlocks[j], LiveBlocksSizes[j] );
+                        }
+                    }
+
+                    if( true == bUseThreadCache )
+                    {
+                        SKL::GlobalMemoryThreadCache::Destroy();
+                    }
+                    SKL::KPIContext::Destroy();
+                } );
+            }
+
+            for( auto& Thread : Threads )
+            {
+                Thread.join();
+            }
+
+            EXPECT_EQ( 0, FailedAllocations.load() );
+
+            return std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - Start ).count();
+        };
+
+        for( int32_t ThreadsCount : { 1, 2, 4, 8, 16, 32 } )
+        {
+            const double PoolsOnlyTime { RunBenchmark( ThreadsCount, false ) };
+            const double ThreadCacheTime{ RunBenchmark( ThreadsCount, true ) };
+
+            printf( "GlobalMemoryThreadCache_Benchmark %2d threads -> pools only: %8.2fms thread cache: %8.2fms\n", ThreadsCount, PoolsOnlyTime, ThreadCacheTime );
+        }
+    }
+
+    TEST( MManagementTestsSuite, ThreadLocalMemoryManager_RemoteFree )
+    {
+        constexpr size_t BlocksCount{ 1024 };
+        constexpr size_t BlockSize  { SKL::ThreadLocalMemoryManagerConfig::Pool1_BlockSize };
+
+        SKL::KPIContext::Create();
+        ASSERT_TRUE( SKL::RSuccess == SKL::ThreadLocalMemoryManager::Create() );
+
+        SKL::ThreadLocalMemoryManager::TOwnerTag Owner{ SKL::ThreadLocalMemoryManager::GetOwnerTag() };
+        ASSERT_TRUE( nullptr != Owner );
+
+        std::vector<void*> Blocks;
+        for( size_t i = 0; i < BlocksCount + 1U; ++i )
+        {
+            auto AllocResult{ SKL::ThreadLocalMemoryManager::Allocate<BlockSize>() };
+            ASSERT_TRUE( true == AllocResult.IsValid() );
+            Blocks.push_back( AllocResult.MemoryBlock );
+        }
+
+        // freed on the owner thread, returned to the pools right away
+        SKL::ThreadLocalMemoryManager::DeallocateFromAnyThread( Owner, Blocks.back(), BlockSize );
+        Blocks.pop_back();
+        ASSERT_TRUE( Owner->IsEmpty() );
+
+        // freed on foreign threads (with and without a ThreadLocalMemoryManager), pushed to the owner's remote free list
+        std::jthread FreeThreadA{ [&Blocks, Owner]() noexcept -> void
+        {
+            for( size_t i = 0; i < BlocksCount / 2; ++i )
+            {
+                SKL::ThreadLocalMemoryManager::DeallocateFromAnyThread( Owner, Blocks[i], BlockSize );
+            }
+        } };
+        std::jthread FreeThreadB{ [&Blocks, Owner]() noexcept -> void
+        {
+            SKL::KPIContext::Create();
+            ( void )SKL::ThreadLocalMemoryManager::Create();
+
+            for( size_t i = BlocksCount / 2; i < BlocksCount; ++i )
+            {
+                SKL::ThreadLocalMemoryManager::DeallocateFromAnyThread( Owner, Blocks[i], BlockSize );
+            }
+
+            SKL::ThreadLocalMemoryManager::FreeAllPools();
+            SKL::ThreadLocalMemoryManager::Destroy();
+            SKL::KPIContext::Destroy();
+        } };
+        FreeThreadA.join();
+        FreeThreadB.join();
+
+        // reclaimed in bulk by the owner
+        ASSERT_FALSE( Owner->IsEmpty() );
+        ASSERT_EQ( BlocksCount, SKL::ThreadLocalMemoryManager::ReclaimRemoteFreed() );
+        ASSERT_TRUE( Owner->IsEmpty() );
+        ASSERT_EQ( 0U, SKL::ThreadLocalMemoryManager::ReclaimRemoteFreed() );
+
+        SKL::ThreadLocalMemoryManager::FreeAllPools();
+        SKL::ThreadLocalMemoryManager::Destroy();
+        SKL::KPIContext::Destroy();
+    }
+
+    TEST( MManagementTestsSuite, ThreadLocalMemoryManager_RemoteFree_AfterOwnerTerminated )
+    {
+        constexpr size_t BlockSize{ SKL::ThreadLocalMemoryManagerConfig::Pool1_BlockSize };
+
+        const size_t PendingSlabsCount{ SKL::SlabRegistry::GetPendingSlabsCount() };
+
+        SKL::ThreadLocalMemoryManager::TOwnerTag Owner{ nullptr };
+        void*                                    Block{ nullptr };
+
+        // the owner allocates from its slab and terminates while the block is still in use
+        std::jthread OwnerThread{ [&Owner, &Block]() noexcept -> void
+        {
+            SKL::KPIContext::Create();
+            ( void )SKL::ThreadLocalMemoryManager::Create();
+            ( void )SKL::ThreadLocalMemoryManager::Preallocate();
+
+            Owner = SKL::ThreadLocalMemoryManager::GetOwnerTag();
+            Block = SKL::ThreadLocalMemoryManager::Allocate<BlockSize>().MemoryBlock;
+
+            SKL::ThreadLocalMemoryManager::FreeAllPools();
+            SKL::ThreadLocalMemoryManager::Destroy();
+            SKL::KPIContext::Destroy();
+        } };
+        OwnerThread.join();
+
+        ASSERT_TRUE( nullptr != Owner );
+        ASSERT_TRUE( nullptr != Block );
+        ASSERT_TRUE( Owner->IsClosed() );
+        if constexpr( SKL::ThreadLocalMemoryManagerConfig::bUseSlabPreallocation )
+        {
+            ASSERT_EQ( PendingSlabsCount + 1U, SKL::SlabRegistry::GetPendingSlabsCount() );
+        }
+
+        // the late free is not pushed to the closed list, the released slab is freed with its last block
+        ( void )memset( Block, 0xAB, BlockSize );
+        SKL::ThreadLocalMemoryManager::DeallocateFromAnyThread( Owner, Block, BlockSize );
+        ASSERT_TRUE( Owner->IsEmpty() );
+        ASSERT_EQ( PendingSlabsCount, SKL::SlabRegistry::GetPendingSlabsCount() );
+
+        // the closed list is recycled for the next owner once no released slab waits for its blocks
+        SKL::KPIContext::Create();
+        ASSERT_TRUE( SKL::RSuccess == SKL::ThreadLocalMemoryManager::Create() );
+        if( 0U == PendingSlabsCount )
+        {
+            ASSERT_TRUE( Owner == SKL::ThreadLocalMemoryManager::GetOwnerTag() );
+            ASSERT_FALSE( Owner->IsClosed() );
+        }
+        SKL::ThreadLocalMemoryManager::FreeAllPools();
+        SKL::ThreadLocalMemoryManager::Destroy();
+        SKL::KPIContext::Destroy();
+    }
+
+    TEST( MManagementTestsSuite, MemoryManager_SizeClasses )
+    {
+        using TSizeClasses = SKL::SkylakeGlobalMemoryManager::TSizeClasses;
+
+        static_assert( TSizeClasses::ClassesCount == SKL::CMemoryManager_SizeClassesCount );
+        static_assert( TSizeClasses::Sizes[0] > SKL::CMemoryManager_Pool4_BlockSize );
+        static_assert( TSizeClasses::MaxSize < SKL::CMemoryManager_Pool5_BlockSize );
+        static_assert( 0U == TSizeClasses::template ClassIndexOf<TSizeClasses::Sizes[0]> );
+        static_assert( 1U == TSizeClasses::template ClassIndexOf<TSizeClasses::Sizes[0] + 1U> );
+
+        for( size_t i = 1; i < TSizeClasses::ClassesCount; ++i )
+        {
+            ASSERT_TRUE( TSizeClasses::Sizes[i - 1] < TSizeClasses::Sizes[i] );
+            ASSERT_EQ( 0U, TSizeClasses::Sizes[i] % SKL_CACHE_LINE_SIZE );
+            ASSERT_EQ( i, TSizeClasses::GetClassIndex( TSizeClasses::Sizes[i] ) );
+            ASSERT_EQ( i, TSizeClasses::GetClassIndex( TSizeClasses::Sizes[i - 1] + 1U ) );
+        }
+
+        SKL::KPIContext::Create();
+        ASSERT_TRUE( SKL::RSuccess == SKL::ThreadLocalMemoryManager::Create() );
+
+        // 2 KiB - 16 KiB buffers are served by the size classes instead of Pool5
+        for( size_t Size = 2048U; Size <= 16384U; Size += 1000U )
+        {
+            auto GlobalResult{ SKL::GlobalMemoryManager::Allocate( Size ) };
+            ASSERT_TRUE( true == GlobalResult.IsValid() );
+            ASSERT_TRUE( Size <= GlobalResult.MemoryBlockSize );
+            ASSERT_TRUE( GlobalResult.MemoryBlockSize < SKL::CMemoryManager_Pool5_BlockSize );
+            ASSERT_TRUE( ( Size * 5U ) / 4U + SKL_CACHE_LINE_SIZE >= GlobalResult.MemoryBlockSize );
+            ( void )memset( GlobalResult.MemoryBlock, 0xAB, Size );
+
+            auto LocalResult{ SKL::ThreadLocalMemoryManager::Allocate( Size ) };
+            ASSERT_TRUE( true == LocalResult.IsValid() );
+            ASSERT_EQ( GlobalResult.MemoryBlockSize, LocalResult.MemoryBlockSize );
+            ( void )memset( LocalResult.MemoryBlock, 0xCD, Size );
+
+            SKL::GlobalMemoryManager::Deallocate( GlobalResult );
+            SKL::ThreadLocalMemoryManager::Deallocate( LocalResult );
+        }
+
+        auto CompileTimeResult{ SKL::GlobalMemoryManager::Allocate<4096U>() };
+        ASSERT_TRUE( true == CompileTimeResult.IsValid() );
+        ASSERT_EQ( TSizeClasses::Sizes[TSizeClasses::template ClassIndexOf<4096U>], CompileTimeResult.MemoryBlockSize );
+        SKL::GlobalMemoryManager::Deallocate<4096U>( CompileTimeResult.MemoryBlock );
+
+        const auto& Statistics{ SKL::GlobalMemoryManager::GetSizeClassesStatistics() };
+        for( size_t i = 0; i < TSizeClasses::ClassesCount; ++i )
+        {
+            const double Fragmentation{ Statistics.GetFragmentationRatio( i ) };
+            ASSERT_TRUE( 0.0 <= Fragmentation && Fragmentation < 1.0 );
+        }
+        ASSERT_TRUE( 0U < Statistics.GetAllocations( TSizeClasses::template ClassIndexOf<4096U> ) );
+
+        SKL::GlobalMemoryManager::LogSizeClassesReport();
+        SKL::ThreadLocalMemoryManager::LogSizeClassesReport();
+
+        SKL::ThreadLocalMemoryManager::FreeAllPools();
+        SKL::ThreadLocalMemoryManager::Destroy();
+        SKL::KPIContext::Destroy();
+    }
+
+    TEST( MManagementTestsSuite, FrameArena_BumpAndReset )
+    {
+        SKL::BumpArena Arena{ 1024U };
+        ASSERT_EQ( 0U, Arena.GetUsedBytes() );
+
+        for( int32_t Tick = 0; Tick < 4; ++Tick )
+        {
+            for( int32_t i = 0; i < 128; ++i )
+            {
+                auto* Block{ reinterpret_cast<uint8_t*>( Arena.Allocate( 40U, 16U ) ) };
+                ASSERT_TRUE( nullptr != Block );
+                ASSERT_EQ( 0U, reinterpret_cast<uintptr_t>( Block ) % 16U );
+                ( void )memset( Block, 0xAB, 40U );
+            }
+
+            // larger than the chunk size
+            auto* LargeBlock{ Arena.AllocateArray<uint64_t>( 8192U ) };
+            ASSERT_TRUE( nullptr != LargeBlock );
+            LargeBlock[8191U] = 5U;
+
+            ASSERT_TRUE( 128U * 40U + 8192U * sizeof( uint64_t ) <= Arena.GetUsedBytes() );
+
+            Arena.Reset();
+            ASSERT_EQ( 0U, Arena.GetUsedBytes() );
+
+            // after the first tick the arena fits the peak usage in one chunk
+            ASSERT_TRUE( Arena.GetPeakUsedBytes() <= Arena.GetAvailableBytes() );
+        }
+
+        ASSERT_TRUE( SKL::RSuccess == SKL::FrameArena::Create() );
+        {
+            SKL::FrameVector<int32_t> Values;
+            for( int32_t i = 0; i < 1024; ++i )
+            {
+                Values.push_back( i );
+            }
+            ASSERT_EQ( 1023, Values.back() );
+            ASSERT_TRUE( 0U < SKL::FrameArena::GetInstance()->GetArena().GetUsedBytes() );
+        }
+        SKL::FrameArena::GetInstance()->Reset();
+        ASSERT_EQ( 0U, SKL::FrameArena::GetInstance()->GetArena().GetUsedBytes() );
+        SKL::FrameArena::Destroy();
+    }
+
+    TEST( MManagementTestsSuite, PoolTrimming_DiscardColdBlocks )
+    {
+        constexpr size_t BlockSize{ 65536U };
+        constexpr size_t PoolSize { 16U };
+
+        using PoolType = SKL::LocalObjectPool<SKL::MemoryBlock<BlockSize>, PoolSize, true, true, false, false, SKL_ALIGNMENT, true, false>;
+        auto Pool{ std::make_unique<PoolType>() };
+        ASSERT_TRUE( SKL::RSuccess == Pool->Preallocate() );
+        ASSERT_TRUE( Pool->SupportsTrimming() );
+        ASSERT_EQ( PoolSize, Pool->GetCachedBlocksCount() );
+
+        // usage spike
+        std::vector<SKL::MemoryBlock<BlockSize>*> Blocks;
+        for( size_t i = 0; i < PoolSize; ++i )
+        {
+            Blocks.push_back( Pool->Allocate() );
+            ASSERT_TRUE( nullptr != Blocks.back() );
+        }
+        ASSERT_EQ( 0U, Pool->GetCachedBlocksCount() );
+
+        // idle again
+        for( auto* Block : Blocks )
+        {
+            Pool->Deallocate( Block );
+        }
+        ASSERT_EQ( PoolSize, Pool->GetCachedBlocksCount() );
+
+        SKL::PoolTrimPolicy Policy{};
+        ASSERT_EQ( 0U, Policy.Sample( 1U, 0U, PoolSize ) );
+        ASSERT_EQ( 0U, Policy.Sample( 2U, PoolSize, PoolSize ) );
+
+        // peak usage was the whole pool, only the blocks above the reserve were idle for the whole window
+        ASSERT_EQ( 0U, Policy.Sample( 1U + SKL::CMemoryManager_TrimWindowMs, PoolSize, PoolSize ) );
+
+        // nothing was used during the second window
+        const size_t TrimCount{ Policy.Sample( 1U + SKL::CMemoryManager_TrimWindowMs * 2U, PoolSize, PoolSize ) };
+        ASSERT_EQ( std::min( PoolSize - SKL::CMemoryManager_TrimMinCachedBlocks, SKL::CMemoryManager_TrimMaxBlocksPerPass ), TrimCount );
+
+        // only the whole pages inside each block are discarded
+        const size_t DiscardedBytes{ Pool->DiscardColdBlocks( TrimCount ) };
+        ASSERT_TRUE( 0U < DiscardedBytes && DiscardedBytes <= TrimCount * BlockSize );
+
+        // the trimmed blocks are still cached, their pages are only faulted back in
+        ASSERT_EQ( PoolSize, Pool->GetCachedBlocksCount() );
+        Blocks.clear();
+        for( size_t i = 0; i < PoolSize; ++i )
+        {
+            Blocks.push_back( Pool->Allocate() );
+            ASSERT_TRUE( nullptr != Blocks.back() );
+            ASSERT_TRUE( Pool->IsOwnedBySlab( Blocks.back() ) );
+            ( void )memset( Blocks.back(), 0xCD, BlockSize );
+        }
+        for( auto* Block : Blocks )
+        {
+            Pool->Deallocate( Block );
+        }
+
+        Pool->FreePool();
+    }
+
+    TEST( MManagementTestsSuite, AllocationSiteProfiler_SampleAndReport )
+    {
+        using Profiler = SKL::AllocationSiteProfiler;
+        constexpr size_t SamplesCount{ 8U };
+        constexpr size_t BlockSize   { 128U };
+        constexpr size_t AllocCount  { static_cast<size_t>( Profiler::SampleRate ) * SamplesCount };
+
+        // the blocks are only used as keys
+        const auto GetBlock{ []( size_t InIndex ) noexcept -> void* { return reinterpret_cast<void*>( static_cast<uintptr_t>( ( InIndex + 1U ) * SKL_CACHE_LINE_SIZE ) ); } };
+
+        Profiler::Reset();
+        {
+            SKL::AllocationSiteScope Scope{ "MManagementTests::SampleAndReport" };
+            for( size_t i = 0; i < AllocCount; ++i )
+            {
+                Profiler::OnAllocation( SKL_RETURN_ADDRESS(), GetBlock( i ), 100U, BlockSize );
+            }
+        }
+
+        auto Snapshot{ Profiler::GetSnapshot() };
+        ASSERT_EQ( 1U, Snapshot.size() );
+        ASSERT_EQ( 0, strcmp( "MManagementTests::SampleAndReport", Snapshot[0].Tag ) );
+        ASSERT_EQ( BlockSize, Snapshot[0].BlockSize );
+        ASSERT_EQ( SamplesCount, Snapshot[0].SampledAllocations );
+        ASSERT_EQ( static_cast<int64_t>( SamplesCount * BlockSize ), Snapshot[0].SampledLiveBytes );
+        ASSERT_EQ( AllocCount, Snapshot[0].GetEstimatedAllocations() );
+
+        Profiler::LogReport();
+
+        for( size_t i = 0; i < AllocCount; ++i )
+        {
+            Profiler::OnDeallocation( GetBlock( i ) );
+        }
+
+        Snapshot = Profiler::GetSnapshot();
+        ASSERT_EQ( 1U, Snapshot.size() );
+        ASSERT_EQ( SamplesCount, Snapshot[0].SampledDeallocations );
+        ASSERT_EQ( 0, Snapshot[0].SampledLiveBytes );
+
+        Profiler::Reset();
+        ASSERT_TRUE( Profiler::GetSnapshot().empty() );
+    }
+
+    TEST( MManagementTestsSuite, TLocalSharedPtr_API )
+    {
+        struct LocalObject
+        {
+            LocalObject( int32_t InValue, int32_t& InDestructCount ) noexcept : Value{ InValue }, DestructCount{ InDestructCount } {}
+            ~LocalObject() noexcept { ++DestructCount; }
+
+            int32_t  Value;
+            int32_t& DestructCount;
+        };
+
+        SKL::KPIContext::Create();
+        ASSERT_TRUE( SKL::RSuccess == SKL::ThreadLocalMemoryManager::Create() );
+
+        int32_t DestructCount{ 0 };
+        {
+            auto Local{ SKL::TLSMakeLocalShared<LocalObject>( 5, std::ref( DestructCount ) ) };
+            ASSERT_TRUE( static_cast<bool>( Local ) );
+            ASSERT_EQ( 5, Local->Value );
+            ASSERT_EQ( 1U, Local.use_count() );
+            ASSERT_FALSE( Local.is_escaped() );
+
+            {
+                auto LocalCopy{ Local };
+                auto LocalCopy2{ LocalCopy };
+                ASSERT_EQ( 3U, Local.use_count() );
+            }
+            ASSERT_EQ( 1U, Local.use_count() );
+            ASSERT_EQ( 0, DestructCount );
+
+            // cross the thread boundary through an atomic shared ptr
+            auto Shared{ Local.ToShared() };
+            ASSERT_TRUE( Local.is_escaped() );
+            ASSERT_EQ( 2U, Shared.use_count() );
+
+            auto LocalCopy{ Local };
+            ASSERT_EQ( 3U, Local.use_count() );
+
+            std::jthread OtherThread{ [Shared = std::move( Shared )]() mutable noexcept -> void
+            {
+                Shared->Value = 7;
+                Shared.reset();
+            } };
+            OtherThread.join();
+
+            ASSERT_EQ( 7, Local->Value );
+            ASSERT_EQ( 2U, Local.use_count() );
+
+            LocalCopy.reset();
+            ASSERT_EQ( 1U, Local.use_count() );
+            ASSERT_EQ( 0, DestructCount );
+        }
+        ASSERT_EQ( 1, DestructCount );
+
+        {
+            auto Local { SKL::TLSMakeLocalShared<LocalObject>( 1, std::ref( DestructCount ) ) };
+            auto Shared{ Local.MoveToShared() };
+            ASSERT_FALSE( static_cast<bool>( Local ) );
+            ASSERT_EQ( 1U, Shared.use_count() );
+        }
+        ASSERT_EQ( 2, DestructCount );
+
+        // the last reference released on another thread, the block is returned to the owner's remote free list
+        {
+            SKL::ThreadLocalMemoryManager::TOwnerTag Owner{ SKL::ThreadLocalMemoryManager::GetOwnerTag() };
+            ASSERT_TRUE( Owner->IsEmpty() );
+
+            auto Shared{ SKL::TLSMakeLocalShared<LocalObject>( 3, std::ref( DestructCount ) ).MoveToShared() };
+            std::jthread OtherThread{ [Shared = std::move( Shared )]() mutable noexcept -> void
+            {
+                Shared.reset();
+            } };
+            OtherThread.join();
+
+            ASSERT_EQ( 3, DestructCount );
+            ASSERT_FALSE( Owner->IsEmpty() );
+            ASSERT_EQ( 1U, SKL::ThreadLocalMemoryManager::ReclaimRemoteFreed() );
+            ASSERT_TRUE( Owner->IsEmpty() );
+        }
+
+        SKL::ThreadLocalMemoryManager::FreeAllPools();
+        SKL::ThreadLocalMemoryManager::Destroy();
+        SKL::KPIContext::Destroy();
+    }
+
+    TEST( MManagementTestsSuite, TWeakPtr_API )
+    {
+        // only the weakable shared objects pay for the weak ref count
+        static_assert( 8U == SKL::MemoryPolicy::SharedMemoryPolicy<false>::CControlBlockSize );
+        static_assert( 16U == SKL::MemoryPolicy::SharedMemoryPolicy<false, true>::CControlBlockSize );
+
+        SKL::KPIContext::Create();
+        SKL_IFMEMORYSTATS( const uint64_t DeallocationsBefore = SKL::SkylakeGlobalMemoryManager::TotalDeallocations );
+
+        int32_t b = 5;
+        {
+            auto Shared{ SKL::MakeSharedWeakable<MyType>( &b ) };
+            SKL::TWeakPtr<MyType> Weak{ Shared };
+            ASSERT_FALSE( Weak.expired() );
+            ASSERT_EQ( 1U, Weak.use_count() );
+            ASSERT_TRUE( Weak.IsSameObject( Shared ) );
+
+            {
+                auto Locked{ Weak.Lock() };
+                ASSERT_TRUE( Locked.get() == Shared.get() );
+                ASSERT_EQ( 2U, Shared.use_count() );
+            }
+            ASSERT_EQ( 1U, Shared.use_count() );
+
+            auto WeakCopy{ Weak };
+
+            // destroyed at strong count zero, the memory block is kept for the weak references
+            Shared.reset();
+            ASSERT_EQ( 23, b );
+            ASSERT_TRUE( Weak.expired() );
+            ASSERT_FALSE( static_cast<bool>( Weak.Lock() ) );
+            SKL_IFMEMORYSTATS( ASSERT_TRUE( DeallocationsBefore == SKL::SkylakeGlobalMemoryManager::TotalDeallocations ) );
+
+            // freed at weak count zero
+            Weak.reset();
+            SKL_IFMEMORYSTATS( ASSERT_TRUE( DeallocationsBefore == SKL::SkylakeGlobalMemoryManager::TotalDeallocations ) );
+            WeakCopy.reset();
+            SKL_IFMEMORYSTATS( ASSERT_TRUE( DeallocationsBefore + 1U == SKL::SkylakeGlobalMemoryManager::TotalDeallocations ) );
+        }
+
+        // Lock() racing the release of the last strong reference
+        for( int32_t i = 0; i < 1000; ++i )
+        {
+            int32_t c = 5;
+            auto Shared{ SKL::MakeSharedWeakable<MyType>( &c ) };
+            SKL::TWeakPtr<MyType> Weak{ Shared };
+
+            std::jthread LockThread{ [Weak = std::move( Weak )]() mutable noexcept -> void
+            {
+                for( int32_t j = 0; j < 64; ++j )
+                {
+                    auto Locked{ Weak.Lock() };
+                    if( Locked )
+                    {
+                        ASSERT_EQ( 5, *Locked->a );
+                    }
+                }
+            } };
+
+            Shared.reset();
+            LockThread.join();
+            ASSERT_EQ( 23, c );
+        }
+
+        SKL::KPIContext::Destroy();
+    }
+
+    TEST( MManagementTestsSuite, DeferredRelease_FanOutAndFlush )
+    {
+        SKL::KPIContext::Create();
+        ASSERT_TRUE( SKL::RSuccess == SKL::DeferredReleaseBatch::Create() );
+
+        constexpr uint32_t TargetsCount = 200U;
+        int32_t b = 5;
+        {
+            auto Shared{ SKL::MakeShared<MyType>( &b ) };
+            std::vector<MyType*> Targets;
+            {
+                // one atomic add for all targets
+                SKL::TSharedPtrFanOut<decltype( Shared )> FanOut{ Shared, TargetsCount + 2U };
+                ASSERT_EQ( TargetsCount + 3U, Shared.use_count() );
+
+                for( uint32_t i = 0; i < TargetsCount; ++i )
+                {
+                    Targets.push_back( FanOut.NextRaw() );
+                }
+
+                auto Next{ FanOut.Next() };
+                ASSERT_TRUE( Next.get() == Shared.get() );
+                ASSERT_EQ( 1U, FanOut.GetRemaining() );
+            }
+            // the unused reference was released by the fan-out
+            ASSERT_EQ( TargetsCount + 1U, Shared.use_count() );
+
+            // the completions are counted and released at once on flush
+            for( auto* Target : Targets )
+            {
+                SKL::DeferredReleaseBatch::ReleaseRaw<decltype( Shared )>( Target );
+            }
+            ASSERT_EQ( 1U, SKL::DeferredReleaseBatch::GetInstance()->GetPendingObjectsCount() );
+            ASSERT_EQ( TargetsCount + 1U, Shared.use_count() );
+
+            SKL::DeferredReleaseBatch::GetInstance()->Flush();
+            ASSERT_EQ( 0U, SKL::DeferredReleaseBatch::GetInstance()->GetPendingObjectsCount() );
+            ASSERT_EQ( 1U, Shared.use_count() );
+
+            // the last reference is released (and the object destroyed) by the flush
+            SKL::DeferredReleaseBatch::Release( Shared );
+            ASSERT_FALSE( static_cast<bool>( Shared ) );
+            ASSERT_EQ( 5, b );
+            SKL::DeferredReleaseBatch::GetInstance()->Flush();
+            ASSERT_EQ( 23, b );
+        }
+
+        // more distinct objects than the batch can hold, flushed early
+        {
+            std::vector<int32_t> Values( SKL::CDeferredRelease_MaxObjects * 2U, 5 );
+            for( auto& Value : Values )
+            {
+                auto Shared{ SKL::MakeShared<MyType>( &Value ) };
+                SKL::DeferredReleaseBatch::Release( Shared );
+            }
+            ASSERT_TRUE( SKL::CDeferredRelease_MaxObjects / 2U >= SKL::DeferredReleaseBatch::GetInstance()->GetPendingObjectsCount() );
+
+            // released on destruction
+            SKL::DeferredReleaseBatch::Destroy();
+            for( const auto Value : Values )
+            {
+                ASSERT_EQ( 23, Value );
+            }
+        }
+
+        // without an instance the references are released immediately
+        {
+            int32_t c = 5;
+            auto Shared{ SKL::MakeShared<MyType>( &c ) };
+            SKL::DeferredReleaseBatch::Release( Shared );
+            ASSERT_EQ( 23, c );
+        }
+
+        SKL::KPIContext::Destroy();
+    }
+
+    TEST( MManagementTestsSuite, GlobalMemoryManager_NumaPartitions )
+    {
+        using TManager = SKL::SkylakeGlobalMemoryManager;
+
+        const uint32_t PartitionsCount{ TManager::GetNumaPartitionsCount() };
+        ASSERT_TRUE( 0U < PartitionsCount && PartitionsCount <= TManager::Pool1::PartitionsCount );
+        ASSERT_TRUE( PartitionsCount <= SKL::GetNumaNodesCount() );
+        ASSERT_TRUE( TManager::GetCurrentNumaPartition() < PartitionsCount );
+        ASSERT_TRUE( TManager::GetThreadNumaPartition() < PartitionsCount );
+
+        // slab allocated on NUMA node 0 [present on all systems]
+        using TNodePool = SKL::ObjectPool<SKL::MemoryBlock<256U>, 1024U, false, true, false, false, SKL_CACHE_LINE_SIZE, true, false, 0U>;
+        static_assert( true == TNodePool::PoolTraits::bUseNumaNode );
+        ASSERT_TRUE( SKL::RSuccess == TNodePool::Preallocate() );
+        auto* Block{ TNodePool::Allocate() };
+        ASSERT_TRUE( nullptr != Block );
+        ASSERT_TRUE( true == TNodePool::IsOwnedBySlab( Block ) );
+        ( void )memset( Block, 0xAB, sizeof( *Block ) );
+        TNodePool::Deallocate( Block );
+        TNodePool::FreePool();
+
+        // the blocks allocated from the OS [the global pools are not preallocated] have no home node
+        auto Result{ SKL::GlobalMemoryManager::Allocate<64U>() };
+        ASSERT_TRUE( true == Result.IsValid() );
+        ASSERT_EQ( SKL::CNoNumaNode, TManager::Pool1::GetHomeNumaNode( Result.MemoryBlock ) );
+        SKL::GlobalMemoryManager::Deallocate<64U>( Result.MemoryBlock );
+
+        for( uint32_t i = 0; i < PartitionsCount; ++i )
+        {
+            const auto Statistics{ TManager::GetNumaPartitionStatistics( i ) };
+            ASSERT_EQ( 0U, Statistics.SlabBytes );
+        }
+        TManager::LogNumaStatistics();
+    }
+
+    TEST( MManagementTestsSuite, STLTLSNodeAllocator_RecyclesNodes )
+    {
+        std::jthread{ []() -> void
+        {
+            SKL::KPIContext::Create();
+            ASSERT_TRUE( SKL::RSuccess == SKL::ThreadLocalMemoryManager::Create() );
+
+            {
+                SKL::TLSNodeManagedMap<int32_t, int32_t> Map;
+                auto* Pool{ Map.get_allocator().GetPool() };
+                ASSERT_TRUE( nullptr != Pool );
+
+                for( int32_t i = 0; i < 1024; ++i )
+                {
+                    Map[i] = i;
+                }
+                const uint32_t ChunksCount{ Pool->GetChunksCount() };
+                ASSERT_TRUE( 0U < ChunksCount );
+
+                // the erased nodes are recycled by the container
+                for( int32_t Round = 0; Round < 4; ++Round )
+                {
+                    for( int32_t i = 0; i < 1024; ++i )
+                    {
+                        ASSERT_EQ( 1U, Map.erase( i ) );
+                    }
+                    for( int32_t i = 0; i < 1024; ++i )
+                    {
+                        Map[i] = i * 2;
+                    }
+                    ASSERT_EQ( ChunksCount, Pool->GetChunksCount() );
+                }
+
+                // the copy gets its own pool
+                const auto MapCopy{ Map };
+                ASSERT_TRUE( Map.get_allocator() != MapCopy.get_allocator() );
+                ASSERT_EQ( 2046, MapCopy.at( 1023 ) );
+
+                SKL::TLSNodeManagedQueue<void*> Queue;
+                for( int32_t Round = 0; Round < 4; ++Round )
+                {
+                    for( uintptr_t i = 0; i < 4096U; ++i )
+                    {
+                        Queue.push( reinterpret_cast<void*>( i ) );
+                    }
+                    for( uintptr_t i = 0; i < 4096U; ++i )
+                    {
+                        ASSERT_EQ( reinterpret_cast<void*>( i ), Queue.front() );
+                        Queue.pop();
+                    }
+                }
+                ASSERT_TRUE( Queue.empty() );
+            }
+
+            SKL::ThreadLocalMemoryManager::FreeAllPools();
+            SKL::ThreadLocalMemoryManager::Destroy();
+            SKL::KPIContext::Destroy();
+        } }.join();
+    }
+
+    TEST( MManagementTestsSuite, TLSManagedQueue_Benchmark )
+    {
+        constexpr int32_t  Rounds      = 2000;
+        constexpr uint64_t ItemsCount  = 1024U;
+
+        // fill the container up to ItemsCount items and drain it, Rounds times
+        const auto RunBenchmark = []<typename TQueue, typename TPush, typename TPop>( TPush&& InPush, TPop&& InPop ) -> double
+        {
+            TQueue Queue;
+            uint64_t Checksum{ 0U };
+
+            const auto Start{ std::chrono::steady_clock::now() };
+            for( int32_t Round = 0; Round < Rounds; ++Round )
+            {
+                for( uint64_t i = 0; i < ItemsCount; ++i )
+                {
+                    InPush( Queue, ( i * 2654435761U ) ^ static_cast<uint64_t>( Round ) );
+                }
+                for( uint64_t i = 0; i < ItemsCount; ++i )
+                {
+                    Checksum += InPop( Queue );
+                }
+            }
+            const double Result{ std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - Start ).count() };
+
+            EXPECT_TRUE( Queue.empty() );
+            EXPECT_TRUE( 0U != Checksum );
+
+            return Result;
+        };
+
+        std::jthread{ [ &RunBenchmark ]() -> void
+        {
+            SKL::KPIContext::Create();
+            ASSERT_TRUE( SKL::RSuccess == SKL::ThreadLocalMemoryManager::Create() );
+
+            const auto Push     = []( auto& InQueue, uint64_t InValue ) -> void { InQueue.push( InValue ); };
+            const auto PopFront = []( auto& InQueue ) -> uint64_t { const uint64_t Value{ InQueue.front() }; InQueue.pop(); return Value; };
+            const auto PopTop   = []( auto& InQueue ) -> uint64_t { const uint64_t Value{ InQueue.top() }; InQueue.pop(); return Value; };
+
+            const double QueueTime        { RunBenchmark.template operator()<SKL::TLSManagedQueue<uint64_t>>( Push, PopFront ) };
+            const double NodeQueueTime    { RunBenchmark.template operator()<SKL::TLSNodeManagedQueue<uint64_t>>( Push, PopFront ) };
+            const double PriorityQueueTime{ RunBenchmark.template operator()<SKL::TLSManagedPriorityQueue<uint64_t>>( Push, PopTop ) };
+
+            const double Operations{ static_cast<double>( Rounds ) * static_cast<double>( ItemsCount ) * 2.0 };
+            printf( "TLSManagedQueue_Benchmark TLSManagedQueue:         %8.2fms [%6.2f Mops/s]\n", QueueTime, Operations / ( QueueTime * 1000.0 ) );
+            printf( "TLSManagedQueue_Benchmark TLSNodeManagedQueue:     %8.2fms [%6.2f Mops/s]\n", NodeQueueTime, Operations / ( NodeQueueTime * 1000.0 ) );
+            printf( "TLSManagedQueue_Benchmark TLSManagedPriorityQueue: %8.2fms [%6.2f Mops/s]\n", PriorityQueueTime, Operations / ( PriorityQueueTime * 1000.0 ) );
+
+            SKL::ThreadLocalMemoryManager::FreeAllPools();
+            SKL::ThreadLocalMemoryManager::Destroy();
+            SKL::KPIContext::Destroy();
+        } }.join();
+    }
+
+    TEST( MManagementTestsSuite, EpochReclamation_RetireAfterAllParticipantsQuiesced )
+    {
+        static std::atomic<int32_t> DeletedCount{ 0 };
+        constexpr auto Deleter{ []( void* InObject ) noexcept -> void
+        {
+            delete reinterpret_cast<int32_t*>( InObject );
+            DeletedCount.fetch_add( 1 );
+        } };
+
+        ASSERT_TRUE( SKL::RSuccess == SKL::EpochReclamation::Create() );
+        auto* Epoch{ SKL::EpochReclamation::GetInstance() };
+        ASSERT_TRUE( nullptr != Epoch );
+
+        std::atomic<int32_t> Stage{ 0 };
+        std::jthread Reader{ [ &Stage ]()
+        {
+            ASSERT_TRUE( SKL::RSuccess == SKL::EpochReclamation::Create() );
+            Stage.store( 1 );
+
+            while( 2 != Stage.load() ) { std::this_thread::yield(); }
+            SKL::EpochReclamation::GetInstance()->Quiescent();
+            Stage.store( 3 );
+
+            while( 4 != Stage.load() ) { std::this_thread::yield(); }
+            SKL::EpochReclamation::GetInstance()->GoOffline();
+            Stage.store( 5 );
+
+            while( 6 != Stage.load() ) { std::this_thread::yield(); }
+            SKL::EpochReclamation::Destroy();
+        } };
+
+        while( 1 != Stage.load() ) { std::this_thread::yield(); }
+
+        // the reader is online and didn't pass a quiescent point
+        SKL::EpochReclamation::RetireObject( new int32_t{ 1 }, Deleter );
+        for( int32_t i = 0; i < 8; ++i )
+        {
+            Epoch->Quiescent();
+        }
+        ASSERT_EQ( 0, DeletedCount.load() );
+        ASSERT_EQ( 1U, Epoch->GetPendingObjectsCount() );
+
+        Stage.store( 2 );
+        while( 3 != Stage.load() ) { std::this_thread::yield(); }
+        Epoch->Quiescent();
+        Epoch->Quiescent();
+        ASSERT_EQ( 1, DeletedCount.load() );
+        ASSERT_EQ( 0U, Epoch->GetPendingObjectsCount() );
+
+        // offline participants don't hold back the reclamation
+        Stage.store( 4 );
+        while( 5 != Stage.load() ) { std::this_thread::yield(); }
+        SKL::EpochReclamation::RetireObject( new int32_t{ 1 }, Deleter );
+        Epoch->Quiescent();
+        Epoch->Quiescent();
+        Epoch->Quiescent();
+        ASSERT_EQ( 2, DeletedCount.load() );
+
+        Stage.store( 6 );
+        Reader.join();
+
+        // retired on a thread without an instance, freed by the participants
+        std::jthread{ [ Deleter ]() { SKL::EpochReclamation::RetireObject( new int32_t{ 1 }, Deleter ); } }.join();
+        Epoch->Quiescent();
+        Epoch->Quiescent();
+        Epoch->Quiescent();
+        ASSERT_EQ( 3, DeletedCount.load() );
+
+        SKL::EpochReclamation::RetireObject( new int32_t{ 1 }, Deleter );
+        SKL::EpochReclamation::Destroy();
+        ASSERT_EQ( 1U, SKL::EpochReclamation::FreeAllRetiredObjects() );
+        ASSERT_EQ( 4, DeletedCount.load() );
+    }
 }
 
 int main( int argc, char** argv )
@@ -72,6 +72,138 @@ namespace ObjectPoolTestsSuite
 
         ASSERT_TRUE( nullptr != TMyThreadPool::Debug_ProbeAt( 0 ) );
     }
+
+    TEST( ObjectPoolTestsSuite, ObjectPool_Slab_Test )
+    {
+        using TMyThreadPool = SKL::ObjectPool<MyType, 1024, true, true, true, true, SKL_ALIGNMENT, true>;
+        using TPoolTraits   = TMyThreadPool::PoolTraits;
+
+        ASSERT_TRUE( nullptr == TMyThreadPool::GetSlab() );
+        ASSERT_TRUE( SKL::RSuccess == TMyThreadPool::Preallocate() );
+        ASSERT_TRUE( nullptr != TMyThreadPool::GetSlab() );
+
+        // all blocks are carved out of the slab, one after the other
+        for( uint64_t i = 0; i < 1024; ++i )
+        {
+            auto* Item{ TMyThreadPool::Debug_ProbeAt( i ) };
+            ASSERT_TRUE( true == TMyThreadPool::IsOwnedBySlab( Item ) );
+            ASSERT_EQ( reinterpret_cast<uint8_t*>( TMyThreadPool::GetSlab() ) + ( i * TPoolTraits::SlabBlockSize ), reinterpret_cast<uint8_t*>( Item ) );
+        }
+
+        std::vector<MyType*> Items;
+        for( int i = 0; i < 1024; ++i )
+        {
+            auto* NewItem{ TMyThreadPool::Allocate() };
+            ASSERT_TRUE( nullptr != NewItem );
+            ASSERT_TRUE( true == TMyThreadPool::IsOwnedBySlab( NewItem ) );
+            Items.push_back( NewItem );
+        }
+
+        // the pool is exhausted, the next block comes from the OS
+        auto* OSItem{ TMyThreadPool::Allocate() };
+        ASSERT_TRUE( nullptr != OSItem );
+        ASSERT_TRUE( false == TMyThreadPool::IsOwnedBySlab( OSItem ) );
+        Items.push_back( OSItem );
+
+        int Stack{ 0 };
+        ASSERT_TRUE( false == TMyThreadPool::IsOwnedBySlab( &Stack ) );
+        ASSERT_TRUE( false == TMyThreadPool::IsOwnedBySlab( nullptr ) );
+
+        // the last deallocation stomps over a slab block, it must not be freed to the OS
+        for( auto* Item : Items )
+        {
+            TMyThreadPool::Deallocate( Item );
+        }
+
+        TMyThreadPool::FreePool();
+
+        ASSERT_TRUE( nullptr == TMyThreadPool::GetSlab() );
+        ASSERT_TRUE( false == TMyThreadPool::IsOwnedBySlab( Items[0] ) );
+    }
+
+    TEST( ObjectPoolTestsSuite, ObjectPool_Slab_LargePages_Test )
+    {
+        struct MyPage
+        {
+            uint8_t Body[4096];
+        };
+
+        // 4 MiB slab, large pages are used only if the process can lock memory, otherwise it falls back to regular pages
+        using TMyThreadPool = SKL::ObjectPool<MyPage, 1024, true, true, false, false, SKL_ALIGNMENT, true, true>;
+
+        ASSERT_TRUE( SKL::RSuccess == TMyThreadPool::Preallocate() );
+        ASSERT_TRUE( nullptr != TMyThreadPool::GetSlab() );
+        
+        printf( "ObjectPool_Slab_LargePages_Test -> large pages: %s\n", TMyThreadPool::IsSlabOnLargePages() ? "yes" : "no" );
+
+        TMyThreadPool::ZeroAllMemory();
+
+        auto* NewItem{ TMyThreadPool::Allocate() };
+        ASSERT_TRUE( nullptr != NewItem );
+        ASSERT_TRUE( true == TMyThreadPool::IsOwnedBySlab( NewItem ) );
+        ASSERT_EQ( 0, NewItem->Body[0] );
+        ASSERT_EQ( 0, NewItem->Body[4095] );
+
+        TMyThreadPool::Deallocate( NewItem );
+        TMyThreadPool::FreePool();
+
+        ASSERT_TRUE( nullptr == TMyThreadPool::GetSlab() );
+        ASSERT_TRUE( false == TMyThreadPool::IsSlabOnLargePages() );
+    }
+
+    TEST( ObjectPoolTestsSuite, ObjectPool_Slab_StompedSlabBlockStaysCached_Test )
+    {
+        using TMyThreadPool = SKL::ObjectPool<MyType, 2, true, true, true, true, SKL_ALIGNMENT, true>;
+
+        const size_t PendingSlabsCount{ SKL::SlabRegistry::GetPendingSlabsCount() };
+        ASSERT_TRUE( SKL::RSuccess == TMyThreadPool::Preallocate() );
+
+        auto* SlabItemA{ TMyThreadPool::Allocate() };
+        auto* SlabItemB{ TMyThreadPool::Allocate() };
+        auto* OSItemA  { TMyThreadPool::Allocate() };
+        auto* OSItemB  { TMyThreadPool::Allocate() };
+        ASSERT_TRUE( true == TMyThreadPool::IsOwnedBySlab( SlabItemA ) );
+        ASSERT_TRUE( true == TMyThreadPool::IsOwnedBySlab( SlabItemB ) );
+        ASSERT_TRUE( false == TMyThreadPool::IsOwnedBySlab( OSItemA ) );
+        ASSERT_TRUE( false == TMyThreadPool::IsOwnedBySlab( OSItemB ) );
+
+        // SlabItemB stomps over SlabItemA, SlabItemA must be moved to the slot holding OSItemB
+        TMyThreadPool::Deallocate( OSItemA );
+        TMyThreadPool::Deallocate( SlabItemA );
+        TMyThreadPool::Deallocate( OSItemB );
+        TMyThreadPool::Deallocate( SlabItemB );
+
+        ASSERT_TRUE( true == TMyThreadPool::IsOwnedBySlab( TMyThreadPool::Debug_ProbeAt( 0 ) ) );
+        ASSERT_TRUE( true == TMyThreadPool::IsOwnedBySlab( TMyThreadPool::Debug_ProbeAt( 1 ) ) );
+
+        // all the slab blocks are cached, the slab is freed right away
+        TMyThreadPool::FreePool();
+        ASSERT_EQ( PendingSlabsCount, SKL::SlabRegistry::GetPendingSlabsCount() );
+    }
+
+    TEST( ObjectPoolTestsSuite, ObjectPool_Slab_FreePoolWithBlocksInUse_Test )
+    {
+        using TMyThreadPool = SKL::ObjectPool<MyType, 4, true, true, true, true, SKL_ALIGNMENT, true>;
+
+        const size_t PendingSlabsCount{ SKL::SlabRegistry::GetPendingSlabsCount() };
+        ASSERT_TRUE( SKL::RSuccess == TMyThreadPool::Preallocate() );
+
+        auto* Item{ TMyThreadPool::Allocate() };
+        ASSERT_TRUE( true == TMyThreadPool::IsOwnedBySlab( Item ) );
+
+        // the slab must outlive the block still in use
+        TMyThreadPool::FreePool();
+        ASSERT_TRUE( nullptr == TMyThreadPool::GetSlab() );
+        ASSERT_EQ( PendingSlabsCount + 1U, SKL::SlabRegistry::GetPendingSlabsCount() );
+
+        Item->a = 5;
+        ASSERT_EQ( 5, Item->a );
+
+        // the last block of the released slab comes back, the slab is freed
+        TMyThreadPool::Deallocate( Item );
+        TMyThreadPool::FreePool();
+        ASSERT_EQ( PendingSlabsCount, SKL::SlabRegistry::GetPendingSlabsCount() );
+    }
 }
 
 int main( int argc, char** argv )
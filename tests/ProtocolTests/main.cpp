@@ -292,6 +292,21 @@ namespace SkylakePROTOCOLTests
         ASSERT_TRUE( 0 == SKL_STRLEN( ReadPacket.String, 128 ) );
     }
 
+    TEST( SkylakePROTOCOLTests, PacketBuildContext_BufferSizeClass )
+    {
+        ASSERT_EQ( 0U, HEADER_ONLY_PACKET_1_Packet::GetBufferSizeClass() );
+
+        FIXED_LENGTH_PACKET_1_Packet FixedPacket{ .A = 55, .B = 23, .C = 11 };
+        ASSERT_EQ( 0U, FixedPacket.GetBufferSizeClass() );
+
+        DYNAMIC_LENGTH_PACKET_1_Packet DynamicPacket{};
+        ASSERT_EQ( 0U, DynamicPacket.GetBufferSizeClass() );
+
+        ASSERT_EQ( 1U, SKL::GetPacketBufferSizeClass( SKL::CPacketBufferSizeClasses[0] ) );
+        ASSERT_EQ( 3U, SKL::GetPacketBufferSizeClass( SKL::CPacketBufferSizeClasses[2] ) );
+        ASSERT_EQ( SKL::CPacketBufferMaxSizeClass, SKL::GetPacketBufferSizeClass( SKL::CPacketMaximumSize ) );
+    }
+
     TEST( SkylakePROTOCOLTests, DynamicLengthPacketBuildContext_API_2 )
     {
         auto Buffer = std::make_unique<uint8_t[]>( 1024 );
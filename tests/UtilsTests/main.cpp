@@ -780,6 +780,41 @@ namespace SkylakeNetBufferTests
             ASSERT_EQ( Targets[1], 798U );
         }
     }
+
+    TEST( SkylakeNetBufferTests, AsyncNetBuffer_SizeClasses )
+    {
+        using MySmallBuffer = SKL::TSizedAsyncNetBuffer<0U>;
+        using MyMaxBuffer   = SKL::TSizedAsyncNetBuffer<SKL::CPacketBufferMaxSizeClass>;
+
+        static_assert( std::is_same_v<MyMaxBuffer, SKL::AsyncNetBuffer<16>> );
+        static_assert( sizeof( MySmallBuffer ) < sizeof( MyMaxBuffer ) );
+
+        ASSERT_EQ( MySmallBuffer::GetTotalBufferSize(), SKL::CPacketBufferSizeClasses[0] );
+        ASSERT_EQ( MySmallBuffer::GetPacketBufferSize(), SKL::CPacketBufferSizeClasses[0] - SKL::CPacketBufferPaddingSize );
+        ASSERT_EQ( MySmallBuffer::GetPacketBodyBufferSize(), SKL::IAsyncNetBuffer<16, SKL::CPacketBufferSizeClasses[0]>::GetPacketBodyBufferSize() );
+
+        // the buffer, its header and the shared control block fill the targeted memory block
+        static_assert( SKL::CMemoryManager_Pool3_BlockSize == SKL::GetSizedAsyncNetBufferBlockSize<0U>() );
+        ASSERT_EQ( MyMaxBuffer::GetPacketBodyBufferSize(), SKL::CPacketMaximumUsableBodySize );
+
+        ASSERT_EQ( 0U, SKL::GetPacketBufferSizeClass( SKL::CPacketHeaderSize ) );
+        ASSERT_EQ( 0U, SKL::GetPacketBufferSizeClass( MySmallBuffer::GetPacketBufferSize() ) );
+        ASSERT_EQ( 1U, SKL::GetPacketBufferSizeClass( MySmallBuffer::GetPacketBufferSize() + 1U ) );
+        ASSERT_EQ( 2U, SKL::GetPacketBufferSizeClass( 4096U ) );
+        ASSERT_EQ( SKL::CPacketBufferMaxSizeClass, SKL::GetPacketBufferSizeClass( SKL::CPacketMaximumUsableUserPacketSize ) );
+
+        {
+            MySmallBuffer Buffer;
+            ASSERT_EQ( Buffer.GetInterface().Length, SKL::CPacketBufferSizeClasses[0] );
+
+            SKL::EditAsyncNetBuffer( Buffer ).PrepareForReceivingHeader();
+            *reinterpret_cast<SKL::PacketHeader*>( Buffer.GetStreamBase().GetBuffer() ) = SKL::PacketHeader{ .Size = 8U, .Opcode = 5U };
+
+            const auto [hasReceivedWholePacket, bProcessedSuccessfully] = SKL::EditAsyncNetBuffer( Buffer ).ConfirmReceivedExactAmmount( 4U );
+            ASSERT_TRUE( bProcessedSuccessfully );
+            ASSERT_FALSE( hasReceivedWholePacket );
+        }
+    }
 }
 
 int main( int argc, char** argv )